@@ -41,8 +41,10 @@
 #include "ObjectModel.hpp"
 #include "omr.h"
 #include "omrExampleVM.hpp"
+#include "omrhashtable.h"
 #include "omrvm.h"
 #include "OMRVMInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
@@ -312,25 +314,53 @@ MM_CollectorLanguageInterfaceImpl::scavenger_fixupDestroyedSlot(MM_EnvironmentBa
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap)
 {
-	Assert_MM_unimplemented();
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
 {
-	Assert_MM_unimplemented();
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		J9HashTableState state;
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				if (NULL != rootEntry->rootPtr) {
+					rootEntry->rootPtr = compactScheme->getForwardingPtr(rootEntry->rootPtr);
+				}
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+		/* entries for unmarked objects were removed from the object table after marking */
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				objectEntry->objPtr = compactScheme->getForwardingPtr(objectEntry->objPtr);
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+		OMR_VMThread *walkThread;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+			if (NULL != walkThread->_savedObject1) {
+				walkThread->_savedObject1 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				walkThread->_savedObject2 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+			}
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_workerCleanupAfterGC(MM_EnvironmentBase *env)
 {
-	Assert_MM_unimplemented();
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_languageMasterSetupForGC(MM_EnvironmentBase *env)
 {
-	Assert_MM_unimplemented();
 }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
@@ -36,6 +36,9 @@ class MM_ConfigurationDelegate
  */
 private:
 	const MM_GCPolicy _gcPolicy;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	OMR_SizeClasses _sizeClasses; /**< Storage for the size classes, which are filled in by MM_SizeClasses */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 protected:
 public:
@@ -104,7 +107,7 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase *env)
 	{
-		return NULL;
+		return &_sizeClasses;
 	}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
@@ -118,8 +118,8 @@ public:
 					}
 					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
 				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
 			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
 
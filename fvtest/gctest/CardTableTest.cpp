@@ -0,0 +1,195 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "gcTestHelpers.hpp"
+
+#include "CardTable.hpp"
+#include "HeapMapWordScanner.hpp"
+
+#define CARD_TABLE_TEST_SLOTS 64
+#define CARD_TABLE_TEST_CARDS (CARD_TABLE_TEST_SLOTS * sizeof(uintptr_t))
+/* a card value which makes its slot non-empty without being of interest to CARD_DIRTY */
+#define CARD_TABLE_TEST_OTHER ((Card)(CARD_DIRTY << 1))
+
+/**
+ * A synthetic card table, aligned to a slot like the real one.
+ */
+class CardTableTest
+{
+public:
+	uintptr_t slots[CARD_TABLE_TEST_SLOTS];
+	Card *cards;
+
+	CardTableTest()
+		: cards((Card *)slots)
+	{
+		memset(slots, 0, sizeof(slots));
+	}
+
+	void
+	dirty(uintptr_t first, uintptr_t count, Card value = CARD_DIRTY)
+	{
+		for (uintptr_t index = first; index < (first + count); index++) {
+			cards[index] = value;
+		}
+	}
+
+	/**
+	 * @return the index of the first card of interest from first up to top, or top if there is none
+	 */
+	uintptr_t
+	find(uintptr_t first, uintptr_t top)
+	{
+		return MM_CardTable::findDirtyCard(cards + first, cards + top, CARD_DIRTY) - cards;
+	}
+
+	/**
+	 * @return the index of the card after the run starting at first
+	 */
+	uintptr_t
+	findRunTop(uintptr_t first, uintptr_t top, uintptr_t maxRunLength)
+	{
+		return MM_CardTable::findDirtyCardRunTop(cards + first, cards + top, CARD_DIRTY, maxRunLength) - cards;
+	}
+};
+
+TEST(GCCardTableTest, findDirtyCard)
+{
+	const MM_HeapMapWordScanner::ScanImplementation implementations[] = {
+		MM_HeapMapWordScanner::SCAN_SCALAR,
+		MM_HeapMapWordScanner::SCAN_SSE42,
+		MM_HeapMapWordScanner::SCAN_AVX2,
+	};
+	MM_HeapMapWordScanner::ScanImplementation selected = MM_HeapMapWordScanner::getImplementation();
+	const uintptr_t slotSize = sizeof(uintptr_t);
+
+	for (uintptr_t s = 0; s < sizeof(implementations) / sizeof(implementations[0]); s++) {
+		if (!MM_HeapMapWordScanner::setImplementation(implementations[s])) {
+			continue;
+		}
+		const char *name = MM_HeapMapWordScanner::getImplementationName(implementations[s]);
+
+		/* a clean table has no cards of interest */
+		CardTableTest clean;
+		ASSERT_EQ(CARD_TABLE_TEST_CARDS, clean.find(0, CARD_TABLE_TEST_CARDS)) << name;
+		ASSERT_EQ((uintptr_t)3, clean.find(3, 3)) << name;
+
+		/* a card many clean slots along is found from an aligned or an unaligned start */
+		CardTableTest far;
+		uintptr_t farCard = (40 * slotSize) + 5;
+		far.dirty(farCard, 1);
+		ASSERT_EQ(farCard, far.find(0, CARD_TABLE_TEST_CARDS)) << name;
+		ASSERT_EQ(farCard, far.find(1, CARD_TABLE_TEST_CARDS)) << name;
+		ASSERT_EQ(farCard, far.find(farCard, CARD_TABLE_TEST_CARDS)) << name;
+		ASSERT_EQ(CARD_TABLE_TEST_CARDS, far.find(farCard + 1, CARD_TABLE_TEST_CARDS)) << name;
+
+		/* the top card may be in the middle of a slot, and cards at or beyond it are not found */
+		ASSERT_EQ(farCard, far.find(0, farCard + 1)) << name;
+		ASSERT_EQ(farCard, far.find(0, (41 * slotSize) - 1)) << name;
+		ASSERT_EQ(farCard, far.find(0, farCard)) << name;
+		ASSERT_EQ((40 * slotSize) + 2, far.find(0, (40 * slotSize) + 2)) << name;
+
+		/* a slot holding only cards which are not of interest stops the slot scan, but not the search */
+		CardTableTest other;
+		other.dirty(10 * slotSize, 3, CARD_TABLE_TEST_OTHER);
+		other.dirty((20 * slotSize) + 1, 1, CARD_TABLE_TEST_OTHER);
+		other.dirty((30 * slotSize) + slotSize - 1, 1);
+		ASSERT_EQ((30 * slotSize) + slotSize - 1, other.find(0, CARD_TABLE_TEST_CARDS)) << name;
+		ASSERT_EQ(30 * slotSize, other.find(0, 30 * slotSize)) << name;
+
+		/* a card of interest in the last slot of the table is found */
+		CardTableTest last;
+		last.dirty(CARD_TABLE_TEST_CARDS - 1, 1);
+		ASSERT_EQ(CARD_TABLE_TEST_CARDS - 1, last.find(0, CARD_TABLE_TEST_CARDS)) << name;
+	}
+
+	MM_HeapMapWordScanner::setImplementation(selected);
+}
+
+TEST(GCCardTableTest, findDirtyCardRunTop)
+{
+	CardTableTest table;
+	/* two adjacent runs, split by a single clean card */
+	table.dirty(10, 5);
+	table.dirty(16, 2);
+	ASSERT_EQ((uintptr_t)15, table.findRunTop(10, CARD_TABLE_TEST_CARDS, 16));
+	ASSERT_EQ((uintptr_t)16, table.find(15, CARD_TABLE_TEST_CARDS));
+	ASSERT_EQ((uintptr_t)18, table.findRunTop(16, CARD_TABLE_TEST_CARDS, 16));
+
+	/* a card which is not of interest ends a run */
+	table.dirty(18, 1, CARD_TABLE_TEST_OTHER);
+	ASSERT_EQ((uintptr_t)18, table.findRunTop(16, CARD_TABLE_TEST_CARDS, 16));
+
+	/* a run longer than the maximum is split, and the rest starts the next run */
+	table.dirty(40, 20);
+	ASSERT_EQ((uintptr_t)56, table.findRunTop(40, CARD_TABLE_TEST_CARDS, 16));
+	ASSERT_EQ((uintptr_t)56, table.find(56, CARD_TABLE_TEST_CARDS));
+	ASSERT_EQ((uintptr_t)60, table.findRunTop(56, CARD_TABLE_TEST_CARDS, 16));
+
+	/* a run ends at the top card even if the cards beyond it are dirty */
+	ASSERT_EQ((uintptr_t)45, table.findRunTop(40, 45, 16));
+
+	/* a maximum of one is card at a time cleaning */
+	ASSERT_EQ((uintptr_t)41, table.findRunTop(40, CARD_TABLE_TEST_CARDS, 1));
+}
+
+TEST(GCCardTableTest, claimRuns)
+{
+	/* claim runs across the whole table as final card cleaning does, and check that every dirty card is
+	 * claimed exactly once, in runs no longer than the maximum which only hold dirty cards
+	 */
+	const uintptr_t maxRunLengths[] = {1, 2, 7, 16, CARD_TABLE_TEST_CARDS};
+	CardTableTest table;
+	uint32_t seed = 0x9E3779B9;
+	uintptr_t dirtyCards = 0;
+	uintptr_t index = 0;
+	while (index < CARD_TABLE_TEST_CARDS) {
+		seed = (seed * 1103515245) + 12345;
+		uintptr_t runLength = 1 + ((seed >> 16) % 24);
+		seed = (seed * 1103515245) + 12345;
+		bool dirty = (0 == ((seed >> 16) % 3));
+		for (uintptr_t i = 0; (i < runLength) && (index < CARD_TABLE_TEST_CARDS); i++, index++) {
+			if (dirty) {
+				table.cards[index] = CARD_DIRTY;
+				dirtyCards += 1;
+			}
+		}
+	}
+
+	for (uintptr_t m = 0; m < sizeof(maxRunLengths) / sizeof(maxRunLengths[0]); m++) {
+		uintptr_t maxRunLength = maxRunLengths[m];
+		uintptr_t claimedCards = 0;
+		uintptr_t card = table.find(0, CARD_TABLE_TEST_CARDS);
+		while (card < CARD_TABLE_TEST_CARDS) {
+			uintptr_t runTop = table.findRunTop(card, CARD_TABLE_TEST_CARDS, maxRunLength);
+			ASSERT_LT(card, runTop) << "maxRunLength " << maxRunLength;
+			ASSERT_LE(runTop - card, maxRunLength) << "maxRunLength " << maxRunLength;
+			for (uintptr_t claimed = card; claimed < runTop; claimed++) {
+				ASSERT_EQ(CARD_DIRTY, table.cards[claimed]) << "card " << claimed << " maxRunLength " << maxRunLength;
+			}
+			/* a run shorter than the maximum ends at a clean card or the top of the table */
+			if ((runTop - card) < maxRunLength) {
+				ASSERT_TRUE((CARD_TABLE_TEST_CARDS == runTop) || (CARD_DIRTY != table.cards[runTop])) << "maxRunLength " << maxRunLength;
+			}
+			claimedCards += runTop - card;
+			card = table.find(runTop, CARD_TABLE_TEST_CARDS);
+		}
+		ASSERT_EQ(dirtyCards, claimedCards) << "maxRunLength " << maxRunLength;
+	}
+}
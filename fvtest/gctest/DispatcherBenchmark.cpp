@@ -0,0 +1,244 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "gcTestHelpers.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
+#include "ParkingDispatcher.hpp"
+#include "StartupManagerTestExample.hpp"
+
+#define DISPATCHER_BENCHMARK_TASKS 10000
+#define DISPATCHER_BENCHMARK_SYNCHRONIZING_TASKS 1000
+#define DISPATCHER_BENCHMARK_SYNCHRONIZE_ROUNDS 10
+#define DISPATCHER_BENCHMARK_MINIMUM_THREADS 4
+
+/**
+ * A task with no work, so that dispatching it measures only the cost of waking the threads and waiting for them to finish.
+ */
+class MM_EmptyBenchmarkTask : public MM_ParallelTask
+{
+public:
+	volatile uintptr_t _runCount; /**< threads that ran the task */
+
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_DISPATCHER_IDLE; }
+	virtual void run(MM_EnvironmentBase *env) { MM_AtomicOperations::add(&_runCount, 1); }
+
+	MM_EmptyBenchmarkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher) :
+		MM_ParallelTask(env, dispatcher)
+		,_runCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * A task that only synchronizes its threads, checking that no thread leaves a synchronization point before every
+ * thread has reached it, and that exactly one thread (the master, where required) is released early.
+ */
+class MM_SynchronizingBenchmarkTask : public MM_EmptyBenchmarkTask
+{
+public:
+	volatile uintptr_t _arrivedCount; /**< arrivals at synchronization points, by all threads */
+	volatile uintptr_t _releasedCount; /**< threads released early from a synchronization point */
+	volatile uintptr_t _errorCount; /**< threads that saw a synchronization point misbehave */
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_SynchronizingBenchmarkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher) :
+		MM_EmptyBenchmarkTask(env, dispatcher)
+		,_arrivedCount(0)
+		,_releasedCount(0)
+		,_errorCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+void
+MM_SynchronizingBenchmarkTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = getThreadCount();
+	uintptr_t arrivals = 0;
+
+	for (uintptr_t round = 0; round < DISPATCHER_BENCHMARK_SYNCHRONIZE_ROUNDS; round++) {
+		MM_AtomicOperations::add(&_arrivedCount, 1);
+		arrivals += threadCount;
+		synchronizeGCThreads(env, UNIQUE_ID);
+		/* other threads may already have arrived at the next point, but every thread must have arrived at this one */
+		if (_arrivedCount < arrivals) {
+			MM_AtomicOperations::add(&_errorCount, 1);
+		}
+	}
+
+	MM_AtomicOperations::add(&_arrivedCount, 1);
+	arrivals += threadCount;
+	if (synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		if (!env->isMasterThread() || (arrivals != _arrivedCount) || (0 != _releasedCount)) {
+			MM_AtomicOperations::add(&_errorCount, 1);
+		}
+		MM_AtomicOperations::add(&_releasedCount, 1);
+		releaseSynchronizedGCThreads(env);
+	} else if (1 != _releasedCount) {
+		MM_AtomicOperations::add(&_errorCount, 1);
+	}
+
+	MM_AtomicOperations::add(&_arrivedCount, 1);
+	arrivals += threadCount;
+	if (synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		if ((arrivals != _arrivedCount) || (1 != _releasedCount)) {
+			MM_AtomicOperations::add(&_errorCount, 1);
+		}
+		MM_AtomicOperations::add(&_releasedCount, 1);
+		releaseSynchronizedGCThreads(env);
+	} else if (2 != _releasedCount) {
+		MM_AtomicOperations::add(&_errorCount, 1);
+	}
+
+	MM_EmptyBenchmarkTask::run(env);
+}
+
+class GCDispatcherBenchmark : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void SetUp();
+	virtual void TearDown();
+
+	/**
+	 * Start the dispatcher's threads, dispatch empty tasks on all of them, then tasks that only synchronize their
+	 * threads, and shut the threads down again.
+	 * @param[out] emptyNanos the mean time to dispatch and complete an empty task, in nanoseconds
+	 * @param[out] synchronizingNanos the mean time to dispatch and complete a synchronizing task, in nanoseconds
+	 */
+	void dispatchTasks(MM_ParallelDispatcher *dispatcher, uint64_t *emptyNanos, uint64_t *synchronizingNanos);
+
+public:
+	GCDispatcherBenchmark()
+		: exampleVM(&gcTestEnv->exampleVM)
+		, env(NULL)
+	{
+	}
+};
+
+void
+GCDispatcherBenchmark::SetUp()
+{
+	/* any configuration will do, as the benchmark only needs the GC to be initialized */
+	MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, gcTestEnv->params[0]);
+
+	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+}
+
+void
+GCDispatcherBenchmark::TearDown()
+{
+	omr_error_t rc = OMR_GC_ShutdownCollector(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownCollector failed, rc=" << rc;
+
+	rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+
+	rc = OMR_GC_ShutdownHeap(exampleVM->_omrVM);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownHeap failed, rc=" << rc;
+
+	exampleVM->_omrVMThread = NULL;
+}
+
+void
+GCDispatcherBenchmark::dispatchTasks(MM_ParallelDispatcher *dispatcher, uint64_t *emptyNanos, uint64_t *synchronizingNanos)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+
+	ASSERT_TRUE(dispatcher->startUpThreads());
+
+	uint64_t start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < DISPATCHER_BENCHMARK_TASKS; i++) {
+		MM_EmptyBenchmarkTask task(env, dispatcher);
+		dispatcher->run(env, &task);
+		EXPECT_EQ(dispatcher->threadCount(), task.getThreadCount());
+		EXPECT_EQ(task.getThreadCount(), task._runCount);
+	}
+	*emptyNanos = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS) / DISPATCHER_BENCHMARK_TASKS;
+
+	start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < DISPATCHER_BENCHMARK_SYNCHRONIZING_TASKS; i++) {
+		MM_SynchronizingBenchmarkTask task(env, dispatcher);
+		dispatcher->run(env, &task);
+		uintptr_t threadCount = task.getThreadCount();
+		EXPECT_EQ(dispatcher->threadCount(), threadCount);
+		EXPECT_EQ(threadCount, task._runCount);
+		EXPECT_EQ((uintptr_t)0, task._errorCount);
+		EXPECT_EQ((uintptr_t)2, task._releasedCount);
+		EXPECT_EQ((DISPATCHER_BENCHMARK_SYNCHRONIZE_ROUNDS + 2) * threadCount, task._arrivedCount);
+	}
+	*synchronizingNanos = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS) / DISPATCHER_BENCHMARK_SYNCHRONIZING_TASKS;
+
+	dispatcher->shutDownThreads();
+}
+
+TEST_F(GCDispatcherBenchmark, emptyTaskDispatch)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* dispatch on every thread, however small the heap, and on enough threads for the wakeup tree to have depth */
+	bool gcThreadCountForced = extensions->gcThreadCountForced;
+	uintptr_t gcThreadCount = extensions->gcThreadCount;
+	extensions->gcThreadCountForced = true;
+	extensions->gcThreadCount = OMR_MAX(gcThreadCount, (uintptr_t)DISPATCHER_BENCHMARK_MINIMUM_THREADS);
+
+	MM_ParallelDispatcher *parallelDispatcher = MM_ParallelDispatcher::newInstance(env, NULL, NULL, OMR_OS_STACK_SIZE);
+	ASSERT_TRUE(NULL != parallelDispatcher);
+	uint64_t parallelNanos = 0;
+	uint64_t parallelSynchronizingNanos = 0;
+	dispatchTasks(parallelDispatcher, &parallelNanos, &parallelSynchronizingNanos);
+	parallelDispatcher->kill(env);
+
+	MM_ParkingDispatcher *parkingDispatcher = MM_ParkingDispatcher::newInstance(env, NULL, NULL, OMR_OS_STACK_SIZE);
+	ASSERT_TRUE(NULL != parkingDispatcher);
+	uint64_t parkingNanos = 0;
+	uint64_t parkingSynchronizingNanos = 0;
+	dispatchTasks(parkingDispatcher, &parkingNanos, &parkingSynchronizingNanos);
+	parkingDispatcher->kill(env);
+
+	omrtty_printf("%-10s %8s %12s %16s\n", "dispatcher", "threads", "ns/task", "ns/synced task");
+	omrtty_printf("%-10s %8zu %12llu %16llu\n", "parallel", extensions->gcThreadCount, parallelNanos, parallelSynchronizingNanos);
+	omrtty_printf("%-10s %8zu %12llu %16llu\n", "parking", extensions->gcThreadCount, parkingNanos, parkingSynchronizingNanos);
+
+	extensions->gcThreadCountForced = gcThreadCountForced;
+	extensions->gcThreadCount = gcThreadCount;
+
+	/* The parking dispatcher exists to be cheaper; allow for noise, but not for it being clearly slower. When there are
+	 * fewer CPUs than threads every hand-off in the barrier tree is a context switch, so synchronizing can cost up to
+	 * twice as much there.
+	 */
+	EXPECT_LE(parkingNanos, 2 * parallelNanos);
+	EXPECT_LE(parkingSynchronizingNanos, 4 * parallelSynchronizingNanos);
+}
@@ -17,18 +17,23 @@
  *******************************************************************************/
 
 #include "CollectorLanguageInterface.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "HeapWalker.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
 #include "SlotObject.hpp"
+#include "VerboseBinaryDecoder.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
 #define MAX_NAME_LENGTH 512
+#define HEAP_CENSUS_SIZE_CLASSES 64
 #define OMRGCTEST_CHECK_RT(rt) \
 	if (0 != (rt)) {\
 		goto done;\
@@ -293,12 +298,15 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
 				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
+		/* the heap only resizes when it collects */
+		peakHeapSize = OMR_MAX(peakHeapSize, env->getExtensions()->heap->getActiveMemorySize());
 	}
 
 	ObjectEntry *newEntry = NULL;
 	if (NULL != objEntry.objPtr) {
 		uintptr_t consumedSize = env->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(objEntry.objPtr);
 		uintptr_t adjustedSize = env->getExtensions()->objectModel.adjustSizeInBytes(size);
+		allocatedBytes += consumedSize;
 		if (consumedSize == adjustedSize) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Allocate object name: %s(%p[0x%llx])\n", objEntry.name, objEntry.objPtr, consumedSize);
 		} else {
@@ -786,6 +794,70 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * Collects the XML text decoded from a binary verbose file.
+ */
+class VerboseTextCollector : public MM_VerboseBinaryDecoderVisitor
+{
+public:
+	OMRPortLibrary *portLib;
+	char *text;
+	uintptr_t size;
+	uintptr_t capacity;
+
+	bool append(const char *string, uintptr_t length)
+	{
+		if ((size + length) > capacity) {
+			OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+			uintptr_t newCapacity = OMR_MAX(size + length, 2 * capacity);
+			char *newText = (char *)omrmem_reallocate_memory(text, newCapacity, OMRMEM_CATEGORY_MM);
+			if (NULL == newText) {
+				return false;
+			}
+			text = newText;
+			capacity = newCapacity;
+		}
+		memcpy(text + size, string, length);
+		size += length;
+		return true;
+	}
+
+	virtual bool header(const char *string, uintptr_t length) { return append(string, length); }
+	virtual bool record(const char *string, uintptr_t length) { return append(string, length); }
+	virtual bool footer(const char *string, uintptr_t length) { return append(string, length); }
+
+	VerboseTextCollector(OMRPortLibrary *portLibrary)
+		: portLib(portLibrary)
+		, text(NULL)
+		, size(0)
+		, capacity(0)
+	{}
+};
+
+pugi::xml_parse_result
+GCConfigTest::loadVerboseFile(pugi::xml_document *verboseDoc, const char *name)
+{
+	if (!MM_VerboseBinaryDecoder::isBinaryFile(gcTestEnv->portLib, name)) {
+		return verboseDoc->load_file(name);
+	}
+
+	/* -Xgc:verboseBinaryFormat; verify the XML the file decodes to */
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	pugi::xml_parse_result result;
+	VerboseTextCollector collector(gcTestEnv->portLib);
+	MM_VerboseBinaryDecoder decoder(gcTestEnv->portLib);
+	MM_VerboseBinaryDecoder::DecodeResult decodeResult = decoder.decode(name, &collector);
+	decoder.tearDown();
+	if (MM_VerboseBinaryDecoder::DECODE_OK == decodeResult) {
+		result = verboseDoc->load_buffer(collector.text, collector.size);
+	} else {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s: %s.\n", __FILE__, __LINE__, name, MM_VerboseBinaryDecoder::getResultDescription(decodeResult));
+		result.status = pugi::status_io_error;
+	}
+	omrmem_free_memory(collector.text);
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -807,7 +879,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseFile(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -815,7 +887,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseFile(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -930,6 +1002,172 @@ done:
 	return rt;
 }
 
+/**
+ * Objects and bytes in the heap, by size class. Size class n holds objects of 2^n to 2^(n+1)-1 bytes.
+ */
+typedef struct HeapCensus {
+	uintptr_t objects[HEAP_CENSUS_SIZE_CLASSES];
+	uintptr_t bytes[HEAP_CENSUS_SIZE_CLASSES];
+	uintptr_t threads; /**< per-thread censuses merged into this one */
+} HeapCensus;
+
+static void
+heapCensusAddObject(HeapCensus *census, omrobjectptr_t object)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(gcTestEnv->exampleVM._omrVM);
+	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	uintptr_t sizeClass = 0;
+	while ((size >> (sizeClass + 1)) > 0) {
+		sizeClass += 1;
+	}
+	census->objects[sizeClass] += 1;
+	census->bytes[sizeClass] += size;
+}
+
+static void
+heapCensusObjectDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	heapCensusAddObject((HeapCensus *)userData, object);
+}
+
+static void
+heapCensusParallelObjectDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData, void *threadData)
+{
+	heapCensusAddObject((HeapCensus *)threadData, object);
+}
+
+static void
+heapCensusMerge(OMR_VMThread *omrVMThread, void *userData, void *threadData)
+{
+	HeapCensus *census = (HeapCensus *)userData;
+	HeapCensus *threadCensus = (HeapCensus *)threadData;
+	for (uintptr_t sizeClass = 0; sizeClass < HEAP_CENSUS_SIZE_CLASSES; sizeClass++) {
+		census->objects[sizeClass] += threadCensus->objects[sizeClass];
+		census->bytes[sizeClass] += threadCensus->bytes[sizeClass];
+	}
+	census->threads += 1;
+}
+
+int32_t
+GCConfigTest::heapCensus(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	AttributeElem *threadsElem = NULL;
+	MM_HeapWalker *heapWalker = NULL;
+	HeapCensus serialCensus;
+	memset(&serialCensus, 0, sizeof(serialCensus));
+
+	const char *threadsStr = node.attribute("threads").value();
+	if (0 == strcmp(threadsStr, "")) {
+		threadsStr = "1";
+	}
+	rt = parseAttribute(&threadsElem, threadsStr);
+	OMRGCTEST_CHECK_RT(rt);
+
+	heapWalker = MM_HeapWalker::newInstance(env);
+	if (NULL == heapWalker) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to instantiate heap walker.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	env->acquireExclusiveVMAccess();
+	{
+		/* The single threaded walk is the reference the parallel walks are checked against */
+		uint64_t startTime = omrtime_hires_clock();
+		heapWalker->allObjectsDo(env, heapCensusObjectDo, &serialCensus, 0, false, false);
+		uint64_t serialTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		uintptr_t totalObjects = 0;
+		uintptr_t totalBytes = 0;
+		gcTestEnv->log(LEVEL_VERBOSE, "%10s %12s %14s\n", "size", "objects", "bytes");
+		for (uintptr_t sizeClass = 0; sizeClass < HEAP_CENSUS_SIZE_CLASSES; sizeClass++) {
+			if (0 != serialCensus.objects[sizeClass]) {
+				gcTestEnv->log(LEVEL_VERBOSE, "%10zu %12zu %14zu\n", (size_t)1 << sizeClass, serialCensus.objects[sizeClass], serialCensus.bytes[sizeClass]);
+				totalObjects += serialCensus.objects[sizeClass];
+				totalBytes += serialCensus.bytes[sizeClass];
+			}
+		}
+		gcTestEnv->log("Heap census: %zu objects, %zu bytes\n", totalObjects, totalBytes);
+		gcTestEnv->log("Heap census serial walk: %llu us\n", serialTime);
+
+		AttributeElem *threadsCur = threadsElem;
+		do {
+			HeapCensus parallelCensus;
+			memset(&parallelCensus, 0, sizeof(parallelCensus));
+			uintptr_t threads = (uintptr_t)threadsCur->value;
+			startTime = omrtime_hires_clock();
+			if (!heapWalker->parallelObjectsDo(env, heapCensusParallelObjectDo, heapCensusMerge, &parallelCensus, sizeof(HeapCensus), 0, threads)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform parallel heap walk.\n", __FILE__, __LINE__);
+				break;
+			}
+			uint64_t parallelTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			gcTestEnv->log("Heap census parallel walk with %zu threads: %llu us (%.2fx)\n", threads, parallelTime, (0 == parallelTime) ? 0.0 : ((double)serialTime / (double)parallelTime));
+
+			if ((0 != memcmp(serialCensus.objects, parallelCensus.objects, sizeof(serialCensus.objects)))
+				|| (0 != memcmp(serialCensus.bytes, parallelCensus.bytes, sizeof(serialCensus.bytes)))
+			) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap census with %zu threads does not match the serial census.\n", __FILE__, __LINE__, threads);
+				break;
+			}
+			/* threads beyond the limit must not have been dispatched at all */
+			if ((0 == parallelCensus.threads) || (parallelCensus.threads > threads)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk limited to %zu threads ran on %zu threads.\n", __FILE__, __LINE__, threads, parallelCensus.threads);
+				break;
+			}
+			threadsCur = threadsCur->linkNext;
+		} while (threadsElem != threadsCur);
+	}
+	env->releaseExclusiveVMAccess();
+
+done:
+	if (NULL != heapWalker) {
+		heapWalker->kill(env);
+	}
+	freeAttributeList(threadsElem);
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyHeapPages(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	MM_Heap *heap = env->getExtensions()->heap;
+	uintptr_t pageFlags = heap->getPageFlags();
+	bool transparentHuge = (0 != (OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE & pageFlags));
+	bool expectTransparentHuge = (0 == strcmp(node.attribute("transparentHuge").value(), "true"));
+
+	gcTestEnv->log("Heap page size 0x%zx, page flags 0x%zx\n", heap->getPageSize(), pageFlags);
+
+#if defined(LINUX)
+	if (expectTransparentHuge) {
+		/* the port library only advises transparent huge pages if the kernel does not have them set to [never] */
+		FILE *enabledFile = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+		char enabled[128];
+		if ((NULL == enabledFile) || (NULL == fgets(enabled, sizeof(enabled), enabledFile)) || (NULL != strstr(enabled, "[never]"))) {
+			gcTestEnv->log(LEVEL_ERROR, "SKIPPED: transparent huge pages are not enabled, not checking the heap page flags\n");
+			expectTransparentHuge = transparentHuge;
+		}
+		if (NULL != enabledFile) {
+			fclose(enabledFile);
+		}
+	}
+#else /* defined(LINUX) */
+	expectTransparentHuge = false;
+#endif /* defined(LINUX) */
+
+	if (transparentHuge != expectTransparentHuge) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected the heap %sto use transparent huge pages, page flags 0x%zx.\n", __FILE__, __LINE__, expectTransparentHuge ? "" : "not ", pageFlags);
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -950,6 +1188,20 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapCensus")) {
+			gcTestEnv->log("Invoking heap census...\n");
+			rt = heapCensus(node);
+			if (0 != rt) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform heap census.\n", __FILE__, __LINE__);
+				goto done;
+			}
+		} else if (0 == strcmp(node.name(), "heapPages")) {
+			gcTestEnv->log("Verifying heap pages...\n");
+			rt = verifyHeapPages(node);
+			if (0 != rt) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to verify heap pages.\n", __FILE__, __LINE__);
+				goto done;
+			}
 		}
 	}
 done:
@@ -988,12 +1240,98 @@ GCConfigTest::iniXMLStr(const char *configStyle)
 	return rt;
 }
 
+/**
+ * Append a line of JSON with this configuration's allocation throughput, pause times and heap footprint to the
+ * -benchmarkResults= file, so that runs can be compared across builds and machines.
+ */
+int32_t
+GCConfigTest::reportBenchmarkResults()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_Heap *heap = extensions->heap;
+	MM_PauseHistogram *pauses = extensions->getLatencyHistogram(GC_LATENCY_PAUSE);
+
+	const char *policy = doc.select_node("/gc-config/option").node().attribute("GCPolicy").value();
+	if (0 == strcmp(policy, "")) {
+		policy = "optavgpause";
+	}
+
+	uintptr_t heapSize = heap->getActiveMemorySize();
+	uintptr_t freeHeapSize = heap->getApproximateActiveFreeMemorySize();
+	peakHeapSize = OMR_MAX(peakHeapSize, heapSize);
+
+	/* bytes per microsecond is MB (10^6 bytes) per second */
+	double allocationRate = (0 == allocationMicros) ? 0.0 : ((double)allocatedBytes / (double)allocationMicros);
+
+	uint64_t pauseMicros[] = {
+		pauses->getMeanMicros(),
+		pauses->getPercentileMicros(50.0),
+		pauses->getPercentileMicros(90.0),
+		pauses->getPercentileMicros(99.0),
+		pauses->_maximumMicros,
+		pauses->_totalMicros
+	};
+
+	/* omrstr_printf() accepts a limited number of format specifiers per call, so build the line in pieces */
+	char result[1024];
+	uintptr_t length = omrstr_printf(result, sizeof(result),
+		"{\"config\":\"%s\",\"policy\":\"%s\",\"gcThreads\":%zu,"
+		"\"allocatedBytes\":%llu,\"allocationMs\":%llu.%03llu,\"allocationMBPerSecond\":%.2f,",
+		GetParam(), policy, extensions->dispatcher->threadCount(),
+		allocatedBytes, allocationMicros / 1000, allocationMicros % 1000, allocationRate);
+	length += omrstr_printf(result + length, sizeof(result) - length,
+		"\"pauses\":%zu,\"pauseMs\":{\"mean\":%llu.%03llu,\"p50\":%llu.%03llu,\"p90\":%llu.%03llu,",
+		pauses->_pauseCount,
+		pauseMicros[0] / 1000, pauseMicros[0] % 1000,
+		pauseMicros[1] / 1000, pauseMicros[1] % 1000,
+		pauseMicros[2] / 1000, pauseMicros[2] % 1000);
+	length += omrstr_printf(result + length, sizeof(result) - length,
+		"\"p99\":%llu.%03llu,\"max\":%llu.%03llu,\"total\":%llu.%03llu},"
+		"\"peakHeapBytes\":%zu,\"heapBytes\":%zu,\"freeHeapBytes\":%zu}\n",
+		pauseMicros[3] / 1000, pauseMicros[3] % 1000,
+		pauseMicros[4] / 1000, pauseMicros[4] % 1000,
+		pauseMicros[5] / 1000, pauseMicros[5] % 1000,
+		peakHeapSize, heapSize, freeHeapSize);
+
+	intptr_t fileDescriptor = omrfile_open(gcTestEnv->benchmarkResults, EsOpenWrite | EsOpenCreate | EsOpenAppend, 0644);
+	if (-1 == fileDescriptor) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to open benchmark results file %s.\n", __FILE__, __LINE__, gcTestEnv->benchmarkResults);
+		return 1;
+	}
+	intptr_t written = omrfile_write(fileDescriptor, result, length);
+	omrfile_close(fileDescriptor);
+	if (written != (intptr_t)length) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to write benchmark results file %s.\n", __FILE__, __LINE__, gcTestEnv->benchmarkResults);
+		return 1;
+	}
+
+	return 0;
+}
+
 TEST_P(GCConfigTest, test)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
 	int32_t rt = 0;
 
+#if !defined(OMR_GC_SEGREGATED_HEAP)
+	const char *gcPolicy = doc.select_node("/gc-config/option").node().attribute("GCPolicy").value();
+	if (0 == j9_cmdla_stricmp(gcPolicy, "segregated")) {
+		/* the collector has fallen back to the default policy, which the config was not written to check */
+		gcTestEnv->log(LEVEL_ERROR, "SKIPPED: %s requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n", GetParam());
+		return;
+	}
+#endif /* !defined(OMR_GC_SEGREGATED_HEAP) */
+#if !defined(OMR_GC_MODRON_COMPACTION)
+	const char *compactOnGlobalGC = doc.select_node("/gc-config/option").node().attribute("compactOnGlobalGC").value();
+	if (0 == j9_cmdla_stricmp(compactOnGlobalGC, "true")) {
+		/* without compaction the config's compact stanzas are never written */
+		gcTestEnv->log(LEVEL_ERROR, "SKIPPED: %s requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n", GetParam());
+		return;
+	}
+#endif /* !defined(OMR_GC_MODRON_COMPACTION) */
+
 	pugi::xml_node configNode = doc.select_node("/gc-config").node();
 	const char *configStyle = configNode.attribute("style").value();
 	ASSERT_EQ(0, iniXMLStr(configStyle)) << "Invalid XML input: unrecognized gc-config style \"" << configStyle << "\".";
@@ -1008,12 +1346,14 @@ TEST_P(GCConfigTest, test)
 			rt = parseGarbagePolicy(configChild.child(xs.garbagePolicy));
 			ASSERT_EQ(0, rt) << "Failed to parse garbage policy.";
 			pugi::xpath_node_set objects = configChild.select_nodes(xs.object);
-			int64_t startTime = omrtime_current_time_millis();
+			uint64_t startTime = omrtime_hires_clock();
 			for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
 				rt = allocationWalker(it->node());
 				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
 			}
-			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
+			uint64_t elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			allocationMicros += elapsedMicros;
+			gcTestEnv->log("Time elapsed in allocation: %llu ms\n", elapsedMicros / 1000);
 		} else if (0 == strcmp(configChild.name(), "verification")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++Verification++++++++++++++++++++++++++\n");
 			/* verboseGC verification */
@@ -1034,6 +1374,11 @@ TEST_P(GCConfigTest, test)
 			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in configuration file.";
 		}
 	}
+
+	if (NULL != gcTestEnv->benchmarkResults) {
+		rt = reportBenchmarkResults();
+		ASSERT_EQ(0, rt) << "Failed to write benchmark results.";
+	}
 }
 
 INSTANTIATE_TEST_CASE_P(configFile, GCConfigTest,
@@ -84,6 +84,11 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	/* benchmark measurements */
+	uint64_t allocatedBytes; /**< bytes allocated by the allocation stanzas */
+	uint64_t allocationMicros; /**< time spent in the allocation stanzas, including the collections they triggered */
+	uintptr_t peakHeapSize; /**< largest committed heap size seen after a collection */
+
 	/*
 	 * Function members
 	 */
@@ -104,9 +109,13 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseFile(pugi::xml_document *verboseDoc, const char *name);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
+	int32_t heapCensus(pugi::xml_node node);
+	int32_t verifyHeapPages(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t reportBenchmarkResults();
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -156,6 +165,9 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, allocatedBytes(0)
+		, allocationMicros(0)
+		, peakHeapSize(0)
 	{
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
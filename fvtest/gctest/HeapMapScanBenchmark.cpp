@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "gcTestHelpers.hpp"
+
+#include "HeapMapWordScanner.hpp"
+
+#define HEAP_MAP_SCAN_BENCHMARK_WORDS ((uintptr_t)1024 * 1024)
+#define HEAP_MAP_SCAN_BENCHMARK_PASSES 8
+
+/**
+ * Fill a synthetic mark map in which each word is non-empty with the given probability.
+ * Non-empty words are generated in runs, as objects allocated together tend to survive together.
+ */
+static void
+fillHeapMap(uintptr_t *heapMap, uintptr_t words, uintptr_t liveWordsPerThousand)
+{
+	uint32_t seed = 0x9E3779B9;
+	uintptr_t index = 0;
+	while (index < words) {
+		seed = (seed * 1103515245) + 12345;
+		uintptr_t runLength = 1 + ((seed >> 16) % 64);
+		seed = (seed * 1103515245) + 12345;
+		bool live = (((seed >> 16) % 1000) < liveWordsPerThousand);
+		for (uintptr_t i = 0; (i < runLength) && (index < words); i++, index++) {
+			heapMap[index] = live ? (((uintptr_t)1 << (index % (sizeof(uintptr_t) * 8))) | 1) : 0;
+		}
+	}
+}
+
+/**
+ * Walk the map as the sweep does, alternating between runs of empty words (free memory) and runs of non-empty words.
+ * @return the number of empty words found
+ */
+static uintptr_t
+sweepHeapMap(uintptr_t *heapMap, uintptr_t words)
+{
+	uintptr_t freeWords = 0;
+	uintptr_t *current = heapMap;
+	uintptr_t *top = heapMap + words;
+	while (current < top) {
+		uintptr_t *freeTop = MM_HeapMapWordScanner::findNonEmptyWord(current, top);
+		freeWords += freeTop - current;
+		current = MM_HeapMapWordScanner::findEmptyWord(freeTop, top);
+	}
+	return freeWords;
+}
+
+TEST(GCHeapMapScanTest, sweepThroughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const uintptr_t densities[] = {0, 10, 100, 500, 900, 990, 1000};
+	const MM_HeapMapWordScanner::ScanImplementation implementations[] = {
+		MM_HeapMapWordScanner::SCAN_SCALAR,
+		MM_HeapMapWordScanner::SCAN_SSE42,
+		MM_HeapMapWordScanner::SCAN_AVX2,
+	};
+	MM_HeapMapWordScanner::ScanImplementation selected = MM_HeapMapWordScanner::getImplementation();
+
+	uintptr_t *heapMap = (uintptr_t *)omrmem_allocate_memory(HEAP_MAP_SCAN_BENCHMARK_WORDS * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != heapMap);
+
+	omrtty_printf("%-8s %-8s %10s\n", "live", "scan", "GB/s");
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillHeapMap(heapMap, HEAP_MAP_SCAN_BENCHMARK_WORDS, densities[d]);
+
+		uintptr_t expectedFreeWords = 0;
+		for (uintptr_t i = 0; i < HEAP_MAP_SCAN_BENCHMARK_WORDS; i++) {
+			if (0 == heapMap[i]) {
+				expectedFreeWords += 1;
+			}
+		}
+
+		for (uintptr_t s = 0; s < sizeof(implementations) / sizeof(implementations[0]); s++) {
+			if (!MM_HeapMapWordScanner::setImplementation(implementations[s])) {
+				continue;
+			}
+
+			uint64_t start = omrtime_hires_clock();
+			for (uintptr_t pass = 0; pass < HEAP_MAP_SCAN_BENCHMARK_PASSES; pass++) {
+				EXPECT_EQ(expectedFreeWords, sweepHeapMap(heapMap, HEAP_MAP_SCAN_BENCHMARK_WORDS));
+			}
+			uint64_t elapsedMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+			double bytes = (double)(HEAP_MAP_SCAN_BENCHMARK_WORDS * sizeof(uintptr_t) * HEAP_MAP_SCAN_BENCHMARK_PASSES);
+			double gigabytesPerSecond = (0 == elapsedMicros) ? 0.0 : ((bytes / (double)elapsedMicros) / 1000.0);
+			omrtty_printf("%5.1f%%   %-8s %10.2f\n", (double)densities[d] / 10.0, MM_HeapMapWordScanner::getImplementationName(implementations[s]), gigabytesPerSecond);
+		}
+	}
+
+	MM_HeapMapWordScanner::setImplementation(selected);
+	omrmem_free_memory(heapMap);
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "gcTestHelpers.hpp"
+
+#include "LatencyStats.hpp"
+#include "PauseHistogram.hpp"
+
+#define PAUSE_HISTOGRAM_TEST_PAUSES 1000
+
+/**
+ * @return the pause time at the given percentile of the pauses (i * i) for i from 1 to PAUSE_HISTOGRAM_TEST_PAUSES,
+ * using the same rank as MM_PauseHistogram::getPercentileMicros()
+ */
+static uint64_t
+exactPercentile(double percentile)
+{
+	double exactRank = (percentile * PAUSE_HISTOGRAM_TEST_PAUSES) / 100.0;
+	uint64_t rank = (uint64_t)exactRank;
+	if (((double)rank < exactRank) || (0 == rank)) {
+		rank += 1;
+	}
+	return rank * rank;
+}
+
+TEST(GCPauseHistogramTest, bucketIndex)
+{
+	/* short pauses are counted exactly */
+	for (uint64_t micros = 0; micros < (2 * PAUSE_HISTOGRAM_SUB_BUCKETS); micros++) {
+		ASSERT_EQ((uintptr_t)micros, MM_PauseHistogram::getBucket(micros));
+		ASSERT_EQ(micros, MM_PauseHistogram::getBucketBase((uintptr_t)micros));
+		ASSERT_EQ(micros + 1, MM_PauseHistogram::getBucketLimit((uintptr_t)micros));
+	}
+
+	/* buckets are contiguous, and each is no wider than 1 / PAUSE_HISTOGRAM_SUB_BUCKETS of its base */
+	for (uintptr_t bucket = 0; bucket < (PAUSE_HISTOGRAM_BUCKETS - 1); bucket++) {
+		uint64_t base = MM_PauseHistogram::getBucketBase(bucket);
+		uint64_t limit = MM_PauseHistogram::getBucketLimit(bucket);
+		ASSERT_LT(base, limit) << "bucket " << bucket;
+		ASSERT_EQ(limit, MM_PauseHistogram::getBucketBase(bucket + 1)) << "bucket " << bucket;
+		ASSERT_EQ(bucket, MM_PauseHistogram::getBucket(base)) << "bucket " << bucket;
+		ASSERT_EQ(bucket, MM_PauseHistogram::getBucket(limit - 1)) << "bucket " << bucket;
+		if (bucket >= (2 * PAUSE_HISTOGRAM_SUB_BUCKETS)) {
+			ASSERT_LE((limit - base) * PAUSE_HISTOGRAM_SUB_BUCKETS, base) << "bucket " << bucket;
+		}
+	}
+
+	/* the last bucket counts every longer pause */
+	uintptr_t last = PAUSE_HISTOGRAM_BUCKETS - 1;
+	ASSERT_EQ(last, MM_PauseHistogram::getBucket(MM_PauseHistogram::getBucketBase(last)));
+	ASSERT_EQ(last, MM_PauseHistogram::getBucket((uint64_t)1 << PAUSE_HISTOGRAM_MAXIMUM_BITS));
+	ASSERT_EQ(last, MM_PauseHistogram::getBucket(((uint64_t)1 << PAUSE_HISTOGRAM_MAXIMUM_BITS) - 1));
+	ASSERT_EQ(last, MM_PauseHistogram::getBucket((uint64_t)-1));
+}
+
+TEST(GCPauseHistogramTest, percentiles)
+{
+	MM_PauseHistogram histogram;
+
+	/* nothing recorded */
+	ASSERT_EQ((uint64_t)0, histogram.getMeanMicros());
+	ASSERT_EQ((uint64_t)0, histogram.getPercentileMicros(50.0));
+
+	/* a single pause is every percentile, even though its bucket extends beyond it */
+	histogram.addPause(1000);
+	ASSERT_EQ((uint64_t)1000, histogram.getPercentileMicros(0.0));
+	ASSERT_EQ((uint64_t)1000, histogram.getPercentileMicros(50.0));
+	ASSERT_EQ((uint64_t)1000, histogram.getPercentileMicros(100.0));
+	histogram.clear();
+	ASSERT_EQ((uintptr_t)0, histogram._pauseCount);
+	ASSERT_EQ((uint64_t)0, histogram.getPercentileMicros(100.0));
+
+	uint64_t totalMicros = 0;
+	for (uint64_t i = PAUSE_HISTOGRAM_TEST_PAUSES; i > 0; i--) {
+		histogram.addPause(i * i);
+		totalMicros += i * i;
+	}
+	uint64_t maximumMicros = (uint64_t)PAUSE_HISTOGRAM_TEST_PAUSES * PAUSE_HISTOGRAM_TEST_PAUSES;
+	ASSERT_EQ((uintptr_t)PAUSE_HISTOGRAM_TEST_PAUSES, histogram._pauseCount);
+	ASSERT_EQ(totalMicros, histogram._totalMicros);
+	ASSERT_EQ(maximumMicros, histogram._maximumMicros);
+	ASSERT_EQ(totalMicros / PAUSE_HISTOGRAM_TEST_PAUSES, histogram.getMeanMicros());
+
+	/* each percentile is the top of the bucket holding the exact answer, so it overstates it by less than a bucket */
+	const double percentiles[] = {0.1, 1.0, 10.0, 25.0, 50.0, 90.0, 99.0, 99.9};
+	for (uintptr_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++) {
+		uint64_t exact = exactPercentile(percentiles[p]);
+		uint64_t reported = histogram.getPercentileMicros(percentiles[p]);
+		ASSERT_LE(exact, reported) << "p" << percentiles[p];
+		ASSERT_LE(reported, exact + (exact / PAUSE_HISTOGRAM_SUB_BUCKETS)) << "p" << percentiles[p];
+		ASSERT_LE(reported, maximumMicros) << "p" << percentiles[p];
+	}
+
+	/* the extremes, and percentiles outside 0 to 100, are clamped to the shortest and longest pauses */
+	ASSERT_EQ((uint64_t)1, histogram.getPercentileMicros(0.0));
+	ASSERT_EQ((uint64_t)1, histogram.getPercentileMicros(-5.0));
+	ASSERT_EQ(maximumMicros, histogram.getPercentileMicros(100.0));
+	ASSERT_EQ(maximumMicros, histogram.getPercentileMicros(150.0));
+}
+
+TEST(GCPauseHistogramTest, latencyTypes)
+{
+	MM_LatencyStats stats;
+
+	for (uintptr_t type = 0; type < GC_LATENCY_TYPE_COUNT; type++) {
+		ASSERT_TRUE(NULL != MM_LatencyStats::getTypeName((MM_GCLatencyType)type));
+		stats.record((MM_GCLatencyType)type, type + 1);
+	}
+	for (uintptr_t type = 0; type < GC_LATENCY_TYPE_COUNT; type++) {
+		MM_PauseHistogram *histogram = stats.getHistogram((MM_GCLatencyType)type);
+		ASSERT_EQ((uintptr_t)1, histogram->_pauseCount);
+		ASSERT_EQ((uint64_t)(type + 1), histogram->_maximumMicros);
+	}
+	stats.clear();
+	ASSERT_EQ((uintptr_t)0, stats.getHistogram(GC_LATENCY_PAUSE)->_pauseCount);
+}
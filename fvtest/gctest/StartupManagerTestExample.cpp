@@ -81,7 +81,12 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					if (0 == extensions->gcThreadCount) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: gcthreadCount must be at least 1: %s\n", attr.value());
+						result = false;
+					}
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -89,8 +94,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated or optavgpause): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -99,11 +110,112 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->compactOnGlobalGC = 1;
+					}
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactOnGlobalGC ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "parallelSlidingCompact")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->parallelSlidingCompact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: parallelSlidingCompact ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "cardCleaningMaxRunLength")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->cardCleaningMaxRunLength = atoi(attr.value());
+					if (0 == extensions->cardCleaningMaxRunLength) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: cardCleaningMaxRunLength must be at least 1: %s\n", attr.value());
+						result = false;
+					}
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: cardCleaningMaxRunLength ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBuffers")) {
+					extensions->asyncLoggingBufferCount = atoi(attr.value());
+					if (2 > extensions->asyncLoggingBufferCount) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: asyncLoggingBuffers must be at least 2: %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "asyncLoggingStallWhenFull")) {
+					extensions->asyncLoggingStallWhenFull = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verboseBinaryFormat")) {
+					extensions->verboseBinaryFormat = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapSizingGCTimeRatio")) {
+					extensions->heapSizingGCTimeRatio = atoi(attr.value());
+					if ((0 == extensions->heapSizingGCTimeRatio) || (100 <= extensions->heapSizingGCTimeRatio)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: heapSizingGCTimeRatio must be from 1 to 99: %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "heapSizingMaxPause")) {
+					extensions->heapSizingMaximumPause = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapSizingCeiling")) {
+					extensions->heapSizingCeiling = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadingMinimumWork")) {
+					extensions->adaptiveGCThreadingMinimumWork = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "parkingDispatcher")) {
+					extensions->parkingDispatcher = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "transparentHugePages")) {
+					extensions->useTransparentHugePages = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealingPackets")) {
+					extensions->workStealingPackets = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaAwarePacketLists")) {
+					extensions->numaAwarePacketLists = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulateNUMANodes")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "backgroundMarkMapClear")) {
+					extensions->backgroundMarkMapClear = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "sizeClassFreeListIndex")) {
+					extensions->sizeClassFreeListIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedConcurrentSweep")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					extensions->segregatedConcurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: segregatedConcurrentSweep ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "segregatedLockFreeRegionLists")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					extensions->segregatedLockFreeRegionLists = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: segregatedLockFreeRegionLists ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+					extensions->tlhAdaptiveRefreshInterval = atoi(attr.value());
+					if (0 == extensions->tlhAdaptiveRefreshInterval) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: tlhAdaptiveRefreshInterval must be at least 1: %s\n", attr.value());
+						result = false;
+					}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPrefetchDistance")) {
+					extensions->scavengerPrefetchDistance = atoi(attr.value());
+					if (MAXIMUM_SCAVENGER_PREFETCH_DISTANCE < extensions->scavengerPrefetchDistance) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: scavengerPrefetchDistance must not exceed %d: %s\n", MAXIMUM_SCAVENGER_PREFETCH_DISTANCE, attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldCopyOrder")) {
+					extensions->scavengerHotFieldCopyOrder = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldCopyDepth")) {
+					extensions->scavengerHotFieldCopyDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerCardMarking")) {
+					extensions->scavengerCardMarking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -111,6 +223,10 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					result = false;
 				}
 			}
+			if (extensions->verboseBinaryFormat && extensions->asyncLogging) {
+				gcTestEnv->log(LEVEL_ERROR, "Failed: verboseBinaryFormat and asyncLogging cannot be used together\n");
+				result = false;
+			}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
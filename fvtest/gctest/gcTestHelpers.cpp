@@ -60,6 +60,8 @@ GCTestEnvironment::initParams()
 			omrfile_close(fileDescriptor);
 		} else if (0 == strcmp(_argv[i], "-keepVerboseLog")) {
 			keepLog = true;
+		} else if (0 == strncmp(_argv[i], "-benchmarkResults=", strlen("-benchmarkResults="))) {
+			benchmarkResults = &_argv[i][strlen("-benchmarkResults=")];
 		}
 	}
 	if (params.empty()) {
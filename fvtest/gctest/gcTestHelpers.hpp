@@ -40,6 +40,7 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	const char *benchmarkResults; /**< file to append each configuration's benchmark results to, set by -benchmarkResults= */
 
 	/*
 	 * Function members
@@ -57,7 +58,7 @@ public:
 
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), benchmarkResults(NULL)
 	{
 	}
 };
@@ -80,6 +80,7 @@ omr_threadtest:
 	./omrthreadtest --gtest_also_run_disabled_tests --gtest_filter=ThreadCreateTest.DISABLED_SetAttrThreadWeight
 ifneq (,$(findstring linux,$(SPEC)))
 	./omrthreadtest --gtest_filter=ThreadCreateTest.*:$(GTEST_FILTER) -realtime
+	OMR_THREAD_FUTEX_MONITORS=1 ./omrthreadtest
 endif
 	@echo ALL $@ PASSED
 
@@ -28,6 +28,7 @@
  * @note port library virtual memory management operations are not optional in the port library table.
  *
  */
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -3720,6 +3721,159 @@ TEST(PortVmemTest, vmem_testGetProcessMemorySize)
 	EXPECT_TRUE(0 == size) << "value updated when query invalid";
 }
 
+/**
+ * Verify that OMRPORT_VMEM_ADVISE_HUGEPAGE reserves default pages, that transparent huge pages are
+ * reported on Linux whenever the kernel has them enabled, and that they are never reported elsewhere.
+ *
+ * @ref omrvmem.c
+ */
+TEST(PortVmemTest, vmem_testReserveMemoryExAdviseHugePage)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrvmem_testReserveMemoryExAdviseHugePage";
+	uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+	struct J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	char allocName[allocNameSize];
+	void *memPtr = NULL;
+	intptr_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = 4 * D2M;
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+	params.options = OMRPORT_VMEM_ADVISE_HUGEPAGE;
+
+	memPtr = omrvmem_reserve_memory_ex(&vmemID, &params);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve and commit 0x%zx bytes with OMRPORT_VMEM_ADVISE_HUGEPAGE\n", params.byteAmount);
+		goto exit;
+	}
+	portTestEnv->log("reserved 0x%zx bytes with page size 0x%zx and page flags 0x%zx at address %p\n",
+		params.byteAmount, vmemID.pageSize, vmemID.pageFlags, memPtr);
+
+	if (pageSizes[0] != omrvmem_get_page_size(&vmemID)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "expected page size 0x%zx, got 0x%zx\n", pageSizes[0], omrvmem_get_page_size(&vmemID));
+	}
+#if defined(LINUX)
+	{
+		/* the port library advises transparent huge pages unless the kernel has them set to [never] */
+		FILE *enabledFile = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+		char enabled[128];
+		if ((NULL == enabledFile) || (NULL == fgets(enabled, sizeof(enabled), enabledFile))) {
+			portTestEnv->log("transparent huge pages are not available, not checking OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE\n");
+		} else if (NULL != strstr(enabled, "[never]")) {
+			portTestEnv->log("transparent huge pages are disabled, not checking OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE\n");
+		} else if (0 == (OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE & vmemID.pageFlags)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE not reported with transparent huge pages enabled: %s", enabled);
+		}
+		if (NULL != enabledFile) {
+			fclose(enabledFile);
+		}
+	}
+#else /* defined(LINUX) */
+	if (0 != (OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE & vmemID.pageFlags)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE reported on a platform without transparent huge pages\n");
+	}
+#endif /* defined(LINUX) */
+
+	omrstr_printf(allocName, allocNameSize, "omrvmem_reserve_memory(%d)", params.byteAmount);
+	verifyMemory(OMRPORTLIB, testName, (char *)memPtr, params.byteAmount, allocName);
+
+	rc = omrvmem_decommit_memory(memPtr, params.byteAmount, &vmemID);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_decommit_memory returned 0x%zx when trying to decommit 0x%zx bytes\n", rc, params.byteAmount);
+	}
+
+	rc = omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory returned 0x%zx when trying to free 0x%zx bytes\n", rc, params.byteAmount);
+	}
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Reserve one page of each supported large page size, allowing a fallback to the default page size,
+ * and check that the identifier reports the page size that was actually used. With
+ * OMRPORT_VMEM_STRICT_PAGE_SIZE the reservation must either fail or use the requested page size.
+ *
+ * @ref omrvmem.c
+ */
+TEST(PortVmemTest, vmem_testReserveMemoryExLargePageSizes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrvmem_testReserveMemoryExLargePageSizes";
+	uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+	uintptr_t *pageFlags = omrvmem_supported_page_flags();
+	int32_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (0 == pageSizes[1]) {
+		portTestEnv->log(LEVEL_ERROR, "WARNING: No large page sizes are configured (on Linux, no hugetlb pool is reserved).\nSkipping test.\n");
+	}
+
+	for (i = 1; 0 != pageSizes[i]; i++) {
+		struct J9PortVmemIdentifier vmemID;
+		J9PortVmemParams params;
+		char allocName[allocNameSize];
+		void *memPtr = NULL;
+		intptr_t rc = 0;
+
+		omrvmem_vmem_params_init(&params);
+		params.byteAmount = pageSizes[i];
+		params.mode |= OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+		params.pageSize = pageSizes[i];
+		params.pageFlags = pageFlags[i];
+
+		memPtr = omrvmem_reserve_memory_ex(&vmemID, &params);
+		if (NULL == memPtr) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve and commit 0x%zx bytes with page size 0x%zx\n", params.byteAmount, pageSizes[i]);
+			continue;
+		}
+		portTestEnv->log("requested page size 0x%zx, got page size 0x%zx at address %p\n", pageSizes[i], vmemID.pageSize, memPtr);
+
+		if ((pageSizes[i] != omrvmem_get_page_size(&vmemID)) && (pageSizes[0] != omrvmem_get_page_size(&vmemID))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "requested page size 0x%zx, identifier reports 0x%zx\n", pageSizes[i], omrvmem_get_page_size(&vmemID));
+		}
+		if (0 != ((uintptr_t)memPtr % omrvmem_get_page_size(&vmemID))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "address %p is not aligned to page size 0x%zx\n", memPtr, omrvmem_get_page_size(&vmemID));
+		}
+
+		omrstr_printf(allocName, allocNameSize, "omrvmem_reserve_memory(%d)", params.byteAmount);
+		verifyMemory(OMRPORTLIB, testName, (char *)memPtr, params.byteAmount, allocName);
+
+		rc = omrvmem_decommit_memory(memPtr, params.byteAmount, &vmemID);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_decommit_memory returned 0x%zx when trying to decommit 0x%zx bytes\n", rc, params.byteAmount);
+		}
+
+		rc = omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory returned 0x%zx when trying to free 0x%zx bytes\n", rc, params.byteAmount);
+		}
+
+		params.options = OMRPORT_VMEM_STRICT_PAGE_SIZE;
+		memPtr = omrvmem_reserve_memory_ex(&vmemID, &params);
+		if (NULL == memPtr) {
+			portTestEnv->log("strict reservation with page size 0x%zx failed\n", pageSizes[i]);
+		} else {
+			if (pageSizes[i] != omrvmem_get_page_size(&vmemID)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "strict reservation with page size 0x%zx got page size 0x%zx\n", pageSizes[i], omrvmem_get_page_size(&vmemID));
+			}
+			rc = omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+			if (0 != rc) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory returned 0x%zx when trying to free 0x%zx bytes\n", rc, params.byteAmount);
+			}
+		}
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* This function is used by omrvmem_test_reserveExecutableMemory */
 int
 myFunction1()
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "testHelpers.hpp"
+
+#if defined(LINUX)
+
+/**
+ * Create a file below root holding contents, creating its parent directories as needed.
+ */
+static void
+createCgroupFile(OMRPortLibrary *portLibrary, const char *root, const char *fileName, const char *contents)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char path[EsMaxPath];
+	char *separator = NULL;
+	intptr_t fd = -1;
+
+	omrstr_printf(path, sizeof(path), "%s/%s", root, fileName);
+	for (separator = strchr(path, '/'); NULL != separator; separator = strchr(separator + 1, '/')) {
+		*separator = '\0';
+		omrfile_mkdir(path);
+		*separator = '/';
+	}
+
+	fd = omrfile_open(path, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd) << "could not create " << path;
+	omrfile_write(fd, contents, strlen(contents));
+	omrfile_close(fd);
+}
+
+/**
+ * A version 1 hierarchy with the controllers on separate mounts, one of which exposes the whole
+ * hierarchy so that a tighter memory limit on an ancestor group applies.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_v1)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	char root[] = "si_cgroupTest_v1";
+	J9SysinfoCgroupLimits limits;
+
+	deleteControlDirectory(OMRPORTLIB, root);
+	createCgroupFile(OMRPORTLIB, root, "proc/self/cgroup",
+		"12:memory:/docker/abc\n"
+		"11:cpu,cpuacct:/docker/abc\n"
+		"10:cpuset:/docker/abc\n"
+		"1:name=systemd:/docker/abc\n");
+	createCgroupFile(OMRPORTLIB, root, "proc/self/mountinfo",
+		"25 0 253:1 / / rw,relatime - ext4 /dev/vda1 rw\n"
+		"30 25 0:26 /docker/abc /sys/fs/cgroup/cpu,cpuacct rw,nosuid shared:9 - cgroup cgroup rw,cpu,cpuacct\n"
+		"31 25 0:27 /docker/abc /sys/fs/cgroup/cpuset rw,nosuid - cgroup cgroup rw,cpuset\n"
+		"32 25 0:28 / /sys/fs/cgroup/memory rw,nosuid - cgroup cgroup rw,memory\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/cpu,cpuacct/cpu.cfs_quota_us", "150000\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/cpu,cpuacct/cpu.cfs_period_us", "100000\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/cpu,cpuacct/cpu.shares", "2048\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/cpuset/cpuset.cpus", "0-3,6\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/memory/memory.limit_in_bytes", "9223372036854771712\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/memory/docker/memory.limit_in_bytes", "268435456\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/memory/docker/abc/memory.limit_in_bytes", "9223372036854771712\n");
+
+	ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, (uintptr_t)root));
+	EXPECT_EQ(0, omrsysinfo_get_cgroup_limits(&limits));
+	EXPECT_EQ((uint32_t)1, limits.version);
+	EXPECT_EQ((uint64_t)150000, limits.cpuQuota);
+	EXPECT_EQ((uint64_t)100000, limits.cpuPeriod);
+	EXPECT_EQ((uint64_t)2048, limits.cpuShares);
+	EXPECT_EQ((uint64_t)5, limits.cpusetCount);
+	EXPECT_EQ((uint64_t)2, limits.cpuLimit);
+	EXPECT_EQ((uint64_t)268435456, limits.memoryLimit);
+	EXPECT_GE((uintptr_t)2, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET));
+
+	ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, 0));
+	deleteControlDirectory(OMRPORTLIB, root);
+}
+
+/**
+ * A version 2 hierarchy where the CPU quota is set on the pod rather than the container.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_v2)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	char root[] = "si_cgroupTest_v2";
+	J9SysinfoCgroupLimits limits;
+
+	deleteControlDirectory(OMRPORTLIB, root);
+	createCgroupFile(OMRPORTLIB, root, "proc/self/cgroup", "0::/kubepods/pod1/ctr\n");
+	createCgroupFile(OMRPORTLIB, root, "proc/self/mountinfo",
+		"25 0 253:1 / / rw,relatime - ext4 /dev/vda1 rw\n"
+		"35 25 0:30 / /sys/fs/cgroup rw,nosuid,nodev - cgroup2 cgroup2 rw,nsdelegate\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/kubepods/pod1/cpu.max", "400000 100000\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/kubepods/pod1/memory.max", "8589934592\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/kubepods/pod1/ctr/cpu.max", "max 100000\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/kubepods/pod1/ctr/cpu.weight", "79\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/kubepods/pod1/ctr/cpuset.cpus.effective", "0-7\n");
+	createCgroupFile(OMRPORTLIB, root, "sys/fs/cgroup/kubepods/pod1/ctr/memory.max", "max\n");
+
+	ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, (uintptr_t)root));
+	EXPECT_EQ(0, omrsysinfo_get_cgroup_limits(&limits));
+	EXPECT_EQ((uint32_t)2, limits.version);
+	EXPECT_EQ((uint64_t)400000, limits.cpuQuota);
+	EXPECT_EQ((uint64_t)100000, limits.cpuPeriod);
+	EXPECT_EQ((uint64_t)79, limits.cpuShares);
+	EXPECT_EQ((uint64_t)8, limits.cpusetCount);
+	EXPECT_EQ((uint64_t)4, limits.cpuLimit);
+	EXPECT_EQ((uint64_t)8589934592ULL, limits.memoryLimit);
+	EXPECT_GE((uintptr_t)4, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET));
+
+	ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, 0));
+	deleteControlDirectory(OMRPORTLIB, root);
+}
+
+/**
+ * Without cgroup files nothing is limited.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_none)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	char root[] = "si_cgroupTest_none";
+	J9SysinfoCgroupLimits limits;
+
+	deleteControlDirectory(OMRPORTLIB, root);
+	omrfile_mkdir(root);
+
+	ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, (uintptr_t)root));
+	EXPECT_EQ(0, omrsysinfo_get_cgroup_limits(&limits));
+	EXPECT_EQ((uint32_t)0, limits.version);
+	EXPECT_EQ(OMRPORT_CGROUP_NOT_LIMITED, limits.cpuQuota);
+	EXPECT_EQ(OMRPORT_CGROUP_NOT_LIMITED, limits.cpusetCount);
+	EXPECT_EQ(OMRPORT_CGROUP_NOT_LIMITED, limits.cpuLimit);
+	EXPECT_EQ(OMRPORT_CGROUP_NOT_LIMITED, limits.memoryLimit);
+
+	ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, 0));
+	deleteControlDirectory(OMRPORTLIB, root);
+}
+
+#endif /* defined(LINUX) */
+
+/**
+ * The limits of the real cgroup, if any, are consistent.
+ */
+TEST(PortSysinfoTest, sysinfo_cgroup_current)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	J9SysinfoCgroupLimits limits;
+	int32_t rc = omrsysinfo_get_cgroup_limits(&limits);
+
+	if (OMRPORT_ERROR_SYSINFO_NOT_SUPPORTED == rc) {
+		portTestEnv->log("omrsysinfo_get_cgroup_limits is not supported on this platform\n");
+		return;
+	}
+	ASSERT_EQ(0, rc);
+	portTestEnv->log("cgroup version=%u cpuLimit=%llu memoryLimit=%llu\n",
+		limits.version, (unsigned long long)limits.cpuLimit, (unsigned long long)limits.memoryLimit);
+	EXPECT_NE((uint64_t)0, limits.cpuLimit);
+	EXPECT_NE((uint64_t)0, limits.memoryLimit);
+	if (OMRPORT_CGROUP_NOT_LIMITED != limits.cpuLimit) {
+		EXPECT_GE((uintptr_t)limits.cpuLimit, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET));
+	}
+}
@@ -137,12 +137,49 @@ CMonitor::~CMonitor(void)
  * These functions inspect the internal state of the monitor.
  * They are extremely unsafe unless the test program is careful.
  */
+
+#if defined(LINUX)
+/*
+ * Threads blocked on a futex monitor are not queued on the monitor,
+ * so they are found by their blocked state instead.
+ */
+static bool
+isFutexMonitorLib(void)
+{
+	return J9_ARE_ALL_BITS_SET(omrthread_self()->library->flags, J9THREAD_LIB_FLAG_FUTEX_MONITORS);
+}
+
+static bool
+isBlockedOnFutex(omrthread_t thread, omrthread_monitor_t monitor)
+{
+	return (thread->monitor == monitor) && J9_ARE_ALL_BITS_SET(thread->flags, J9THREAD_FLAG_BLOCKED);
+}
+#endif /* defined(LINUX) */
+
 unsigned int
 CMonitor::numBlocking(void)
 {
 	J9ThreadMonitor *mon = (J9ThreadMonitor *) m_monitor;
 	unsigned int count = 0;
 
+#if defined(LINUX)
+	if (isFutexMonitorLib()) {
+		omrthread_t self = omrthread_self();
+		pool_state state;
+
+		omrthread_lib_lock(self);
+		omrthread_t walkThread = (omrthread_t)pool_startDo(self->library->thread_pool, &state);
+		while (NULL != walkThread) {
+			if (isBlockedOnFutex(walkThread, m_monitor)) {
+				++count;
+			}
+			walkThread = (omrthread_t)pool_nextDo(&state);
+		}
+		omrthread_lib_unlock(self);
+		return count;
+	}
+#endif /* defined(LINUX) */
+
 	MONITOR_LOCK(m_monitor, 0);
 	omrthread_t q = mon->blocking;
 	while (q) {
@@ -160,6 +197,12 @@ CMonitor::isThreadBlocking(CThread& thread)
 	const omrthread_t jthread = thread.getThread();
 	J9ThreadMonitor *mon = (J9ThreadMonitor *) m_monitor;
 
+#if defined(LINUX)
+	if (isFutexMonitorLib()) {
+		return isBlockedOnFutex(jthread, m_monitor);
+	}
+#endif /* defined(LINUX) */
+
 	MONITOR_LOCK(m_monitor, 0);
 	omrthread_t q = mon->blocking;
 	while (q) {
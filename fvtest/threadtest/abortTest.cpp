@@ -32,6 +32,8 @@ static void abortNull();
 static int runningMain(void *arg);
 static int sleepingMain(void *arg);
 static int waitingMain(void *arg);
+static int blockedMain(void *arg);
+static int blockedNotAbortableMain(void *arg);
 
 typedef int (*functionPoint)(void *);
 
@@ -253,4 +255,163 @@ waitingMain(void *arg)
 	return 0;
 }
 
+typedef struct block_testdata_t {
+	omrthread_monitor_t exitSync;
+	omrthread_monitor_t blockSync;
+	volatile intptr_t rc;
+} block_testdata_t;
+
+TEST(ThreadAbortTest, Blocked)
+{
+	omrthread_t t;
+	block_testdata_t testdata;
+
+	omrthread_monitor_init(&testdata.exitSync, 0);
+	omrthread_monitor_init(&testdata.blockSync, 0);
+	testdata.rc = 0;
+
+	omrthread_monitor_enter(testdata.exitSync);
+	omrthread_monitor_enter(testdata.blockSync);
+
+	createDefaultThread(&t, blockedMain, &testdata);
+
+	/* wait for blockedMain to give up spinning and block on the monitor */
+	J9AbstractThread *blocked = (J9AbstractThread *)t;
+	clock_t elapsedTime = 0;
+	clock_t start = clock() * 1000 / CLOCKS_PER_SEC;
+	while ((!(blocked->flags & J9THREAD_FLAG_BLOCKED)) && (elapsedTime < TIMEOUT)) {
+		omrthread_sleep(10);
+		elapsedTime = clock() * 1000 / CLOCKS_PER_SEC - start;
+	}
+	ASSERT_TRUE(0 != (blocked->flags & J9THREAD_FLAG_BLOCKED)) << "Thread never blocked on the monitor";
+
+	omrthread_abort(t);
+
+	omrthread_monitor_wait(testdata.exitSync);
+	omrthread_monitor_exit(testdata.exitSync);
+
+	{
+		J9ThreadAbstractMonitor *mon = (J9ThreadAbstractMonitor *)testdata.blockSync;
+		assert(mon->blocking == NULL);
+		assert(mon->count == 1);
+		assert(mon->owner == (J9Thread *)omrthread_self());
+	}
+
+	omrthread_monitor_exit(testdata.blockSync);
+
+	/* the monitor must still be usable after the aborted enter */
+	EXPECT_EQ(0, omrthread_monitor_enter(testdata.blockSync));
+	omrthread_monitor_exit(testdata.blockSync);
+
+	omrthread_monitor_destroy(testdata.exitSync);
+	omrthread_monitor_destroy(testdata.blockSync);
+
+	EXPECT_TRUE(testdata.rc == J9THREAD_INTERRUPTED_MONITOR_ENTER) << "Failed to abort blocked thread!";
+}
+
+static int
+blockedMain(void *arg)
+{
+	block_testdata_t *testdata = (block_testdata_t *)arg;
+	omrthread_t self = omrthread_self();
+
+	testdata->rc = omrthread_monitor_enter_abortable_using_threadId(testdata->blockSync, self);
+
+	if (J9THREAD_INTERRUPTED_MONITOR_ENTER == testdata->rc) {
+		J9AbstractThread *abstractSelf = (J9AbstractThread *)self;
+
+		assert(!(abstractSelf->flags & J9THREAD_FLAG_BLOCKED));
+		assert(abstractSelf->monitor == NULL);
+	} else {
+		omrthread_monitor_exit(testdata->blockSync);
+	}
+
+	omrthread_monitor_enter(testdata->exitSync);
+	omrthread_monitor_notify(testdata->exitSync);
+	omrthread_monitor_exit(testdata->exitSync);
+
+	return 0;
+}
+
+typedef struct block_not_abortable_testdata_t {
+	omrthread_monitor_t blockSync;
+	volatile bool done;
+	volatile bool owned;
+	volatile intptr_t rc;
+} block_not_abortable_testdata_t;
+
+/*
+ * A plain enter that blocks on a futex monitor keeps the monitor when the thread is aborted.
+ * Otherwise an abort found after the monitor is acquired releases it and interrupts the enter.
+ */
+TEST(ThreadAbortTest, BlockedNotAbortable)
+{
+	omrthread_t t;
+	block_not_abortable_testdata_t testdata;
+	bool futexMonitors = J9_ARE_ALL_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_FUTEX_MONITORS);
+
+	omrthread_monitor_init(&testdata.blockSync, 0);
+	testdata.done = false;
+	testdata.owned = false;
+	testdata.rc = -1;
+
+	omrthread_monitor_enter(testdata.blockSync);
+
+	createDefaultThread(&t, blockedNotAbortableMain, &testdata);
+
+	/* wait for blockedNotAbortableMain to give up spinning and block on the monitor */
+	J9AbstractThread *blocked = (J9AbstractThread *)t;
+	clock_t elapsedTime = 0;
+	clock_t start = clock() * 1000 / CLOCKS_PER_SEC;
+	while ((!(blocked->flags & J9THREAD_FLAG_BLOCKED)) && (elapsedTime < TIMEOUT)) {
+		omrthread_sleep(10);
+		elapsedTime = clock() * 1000 / CLOCKS_PER_SEC - start;
+	}
+	ASSERT_TRUE(0 != (blocked->flags & J9THREAD_FLAG_BLOCKED)) << "Thread never blocked on the monitor";
+
+	omrthread_abort(t);
+	omrthread_monitor_exit(testdata.blockSync);
+
+	/* the aborted thread can't be relied on to enter another monitor, so poll for it to finish */
+	start = clock() * 1000 / CLOCKS_PER_SEC;
+	elapsedTime = 0;
+	while ((!testdata.done) && (elapsedTime < TIMEOUT)) {
+		omrthread_sleep(10);
+		elapsedTime = clock() * 1000 / CLOCKS_PER_SEC - start;
+	}
+	ASSERT_TRUE(testdata.done) << "Blocked thread never returned from the enter";
+
+	if (futexMonitors) {
+		EXPECT_EQ(0, testdata.rc) << "Plain enter on a futex monitor was interrupted by abort";
+		EXPECT_TRUE(testdata.owned) << "Plain enter on a futex monitor returned without the monitor";
+	} else {
+		EXPECT_EQ(J9THREAD_INTERRUPTED_MONITOR_ENTER, testdata.rc) << "Abort after acquiring the monitor was not reported";
+		EXPECT_FALSE(testdata.owned) << "Interrupted enter kept the monitor";
+	}
+
+	/* the monitor must be free again */
+	EXPECT_EQ(0, omrthread_monitor_enter(testdata.blockSync));
+	omrthread_monitor_exit(testdata.blockSync);
+
+	omrthread_monitor_destroy(testdata.blockSync);
+}
+
+static int
+blockedNotAbortableMain(void *arg)
+{
+	block_not_abortable_testdata_t *testdata = (block_not_abortable_testdata_t *)arg;
+	J9ThreadAbstractMonitor *mon = (J9ThreadAbstractMonitor *)testdata->blockSync;
+	omrthread_t self = omrthread_self();
+
+	testdata->rc = omrthread_monitor_enter(testdata->blockSync);
+	testdata->owned = (mon->owner == (J9Thread *)self);
+	if (testdata->owned) {
+		omrthread_monitor_exit(testdata->blockSync);
+	}
+
+	testdata->done = true;
+
+	return 0;
+}
+
 #endif /* OMR_THR_THREE_TIER_LOCKING */
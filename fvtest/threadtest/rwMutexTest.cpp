@@ -88,10 +88,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param flags the flags used to create the rwmutex
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t flags = 0)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -100,7 +101,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, flags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -1133,3 +1134,251 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * validates the following for a read-biased rwmutex
+ *
+ * readers do not exclude each other
+ */
+TEST(RWMutex, ReadBiasedMultipleReadersTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_FLAG_READ_BIASED);
+	startConcurrentThread(info);
+
+	ASSERT_TRUE(1 == info->readCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+	ASSERT_TRUE(1 == info->readCounter);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(info->handle));
+	omrthread_rwmutex_exit_read(info->handle);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a read-biased rwmutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ */
+TEST(RWMutex, ReadBiasedReadersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_FLAG_READ_BIASED);
+
+	omrthread_rwmutex_enter_write(info->handle);
+	ASSERT_TRUE(TRUE == omrthread_rwmutex_is_writelocked(info->handle));
+
+	/* a writer may enter for read */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a read-biased rwmutex
+ *
+ * writer is excluded while another thread holds the rwmutex for read
+ * once reader exits writer can enter
+ */
+TEST(RWMutex, ReadBiasedWritersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_FLAG_READ_BIASED);
+
+	omrthread_rwmutex_enter_read(info->handle);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a read-biased rwmutex
+ *
+ * try_enter_write does not block while another thread holds the rwmutex for read,
+ * and does not keep readers out after it fails
+ */
+TEST(RWMutex, ReadBiasedWritersExcludedNonBlockTest)
+{
+	intptr_t result = 0;
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_FLAG_READ_BIASED);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == result);
+
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_OK == result);
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_OK == result);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_rwmutex_exit_write(info->handle);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(info->handle));
+	freeSupportThreadInfo(info);
+}
+
+/* state shared by the threads of the read scaling benchmark */
+typedef struct ReadScalingInfo {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t running;
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+	volatile uintptr_t reads;
+} ReadScalingInfo;
+
+/**
+ * Enter and exit the rwmutex for read until asked to stop, then add the
+ * number of acquisitions to the total.
+ * @param info the ReadScalingInfo shared by the benchmark threads
+ */
+static intptr_t J9THREAD_PROC
+readScalingLoop(ReadScalingInfo *info)
+{
+	uintptr_t reads = 0;
+
+	omrthread_monitor_enter(info->synchronization);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	while (0 == info->running) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	while (0 != info->running) {
+		omrthread_rwmutex_enter_read(info->handle);
+		omrthread_rwmutex_exit_read(info->handle);
+		reads += 1;
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->reads += reads;
+	info->finished += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+	return 0;
+}
+
+/**
+ * Measure read acquisitions per second with numThreads readers.
+ * @param flags the flags used to create the rwmutex
+ * @param numThreads the number of reading threads
+ * @param runMillis how long the readers run for
+ * @returns read acquisitions per second
+ */
+static uint64_t
+measureReadScaling(uintptr_t flags, uintptr_t numThreads, int64_t runMillis)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	ReadScalingInfo info;
+	uintptr_t i = 0;
+	int64_t start = 0;
+	int64_t elapsed = 0;
+
+	info.running = 0;
+	info.started = 0;
+	info.finished = 0;
+	info.reads = 0;
+	omrthread_rwmutex_init(&info.handle, flags, "read scaling rwmutex");
+	omrthread_monitor_init_with_name(&info.synchronization, 0, "read scaling monitor");
+
+	for (i = 0; i < numThreads; i++) {
+		omrthread_t thread = NULL;
+		omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t)readScalingLoop, &info);
+	}
+
+	omrthread_monitor_enter(info.synchronization);
+	while (info.started < numThreads) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	start = omrtime_current_time_millis();
+	info.running = 1;
+	omrthread_monitor_notify_all(info.synchronization);
+	omrthread_monitor_exit(info.synchronization);
+
+	omrthread_sleep(runMillis);
+
+	omrthread_monitor_enter(info.synchronization);
+	info.running = 0;
+	elapsed = omrtime_current_time_millis() - start;
+	while (info.finished < numThreads) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	omrthread_monitor_exit(info.synchronization);
+
+	omrthread_monitor_destroy(info.synchronization);
+	omrthread_rwmutex_destroy(info.handle);
+
+	if (elapsed <= 0) {
+		elapsed = 1;
+	}
+	return ((uint64_t)info.reads * 1000) / (uint64_t)elapsed;
+}
+
+/**
+ * Report read acquisitions per second for the default and read-biased rwmutex
+ * from one reader up to one reader per online CPU.
+ */
+TEST(RWMutex, ReadScalingBenchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uintptr_t maxThreads = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+	uintptr_t numThreads = 0;
+
+	if (0 == maxThreads) {
+		maxThreads = 1;
+	}
+	for (numThreads = 1; numThreads <= maxThreads; numThreads++) {
+		uint64_t defaultReads = measureReadScaling(0, numThreads, 200);
+		uint64_t biasedReads = measureReadScaling(J9THREAD_RWMUTEX_FLAG_READ_BIASED, numThreads, 200);
+		omrTestEnv->log("rwmutex read scaling: threads=%zu default=%llu/s readBiased=%llu/s\n",
+			numThreads, (unsigned long long)defaultReads, (unsigned long long)biasedReads);
+		ASSERT_TRUE(0 != defaultReads);
+		ASSERT_TRUE(0 != biasedReads);
+	}
+}
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+extern ThreadTestEnvironment *omrTestEnv;
+
+/* a flat batch of tasks which each bump a shared counter */
+typedef struct CounterTaskInfo {
+	volatile uintptr_t count;
+} CounterTaskInfo;
+
+static void
+counterTask(void *userData)
+{
+	CounterTaskInfo *info = (CounterTaskInfo *)userData;
+	addAtomic(&info->count, 1);
+}
+
+/* a tree of tasks: each task splits its range in two until it is one element long */
+typedef struct TreeTaskInfo {
+	omrthread_pool_t pool;
+	uintptr_t low;
+	uintptr_t high;
+	uintptr_t sum;
+} TreeTaskInfo;
+
+static void
+treeTask(void *userData)
+{
+	TreeTaskInfo *info = (TreeTaskInfo *)userData;
+
+	if (1 == (info->high - info->low)) {
+		info->sum = info->low;
+	} else {
+		uintptr_t middle = info->low + ((info->high - info->low) / 2);
+		TreeTaskInfo left = { info->pool, info->low, middle, 0 };
+		TreeTaskInfo right = { info->pool, middle, info->high, 0 };
+		J9ThreadPoolJoin join;
+
+		omrthread_pool_join_init(&join);
+		omrthread_pool_submit(info->pool, treeTask, &left, &join);
+		treeTask(&right);
+		omrthread_pool_join(info->pool, &join);
+		info->sum = left.sum + right.sum;
+	}
+}
+
+/* a task which holds its worker until released */
+typedef struct BlockingTaskInfo {
+	omrthread_monitor_t monitor;
+	uintptr_t running;
+	BOOLEAN release;
+} BlockingTaskInfo;
+
+static void
+blockingTask(void *userData)
+{
+	BlockingTaskInfo *info = (BlockingTaskInfo *)userData;
+
+	omrthread_monitor_enter(info->monitor);
+	info->running += 1;
+	omrthread_monitor_notify_all(info->monitor);
+	while (!info->release) {
+		omrthread_monitor_wait(info->monitor);
+	}
+	omrthread_monitor_exit(info->monitor);
+}
+
+static void
+squareTask(void *userData)
+{
+	uintptr_t *value = (uintptr_t *)userData;
+	*value = *value * *value;
+}
+
+/**
+ * Tasks submitted from a thread outside the pool all run before join returns.
+ */
+TEST(ThreadPoolTest, SubmitAndJoin)
+{
+	omrthread_pool_t pool = NULL;
+	CounterTaskInfo info;
+	J9ThreadPoolJoin join;
+	J9ThreadPoolStats stats;
+	uintptr_t i = 0;
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, "pool test", 2, 2, 0));
+
+	info.count = 0;
+	omrthread_pool_join_init(&join);
+	for (i = 0; i < 1000; i++) {
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(pool, counterTask, &info, &join));
+	}
+	omrthread_pool_join(pool, &join);
+	ASSERT_EQ((uintptr_t)1000, info.count);
+
+	omrthread_pool_get_stats(pool, &stats);
+	ASSERT_EQ((uint64_t)1000, stats.tasksExecuted);
+	ASSERT_EQ((uintptr_t)2, stats.workerCount);
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_destroy(pool));
+}
+
+/**
+ * A single task with its own join counter serves as a future.
+ */
+TEST(ThreadPoolTest, Future)
+{
+	omrthread_pool_t pool = NULL;
+	J9ThreadPoolJoin future;
+	uintptr_t value = 12;
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, "pool test", 1, 1, 0));
+	omrthread_pool_join_init(&future);
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(pool, squareTask, &value, &future));
+	omrthread_pool_join(pool, &future);
+	ASSERT_EQ((uintptr_t)144, value);
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_destroy(pool));
+}
+
+/**
+ * Tasks which submit and join subtasks complete, with the subtasks spread by stealing.
+ */
+TEST(ThreadPoolTest, NestedForkJoin)
+{
+	omrthread_pool_t pool = NULL;
+	TreeTaskInfo root;
+	J9ThreadPoolJoin join;
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, "pool test", 4, 4, 0));
+	root.pool = pool;
+	root.low = 0;
+	root.high = 10000;
+	root.sum = 0;
+	omrthread_pool_join_init(&join);
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(pool, treeTask, &root, &join));
+	omrthread_pool_join(pool, &join);
+	ASSERT_EQ((uintptr_t)(10000 * 9999 / 2), root.sum);
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_destroy(pool));
+}
+
+/**
+ * An elastic pool starts workers while its workers are busy and retires them once idle.
+ */
+TEST(ThreadPoolTest, Elastic)
+{
+	omrthread_pool_t pool = NULL;
+	BlockingTaskInfo info;
+	J9ThreadPoolJoin join;
+	J9ThreadPoolStats stats;
+	uintptr_t i = 0;
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, "pool test", 1, 3, 10));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.monitor, 0, "pool test monitor"));
+	info.running = 0;
+	info.release = FALSE;
+
+	omrthread_pool_join_init(&join);
+	for (i = 0; i < 3; i++) {
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(pool, blockingTask, &info, &join));
+	}
+
+	omrthread_monitor_enter(info.monitor);
+	while (3 != info.running) {
+		omrthread_monitor_wait(info.monitor);
+	}
+	info.release = TRUE;
+	omrthread_monitor_notify_all(info.monitor);
+	omrthread_monitor_exit(info.monitor);
+	omrthread_pool_join(pool, &join);
+
+	omrthread_pool_get_stats(pool, &stats);
+	ASSERT_EQ((uintptr_t)3, stats.peakWorkerCount);
+
+	for (i = 0; i < 500; i++) {
+		omrthread_pool_get_stats(pool, &stats);
+		if (1 == stats.workerCount) {
+			break;
+		}
+		omrthread_sleep(10);
+	}
+	ASSERT_EQ((uintptr_t)1, stats.workerCount);
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_destroy(pool));
+	omrthread_monitor_destroy(info.monitor);
+}
+
+/**
+ * Workers can be bound to the available NUMA nodes and the binding cleared again.
+ */
+TEST(ThreadPoolTest, NumaAffinity)
+{
+	omrthread_pool_t pool = NULL;
+	CounterTaskInfo info;
+	J9ThreadPoolJoin join;
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, "pool test", 2, 2, 0));
+	if (0 != omrthread_numa_get_max_node()) {
+		uintptr_t node = 1;
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_set_numa_affinity(pool, &node, 1));
+	}
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_set_numa_affinity(pool, NULL, 0));
+
+	info.count = 0;
+	omrthread_pool_join_init(&join);
+	omrthread_pool_submit(pool, counterTask, &info, &join);
+	omrthread_pool_join(pool, &join);
+	ASSERT_EQ((uintptr_t)1, info.count);
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_destroy(pool));
+}
+
+/**
+ * Report fine-grained task throughput from one worker up to one worker per online CPU.
+ */
+TEST(ThreadPoolTest, FineGrainedThroughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uintptr_t maxWorkers = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE);
+	uintptr_t numWorkers = 0;
+	const uintptr_t numTasks = 100000;
+
+	if (0 == maxWorkers) {
+		maxWorkers = 1;
+	}
+	for (numWorkers = 1; numWorkers <= maxWorkers; numWorkers++) {
+		omrthread_pool_t pool = NULL;
+		TreeTaskInfo root;
+		J9ThreadPoolJoin join;
+		J9ThreadPoolStats stats;
+		uint64_t start = 0;
+		uint64_t elapsed = 0;
+
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, "pool test", numWorkers, numWorkers, 0));
+		root.pool = pool;
+		root.low = 0;
+		root.high = numTasks;
+		root.sum = 0;
+
+		start = omrtime_hires_clock();
+		omrthread_pool_join_init(&join);
+		omrthread_pool_submit(pool, treeTask, &root, &join);
+		omrthread_pool_join(pool, &join);
+		elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		ASSERT_EQ((uintptr_t)(numTasks * (numTasks - 1) / 2), root.sum);
+
+		omrthread_pool_get_stats(pool, &stats);
+		if (0 == elapsed) {
+			elapsed = 1;
+		}
+		omrTestEnv->log("thread pool throughput: workers=%zu tasks=%llu tasks/s=%llu steals=%llu\n",
+			numWorkers, (unsigned long long)stats.tasksExecuted,
+			(unsigned long long)((stats.tasksExecuted * 1000000) / elapsed), (unsigned long long)stats.steals);
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_destroy(pool));
+	}
+}
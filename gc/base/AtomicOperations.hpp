@@ -53,6 +53,16 @@ public:
 		VM_AtomicSupport::nop();
 	}
 
+	/**
+	 * If the CPU supports it, emit a hint to bring the cache line containing address into the data cache.
+	 * @param address the address to prefetch (need not be valid)
+	 */
+	MMINLINE_DEBUG static void
+	prefetch(const void *address)
+	{
+		VM_AtomicSupport::prefetch(address);
+	}
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
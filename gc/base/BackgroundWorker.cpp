@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "omrutil.h"
+
+#include "BackgroundWorker.hpp"
+
+#include "CollectorLanguageInterfaceImpl.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+void
+MM_BackgroundWorker::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_BackgroundWorker::initialize(MM_EnvironmentBase *env)
+{
+	return (0 == omrthread_monitor_init_with_name(&_workerMonitor, 0, "MM_BackgroundWorker::_workerMonitor"));
+}
+
+void
+MM_BackgroundWorker::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _workerMonitor) {
+		omrthread_monitor_destroy(_workerMonitor);
+		_workerMonitor = NULL;
+	}
+}
+
+int J9THREAD_PROC
+MM_BackgroundWorker::worker_thread_proc(void *info)
+{
+	MM_BackgroundWorker *worker = (MM_BackgroundWorker *)info;
+	worker->workerThreadEntryPoint();
+	return 0;
+}
+
+bool
+MM_BackgroundWorker::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_workerMonitor);
+	_workerThreadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		worker_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _workerThreadState) {
+			omrthread_monitor_wait(_workerMonitor);
+		}
+		success = (STATE_ERROR != _workerThreadState);
+	} else {
+		_workerThreadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_workerMonitor);
+
+	return success;
+}
+
+void
+MM_BackgroundWorker::shutdown()
+{
+	omrthread_monitor_enter(_workerMonitor);
+	if (STATE_ERROR != _workerThreadState) {
+		_stopRequested = true;
+		while (STATE_TERMINATED != _workerThreadState) {
+			_workerThreadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_workerMonitor);
+			omrthread_monitor_wait(_workerMonitor);
+		}
+		_stopRequested = false;
+	}
+	omrthread_monitor_exit(_workerMonitor);
+}
+
+void
+MM_BackgroundWorker::workerThreadEntryPoint()
+{
+	MM_CollectorLanguageInterface *cli = _extensions->collectorLanguageInterface;
+	OMR_VMThread *omrVMThread = NULL;
+
+	omrthread_monitor_enter(_workerMonitor);
+	_workerThreadState = STATE_WAITING;
+	omrthread_monitor_notify_all(_workerMonitor);
+	while (STATE_TERMINATION_REQUESTED != _workerThreadState) {
+		if (STATE_WORK_REQUESTED == _workerThreadState) {
+			if (NULL == omrVMThread) {
+				/* The thread is attached when the first work arrives rather than at startup, when the heap may not be
+				 * ready for a new thread. Work is requested with exclusive VM access, so the attach waits for the
+				 * collection to end, and the request may be withdrawn meanwhile.
+				 */
+				omrthread_monitor_exit(_workerMonitor);
+				omrVMThread = cli->attachVMThread(_extensions->getOmrVM(), _threadName, MM_CollectorLanguageInterfaceImpl::ATTACH_GC_HELPER_THREAD);
+				omrthread_monitor_enter(_workerMonitor);
+				if (NULL == omrVMThread) {
+					/* no work can be done without a thread, so behave as if terminated */
+					_workerThreadState = STATE_TERMINATED;
+					omrthread_monitor_notify_all(_workerMonitor);
+					omrthread_exit(_workerMonitor);
+				}
+				continue;
+			}
+			_workerThreadState = STATE_WORKING;
+			omrthread_monitor_exit(_workerMonitor);
+			doWork(MM_EnvironmentBase::getEnvironment(omrVMThread));
+			omrthread_monitor_enter(_workerMonitor);
+			if (STATE_WORKING == _workerThreadState) {
+				_workerThreadState = STATE_WAITING;
+			}
+			omrthread_monitor_notify_all(_workerMonitor);
+		} else {
+			omrthread_monitor_wait(_workerMonitor);
+		}
+	}
+
+	/* notify the other side that we are done so that they can continue running */
+	_workerThreadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_workerMonitor);
+	omrthread_monitor_exit(_workerMonitor);
+	if (NULL != omrVMThread) {
+		cli->detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_CollectorLanguageInterfaceImpl::ATTACH_GC_HELPER_THREAD);
+	}
+}
+
+bool
+MM_BackgroundWorker::isIdle()
+{
+	return (STATE_WAITING == _workerThreadState);
+}
+
+void
+MM_BackgroundWorker::requestWork()
+{
+	omrthread_monitor_enter(_workerMonitor);
+	if (STATE_WAITING == _workerThreadState) {
+		_workerThreadState = STATE_WORK_REQUESTED;
+		omrthread_monitor_notify_all(_workerMonitor);
+	}
+	omrthread_monitor_exit(_workerMonitor);
+}
+
+void
+MM_BackgroundWorker::stopWork()
+{
+	omrthread_monitor_enter(_workerMonitor);
+	if (STATE_WORK_REQUESTED == _workerThreadState) {
+		/* the worker thread has not picked up the request yet */
+		_workerThreadState = STATE_WAITING;
+	} else if (STATE_WORKING == _workerThreadState) {
+		_stopRequested = true;
+		while (STATE_WORKING == _workerThreadState) {
+			omrthread_monitor_wait(_workerMonitor);
+		}
+		_stopRequested = false;
+	}
+	omrthread_monitor_exit(_workerMonitor);
+}
+
+MM_BackgroundWorker::MM_BackgroundWorker(MM_EnvironmentBase *env, const char *threadName)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _threadName(threadName)
+	, _workerMonitor(NULL)
+	, _workerThreadState(STATE_ERROR)
+	, _stopRequested(false)
+{
+	_typeId = __FUNCTION__;
+}
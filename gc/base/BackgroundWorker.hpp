@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(BACKGROUNDWORKER_HPP_)
+#define BACKGROUNDWORKER_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+#include "omrthread.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * A dedicated thread that does one kind of GC work between collections.
+ * Work is requested and stopped by the collector with exclusive VM access, so at most one request is
+ * outstanding. Subclasses implement doWork(), which must return promptly once isStopRequested() is true.
+ * @ingroup GC_Base
+ */
+class MM_BackgroundWorker : public MM_BaseVirtual
+{
+/*
+ * Data members
+ */
+public:
+protected:
+	MM_GCExtensionsBase *_extensions; /**< The GC extensions */
+private:
+	typedef enum WorkerThreadState
+	{
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_WORK_REQUESTED,
+		STATE_WORKING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} WorkerThreadState;
+
+	const char *_threadName; /**< The name the worker thread attaches with */
+	omrthread_monitor_t _workerMonitor; /**< Protects _workerThreadState, and is used to wait for changes to it */
+	volatile WorkerThreadState _workerThreadState; /**< The state of the worker thread */
+	volatile bool _stopRequested; /**< Set to ask the worker thread to stop at its next check */
+
+/*
+ * Function members
+ */
+public:
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the worker thread, waiting until it is ready for work. The thread attaches to the VM when it is
+	 * first given work, so it may be started before the heap is fully initialized.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Stop any work in progress and shut down the worker thread, waiting until it exits.
+	 */
+	void shutdown();
+
+	MM_BackgroundWorker(MM_EnvironmentBase *env, const char *threadName);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the worker thread is running and has no work requested or in progress. Only a call to
+	 * requestWork() moves it out of this state, so the caller may prepare the work before requesting it.
+	 */
+	bool isIdle();
+
+	/**
+	 * Ask the worker thread to call doWork(). Ignored unless the worker is idle.
+	 */
+	void requestWork();
+
+	/**
+	 * Stop the work in progress, if any, and wait for the worker thread to become idle.
+	 * A request not yet picked up by the worker thread is withdrawn.
+	 */
+	void stopWork();
+
+	MMINLINE bool isStopRequested() { return _stopRequested; }
+
+	/**
+	 * Do the requested work on the worker thread.
+	 */
+	virtual void doWork(MM_EnvironmentBase *env) = 0;
+
+private:
+	/**
+	 * This is the method called by the forked thread. It returns when the thread is asked to terminate.
+	 */
+	void workerThreadEntryPoint();
+
+	/**
+	 * This is a helper function, used as a parameter to omrthread_create
+	 */
+	static int J9THREAD_PROC worker_thread_proc(void *info);
+};
+
+#endif /* BACKGROUNDWORKER_HPP_ */
@@ -30,6 +30,7 @@
 #include "HeapRegionManager.hpp"
 #include "MemoryManager.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "HeapMapWordScanner.hpp"
 #include "Dispatcher.hpp"
 #include "Task.hpp"
 
@@ -77,6 +78,55 @@ MM_CardTable::calculateCardTableSize(MM_EnvironmentBase *env, uintptr_t heapSize
 	return MM_Math::roundToCeiling(sizeof(uint32_t), (MM_Math::roundToCeiling(CARD_SIZE, heapSize) / CARD_SIZE) * sizeof(Card));
 }
 
+Card *
+MM_CardTable::findDirtyCard(Card *card, Card *topCard, Card cardMask)
+{
+	for (; card < topCard; card++) {
+		/* Are we on an uintptr_t boundary? If so scan the card table a uintptr_t
+		 * at a time until we find a slot which is non-zero or the end of card table
+		 * found. This is based on the premise that the card table will be mostly
+		 * empty and scanning an uintptr_t at a time will reduce the time taken to
+		 * scan the card table.
+		 */
+		if (((Card)CARD_CLEAN == *card) && (0 == ((uintptr_t)card % sizeof(uintptr_t)))) {
+			uintptr_t *nextSlot = (uintptr_t *)card;
+			/* Top card may be in middle of a slot so only scan up to and including last
+			 * complete slots worth of cards; then go card at a time
+			 */
+			uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+#if (0 == CARD_CLEAN)
+			/* A slot of clean cards is an empty word, so use the vectorized mark map scanner */
+			nextSlot = MM_HeapMapWordScanner::findNonEmptyWord(nextSlot, lastSlot);
+#else /* 0 == CARD_CLEAN */
+			while ((nextSlot < lastSlot) && ((uintptr_t)CARD_CLEAN == *nextSlot)) {
+				nextSlot += 1;
+			}
+#endif /* 0 == CARD_CLEAN */
+			card = (Card *)nextSlot;
+			if (card >= topCard) {
+				break;
+			}
+		}
+
+		if (0 != (*card & cardMask)) {
+			break;
+		}
+	}
+
+	return card;
+}
+
+Card *
+MM_CardTable::findDirtyCardRunTop(Card *dirtyCard, Card *topCard, Card cardMask, uintptr_t maxRunLength)
+{
+	Card *lastCardInRun = OMR_MIN(topCard, dirtyCard + maxRunLength);
+	Card *card = dirtyCard + 1;
+	while ((card < lastCardInRun) && (0 != (*card & cardMask))) {
+		card += 1;
+	}
+	return card;
+}
+
 bool
 MM_CardTable::commitCardTableMemory(MM_EnvironmentBase *env, Card *lowCard, Card *highCard)
 {
@@ -182,6 +182,26 @@ public:
 	 */
 	static uintptr_t calculateCardTableSize(MM_EnvironmentBase *env, uintptr_t heapsize);
 
+	/**
+	 * Find the first card in a range with any of the bits of cardMask set. Whole uintptr_t slots of clean
+	 * cards are skipped at a time, since most of the card table is expected to be clean.
+	 * @param[in] card The first card to check
+	 * @param[in] topCard The card immediately after the last card to check
+	 * @param[in] cardMask The bits identifying the cards of interest
+	 * @return The first card of interest, or topCard if there is none
+	 */
+	static Card *findDirtyCard(Card *card, Card *topCard, Card cardMask);
+
+	/**
+	 * Find the end of the run of adjacent cards of interest which starts at a card of interest.
+	 * @param[in] dirtyCard The first card of the run, which has some of the bits of cardMask set
+	 * @param[in] topCard The card immediately after the last card the run may include
+	 * @param[in] cardMask The bits identifying the cards of interest
+	 * @param[in] maxRunLength The most cards the run may include
+	 * @return The card immediately after the run
+	 */
+	static Card *findDirtyCardRunTop(Card *dirtyCard, Card *topCard, Card cardMask, uintptr_t maxRunLength);
+
 	/**
 	 * Align low address to virtual memory page size.
 	 * Check, is it possible to round down (memory not in use), round up otherwise
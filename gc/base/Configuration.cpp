@@ -37,6 +37,7 @@
 #include "OMR_VMThread.hpp"
 #include "MemoryManager.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParkingDispatcher.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 #include "TLHAllocationInterface.hpp"
@@ -476,5 +477,8 @@ MM_Configuration::initializeNUMAManager(MM_EnvironmentBase* env)
 MM_Dispatcher *
 MM_Configuration::createDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize)
 {
+	if (env->getExtensions()->parkingDispatcher) {
+		return MM_ParkingDispatcher::newInstance(env, handler, handler_arg, defaultOSStackSize);
+	}
 	return MM_ParallelDispatcher::newInstance(env, handler, handler_arg, defaultOSStackSize);
 }
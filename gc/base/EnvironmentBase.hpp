@@ -99,6 +99,7 @@ private:
 
 	uint64_t _exclusiveAccessTime; /**< time (in ticks) of the last exclusive access request */
 	uint64_t _meanExclusiveAccessIdleTime; /**< mean idle time (in ticks) of the last exclusive access request */
+	uint64_t _allocationFailureStartTime; /**< time (in ticks) the current allocation failure began, including the wait for exclusive access */
 	OMR_VMThread* _lastExclusiveAccessResponder; /**< last thread to respond to last exclusive access request */
 	uintptr_t _exclusiveAccessHaltedThreads; /**< number of threads halted by last exclusive access request */
 	bool _exclusiveAccessBeatenByOtherThread; /**< true if last exclusive access request had to wait for another GC thread */
@@ -437,6 +438,12 @@ public:
 	 */
 	uint64_t getExclusiveAccessTime() { return _exclusiveAccessTime; };
 
+	/**
+	 * Get and set the time the current allocation failure began, in raw format (no units).
+	 */
+	uint64_t getAllocationFailureStartTime() { return _allocationFailureStartTime; };
+	void setAllocationFailureStartTime(uint64_t startTime) { _allocationFailureStartTime = startTime; };
+
 	/**
 	 * Get the time average threads were idle while acquiring exclusive access.
 	 * Time is stored in raw format (no units).  Output routines
@@ -604,6 +611,7 @@ public:
 		,_commonAllocationContext(NULL)
 		,_exclusiveAccessTime(0)
 		,_meanExclusiveAccessIdleTime(0)
+		,_allocationFailureStartTime(0)
 		,_lastExclusiveAccessResponder(NULL)
 		,_exclusiveAccessHaltedThreads(0)
 		,_exclusiveAccessBeatenByOtherThread(false)
@@ -652,6 +660,7 @@ public:
 		,_commonAllocationContext(NULL)
 		,_exclusiveAccessTime(0)
 		,_meanExclusiveAccessIdleTime(0)
+		,_allocationFailureStartTime(0)
 		,_lastExclusiveAccessResponder(NULL)
 		,_exclusiveAccessHaltedThreads(0)
 		,_exclusiveAccessBeatenByOtherThread(false)
@@ -26,6 +26,7 @@
 
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
+#include "HeapMapWordScanner.hpp"
 
 MM_GCExtensionsBase*
 MM_GCExtensionsBase::newInstance(MM_EnvironmentBase* env)
@@ -63,6 +64,7 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	uint64_t physicalMemory = 0;
 	uint64_t memoryLimit = 0;
+	J9SysinfoCgroupLimits cgroupLimits;
 	uint64_t usableMemory = 0;
 	uint64_t memoryToRequest = 0;
 	uintptr_t *pageSizes = NULL;
@@ -102,6 +104,9 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	excessiveGCStats.endGCTimeStamp = omrtime_hires_clock();
 	excessiveGCStats.lastEndGlobalGCTimeStamp = excessiveGCStats.endGCTimeStamp;
 
+	/* use the widest vector instructions supported by the CPU to search the mark map */
+	MM_HeapMapWordScanner::selectImplementation();
+
 	/* Set Xmx (heap default).  For most platforms the heap default is a fraction of
 	 * the available physical memory, bounded by the build specs.
 	 *
@@ -111,6 +116,9 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	 * 16 MiB and a max of 512 MiB.
 	 * -note that RLIMIT_AS is as extracted from getrlimit and represents the resouce
 	 * limitation on address space.
+	 *
+	 * On Linux the memory limit of the process's cgroup (e.g. a container limit) further bounds
+	 * the usable memory.
 	 */
 
 	/* Initial physicalMemory as per system call. */
@@ -122,6 +130,9 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 		/* if there is no memory limit being imposed on us, we will use physical memory as our max */
 		usableMemory = physicalMemory;
 	}
+	if ((0 == omrsysinfo_get_cgroup_limits(&cgroupLimits)) && (cgroupLimits.memoryLimit < usableMemory)) {
+		usableMemory = cgroupLimits.memoryLimit;
+	}
 	/* we are going to try to request a slice of half the usable memory */
 	memoryToRequest = (usableMemory / 2);
 
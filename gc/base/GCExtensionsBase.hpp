@@ -34,6 +34,8 @@
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
 #include "LargeObjectAllocateStats.hpp"
+#include "LatencyStats.hpp"
+#include "ThreadUseStats.hpp"
 #include "MixedObjectModel.hpp"
 #include "NUMAManager.hpp"
 #include "OMRVMThreadListIterator.hpp"
@@ -95,6 +97,11 @@ struct J9Pool;
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* The largest number of slots the scavenger may read ahead of the slot being copied. */
+#define MAXIMUM_SCAVENGER_PREFETCH_DISTANCE 16
+/* The default length of the chain of hot fields copied depth first behind a copied object. */
+#define DEFAULT_SCAVENGER_HOT_FIELD_COPY_DEPTH 4
+
 #define NO_ESTIMATE_FRAGMENTATION 			0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 		0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 	0x2
@@ -208,6 +215,8 @@ public:
 
 	J9Pool* environments;
 	MM_ExcessiveGCStats excessiveGCStats;
+	MM_LatencyStats latencyStats; /**< Distributions of pause, phase and allocation failure times over the life of the process */
+	MM_ThreadUseStats threadUseStats; /**< Thread counts, throughput and idle time of the last dispatch of each adaptively threaded task */
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	MM_GlobalGCStats globalGCStats;
 #endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
@@ -231,6 +240,7 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool useTransparentHugePages; /**< true if the heap should be advised to use transparent huge pages where it is backed by default pages, set by -Xgc:transparentHugePages */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -282,6 +292,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each thread's TLH refresh size follows its allocation rate rather than growing by tlhIncrementSize, set by -Xgc:tlhAdaptiveSizing */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< with tlhAdaptiveSizing, the time in microseconds a TLH should last at the thread's allocation rate */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -327,9 +339,16 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	uintptr_t heapSizingGCTimeRatio; /**< target percentage of time spent in gc for goal-driven heap sizing, or 0 to size the heap by its free ratio, set by -Xgc:heapSizingGCTimeRatio= */
+	uintptr_t heapSizingMaximumPause; /**< pause time goal, in milliseconds, for goal-driven heap sizing, or 0 for none, set by -Xgc:heapSizingMaxPause= */
+	uintptr_t heapSizingCeiling; /**< hard limit on the size of the heap in bytes, or 0 for none, set by -Xgc:heapSizingCeiling=. Applied as -Xsoftmx when it is smaller */
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool sizeClassFreeListIndex; /**< if true, address ordered list memory pools keep a power of two size class index of their free list to shorten allocation searches, set by -Xgc:sizeClassFreeListIndex */
+	bool numaAwarePacketLists; /**< if true, packet list sublists are grouped by NUMA affinity leader and GC threads prefer packets of their own node, set by -Xgc:numaAwarePacketLists */
+	bool workStealingPackets; /**< if true, GC threads keep input packets on private deques and steal from each other rather than waiting on the shared packet lists, set by -Xgc:workStealingPackets */
+	bool backgroundMarkMapClear; /**< if true, the mark map is cleared by a background thread after each global collection so the next mark does not have to clear it, set by -Xgc:backgroundMarkMapClear (ignored with concurrent mark or concurrent sweep) */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
@@ -380,6 +399,9 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreading; /**< dispatch tasks that can estimate their work on no more threads than the work needs, enabled by -Xgc:adaptiveGCThreading */
+	uintptr_t adaptiveGCThreadingMinimumWork; /**< least work, in microseconds, worth waking a GC thread for, set by -Xgc:adaptiveGCThreadingMinimumWork= */
+	bool parkingDispatcher; /**< park each GC slave thread on its own monitor and wake threads for a task through a tree, set by -Xgc:parkingDispatcher */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -401,6 +423,10 @@ public:
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
+	uintptr_t scavengerPrefetchDistance; /**< number of slots the scavenger reads ahead of the slot being copied, prefetching their referents (0 to disable), set by -Xgc:scavengerPrefetchDistance= */
+	bool scavengerHotFieldCopyOrder; /**< if true, the scavenger copies the hot field chain of each copied object immediately behind it, set by -Xgc:scavengerHotFieldCopyOrder */
+	uintptr_t scavengerHotFieldCopyDepth; /**< maximum length of the hot field chain copied behind each object when scavengerHotFieldCopyOrder is set, set by -Xgc:scavengerHotFieldCopyDepth= */
+	bool scavengerCardMarking; /**< if true, the scavenger remembers old objects in a card table and object bit map rather than in the remembered set list, set by -Xgc:scavengerCardMarking */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
 	bool concurrentScavengerRequested; /**< set to true if CS is requested (by cmdline option), but there are more checks to do before deciding whether the request is to be obeyed */
@@ -466,6 +492,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool parallelSlidingCompact; /**< if true, compaction slides objects down each segment using subareas as parallel work units */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -482,6 +509,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	uintptr_t cardCleaningMaxRunLength; /**< Most adjacent dirty cards claimed and retraced together during final card cleaning */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -565,6 +593,10 @@ public:
 	uintptr_t traceCostToCheckYield; /**< tracing cost (in number of objects marked and pointers scanned) after we try to yield */
 	uintptr_t sweepCostToCheckYield; /**< weighted count of free chunks/marked objects before we check yield in sweep small loop */
 	uintptr_t splitAvailableListSplitAmount; /**< Number of split available lists per size class, per defragment bucket */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	bool segregatedConcurrentSweep; /**< if true, small regions are swept after the collection, on demand by allocating threads and by a background thread, set by -Xgc:segregatedConcurrentSweep */
+	bool segregatedLockFreeRegionLists; /**< if true, the region pool queues and single free list shared between threads are lock-free, set by -Xgc:segregatedLockFreeRegionLists */
+#endif /* OMR_GC_SEGREGATED_HEAP */
 	uint32_t newThreadAllocationColor;
 	uintptr_t minimumFreeEntrySize;
 	uintptr_t arrayletsPerRegion;
@@ -590,6 +622,11 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Write logs (e.g. verbose:gc) to a file from a dedicated thread, taking precedence over bufferedLogging */
+	uintptr_t asyncLoggingBufferCount; /**< Number of buffers in the ring of the asynchronous log writer (-Xgc:asyncLoggingBuffers=) */
+	uintptr_t asyncLoggingBufferSize; /**< Size in bytes of each buffer of the asynchronous log writer (-Xgc:asyncLoggingBufferSize=) */
+	bool asyncLoggingStallWhenFull; /**< Enabled by -Xgc:asyncLoggingStallWhenFull.  Wait for a free buffer rather than drop records when every buffer of the asynchronous log writer is waiting to be written */
+	bool verboseBinaryFormat; /**< Enabled by -Xgc:verboseBinaryFormat.  Write verbose:gc files in the binary verbose format rather than as XML, taking precedence over bufferedLogging. Cannot be combined with asyncLogging */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -755,6 +792,21 @@ public:
 	 */
 	MMINLINE MM_Forge* getForge() { return &_forge; }
 
+	/**
+	 * Gets the distribution of a pause or phase time over the life of the process.
+	 * @param type the latency to answer
+	 * @return Pointer to the histogram of the latency
+	 */
+	MMINLINE MM_PauseHistogram* getLatencyHistogram(MM_GCLatencyType type) { return latencyStats.getHistogram(type); }
+
+	/**
+	 * Gets a percentile of a pause or phase time over the life of the process.
+	 * @param type the latency to answer
+	 * @param percentile the percentage of recorded times, from 0 to 100 (e.g. 99.9)
+	 * @return the time in microseconds that the given percentage of recorded times were no longer than, or 0 if none have been recorded
+	 */
+	MMINLINE uint64_t getLatencyPercentile(MM_GCLatencyType type, double percentile) { return latencyStats.getHistogram(type)->getPercentileMicros(percentile); }
+
 	MMINLINE uintptr_t getRememberedCount()
 	{
 		if (isStandardGC()) {
@@ -776,6 +828,11 @@ public:
 	MMINLINE void setObjectMap(MM_ObjectMap *objectMap) { _objectMap = objectMap; }
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+	/**
+	 * @return true if the heap is sized to meet a gc time ratio and pause time goal rather than its free ratio
+	 */
+	MMINLINE bool isGoalDrivenHeapSizing() { return 0 != heapSizingGCTimeRatio; }
+
 	MMINLINE bool
 	isConcurrentScavengerEnabled()
 	{
@@ -1185,6 +1242,7 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, useTransparentHugePages(false)
 #if defined(OMR_GC_STACCATO)
 		, staccatoRememberedSet(NULL)
 #endif /* OMR_GC_STACCATO */
@@ -1211,6 +1269,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(1000)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1241,14 +1301,24 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapSizingGCTimeRatio(0)
+		, heapSizingMaximumPause(0)
+		, heapSizingCeiling(0)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, sizeClassFreeListIndex(false)
+		, numaAwarePacketLists(false)
+		, workStealingPackets(false)
+		, backgroundMarkMapClear(false)
 		, cacheListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
 		, softMx(0) /* softMx only set if specified */
 		, gcThreadCountForced(false)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingMinimumWork(500)
+		, parkingDispatcher(false)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		, scavengerTraceHotFields(false)
@@ -1264,6 +1334,10 @@ public:
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
 		, scavengerEnabled(false)
+		, scavengerPrefetchDistance(0)
+		, scavengerHotFieldCopyOrder(false)
+		, scavengerHotFieldCopyDepth(DEFAULT_SCAVENGER_HOT_FIELD_COPY_DEPTH)
+		, scavengerCardMarking(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, concurrentScavenger(false)
 		, concurrentScavengerRequested(false)
@@ -1313,6 +1387,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, parallelSlidingCompact(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 		, concurrentMark(false)
@@ -1330,6 +1405,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardCleaningMaxRunLength(16)
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 		, lowMinimum(0)
 		, allowMergedSpaces(1)
@@ -1373,6 +1449,10 @@ public:
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
 		, sweepCostToCheckYield(500) /* weighted count of free chunks/marked objects before we check yield in sweep small loop */
 		, splitAvailableListSplitAmount(0)
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		, segregatedConcurrentSweep(false)
+		, segregatedLockFreeRegionLists(false)
+#endif /* OMR_GC_SEGREGATED_HEAP */
 		, newThreadAllocationColor(0)
 		, minimumFreeEntrySize((uintptr_t)-1) /* -1 => user did not override default minimumFreeEntrySize */
 		, arrayletsPerRegion(0)
@@ -1391,6 +1471,11 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferCount(4)
+		, asyncLoggingBufferSize(64 * 1024)
+		, asyncLoggingStallWhenFull(false)
+		, verboseBinaryFormat(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
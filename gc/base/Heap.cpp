@@ -523,6 +523,8 @@ MM_Heap::initializeCommonGCData(MM_EnvironmentBase* env, struct MM_CommonGCData*
 /**
  * Determine how much of the heap is actually adjustable.
  * @note when using GenCon we can not adjust nursery space.
+ * @note -Xgc:heapSizingCeiling= limits the heap actually in use, so it leaves the ceiling less the active
+ * (rather than the reserved) nursery for the tenure space. The smaller of it and -Xsoftmx applies.
  * @param env
  * @return Size of the adjustable heap memory
  */
@@ -531,8 +533,9 @@ MM_Heap::getActualSoftMxSize(MM_EnvironmentBase* env)
 {
 	uintptr_t actualSoftMX = 0;
 	MM_GCExtensionsBase* extensions = env->getExtensions();
+	uintptr_t softMx = extensions->softMx;
 
-	if ((OMR_GC_POLICY_GENCON == env->getOmrVM()->gcPolicy) && (0 != extensions->softMx)) {
+	if ((OMR_GC_POLICY_GENCON == env->getOmrVM()->gcPolicy) && (0 != softMx)) {
 		uintptr_t totalHeapSize = getHeapRegionManager()->getTotalHeapSize();
 		uintptr_t tenureSize = getActiveMemorySize(MEMORY_TYPE_OLD);
 
@@ -540,13 +543,24 @@ MM_Heap::getActualSoftMxSize(MM_EnvironmentBase* env)
 
 		uintptr_t nurserySize = totalHeapSize - tenureSize;
 
-		if (nurserySize <= extensions->softMx) {
-			actualSoftMX = extensions->softMx - nurserySize;
+		if (nurserySize <= softMx) {
+			actualSoftMX = softMx - nurserySize;
 		} else {
 			actualSoftMX = 0;
 		}
 	} else {
-		actualSoftMX = extensions->softMx;
+		actualSoftMX = softMx;
+	}
+
+	uintptr_t ceiling = extensions->heapSizingCeiling;
+	if (0 != ceiling) {
+		/* there is no new space unless the heap is generational */
+		uintptr_t nurserySize = getActiveMemorySize(MEMORY_TYPE_NEW);
+		/* 0 would mean no limit, so a nursery at or over the ceiling leaves the tenure space the least we can ask for */
+		ceiling = (nurserySize < ceiling) ? (ceiling - nurserySize) : extensions->regionSize;
+		if ((0 == actualSoftMX) || (ceiling < actualSoftMX)) {
+			actualSoftMX = ceiling;
+		}
 	}
 	return actualSoftMX;
 }
@@ -20,6 +20,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapWordScanner.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -127,6 +128,16 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the remaining run of empty heap map slots in one search rather than a slot per iteration */
+				uintptr_t heapMapSlotsRemaining = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, _heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+				uintptr_t *heapMapSlotNext = MM_HeapMapWordScanner::findNonEmptyWord(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + heapMapSlotsRemaining);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNext;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "HeapMapWordScanner.hpp"
+
+#if defined(OMR_GC_VECTOR_HEAP_MAP_SCAN)
+#include <immintrin.h>
+#endif /* OMR_GC_VECTOR_HEAP_MAP_SCAN */
+
+static uintptr_t *
+findNonEmptyWordScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t *
+findEmptyWordScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 != *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_GC_VECTOR_HEAP_MAP_SCAN)
+/*
+ * The vector implementations test a block of words at a time and leave the scalar loop to find the
+ * exact word within the block which ends the run, and to handle the words left over at the top.
+ */
+
+__attribute__((target("sse4.2"))) static uintptr_t *
+findNonEmptyWordSSE42(uintptr_t *current, uintptr_t *top)
+{
+	while ((current + 4) <= top) {
+		__m128i low = _mm_loadu_si128((const __m128i *)current);
+		__m128i high = _mm_loadu_si128((const __m128i *)(current + 2));
+		__m128i bits = _mm_or_si128(low, high);
+		if (!_mm_testz_si128(bits, bits)) {
+			break;
+		}
+		current += 4;
+	}
+	return findNonEmptyWordScalar(current, top);
+}
+
+__attribute__((target("sse4.2"))) static uintptr_t *
+findEmptyWordSSE42(uintptr_t *current, uintptr_t *top)
+{
+	const __m128i zero = _mm_setzero_si128();
+	while ((current + 4) <= top) {
+		__m128i low = _mm_loadu_si128((const __m128i *)current);
+		__m128i high = _mm_loadu_si128((const __m128i *)(current + 2));
+		__m128i empty = _mm_or_si128(_mm_cmpeq_epi64(low, zero), _mm_cmpeq_epi64(high, zero));
+		if (!_mm_testz_si128(empty, empty)) {
+			break;
+		}
+		current += 4;
+	}
+	return findEmptyWordScalar(current, top);
+}
+
+__attribute__((target("avx2"))) static uintptr_t *
+findNonEmptyWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	while ((current + 8) <= top) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(current + 4));
+		__m256i bits = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		current += 8;
+	}
+	return findNonEmptyWordScalar(current, top);
+}
+
+__attribute__((target("avx2"))) static uintptr_t *
+findEmptyWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	while ((current + 8) <= top) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)current);
+		__m256i high = _mm256_loadu_si256((const __m256i *)(current + 4));
+		__m256i empty = _mm256_or_si256(_mm256_cmpeq_epi64(low, zero), _mm256_cmpeq_epi64(high, zero));
+		if (!_mm256_testz_si256(empty, empty)) {
+			break;
+		}
+		current += 8;
+	}
+	return findEmptyWordScalar(current, top);
+}
+#endif /* OMR_GC_VECTOR_HEAP_MAP_SCAN */
+
+MM_HeapMapWordScanner::ScanImplementation MM_HeapMapWordScanner::_implementation = MM_HeapMapWordScanner::SCAN_SCALAR;
+MM_HeapMapWordScanner::FindWordFunction MM_HeapMapWordScanner::_findNonEmptyWord = findNonEmptyWordScalar;
+MM_HeapMapWordScanner::FindWordFunction MM_HeapMapWordScanner::_findEmptyWord = findEmptyWordScalar;
+
+bool
+MM_HeapMapWordScanner::isImplementationSupported(ScanImplementation implementation)
+{
+	bool supported = false;
+
+	switch (implementation) {
+	case SCAN_SCALAR:
+		supported = true;
+		break;
+#if defined(OMR_GC_VECTOR_HEAP_MAP_SCAN)
+	case SCAN_SSE42:
+		__builtin_cpu_init();
+		supported = (0 != __builtin_cpu_supports("sse4.2"));
+		break;
+	case SCAN_AVX2:
+		__builtin_cpu_init();
+		supported = (0 != __builtin_cpu_supports("avx2"));
+		break;
+#endif /* OMR_GC_VECTOR_HEAP_MAP_SCAN */
+	default:
+		break;
+	}
+
+	return supported;
+}
+
+bool
+MM_HeapMapWordScanner::setImplementation(ScanImplementation implementation)
+{
+	if (!isImplementationSupported(implementation)) {
+		return false;
+	}
+
+	switch (implementation) {
+#if defined(OMR_GC_VECTOR_HEAP_MAP_SCAN)
+	case SCAN_SSE42:
+		_findNonEmptyWord = findNonEmptyWordSSE42;
+		_findEmptyWord = findEmptyWordSSE42;
+		break;
+	case SCAN_AVX2:
+		_findNonEmptyWord = findNonEmptyWordAVX2;
+		_findEmptyWord = findEmptyWordAVX2;
+		break;
+#endif /* OMR_GC_VECTOR_HEAP_MAP_SCAN */
+	default:
+		_findNonEmptyWord = findNonEmptyWordScalar;
+		_findEmptyWord = findEmptyWordScalar;
+		break;
+	}
+	_implementation = implementation;
+
+	return true;
+}
+
+void
+MM_HeapMapWordScanner::selectImplementation()
+{
+	if (!setImplementation(SCAN_AVX2)) {
+		if (!setImplementation(SCAN_SSE42)) {
+			setImplementation(SCAN_SCALAR);
+		}
+	}
+}
+
+const char *
+MM_HeapMapWordScanner::getImplementationName(ScanImplementation implementation)
+{
+	switch (implementation) {
+	case SCAN_SSE42:
+		return "sse4.2";
+	case SCAN_AVX2:
+		return "avx2";
+	default:
+		return "scalar";
+	}
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPWORDSCANNER_HPP_)
+#define HEAPMAPWORDSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && defined(__GNUC__)
+#define OMR_GC_VECTOR_HEAP_MAP_SCAN
+#endif /* OMR_ARCH_X86 && OMR_ENV_DATA64 && __GNUC__ */
+
+/**
+ * Find runs of empty and non-empty heap map words.
+ * The search is done by one of several implementations: a portable scalar loop, or on x86-64 a loop testing
+ * 128 bits (SSE4.2) or 256 bits (AVX2) of the map at a time. The best implementation supported by the CPU is
+ * selected by selectImplementation() at startup; until then the scalar implementation is used.
+ * @note The word at the current position is tested inline, so that short runs do not pay for the call.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapWordScanner
+{
+/*
+ * Data members
+ */
+public:
+	typedef enum ScanImplementation {
+		SCAN_SCALAR = 0,
+		SCAN_SSE42,
+		SCAN_AVX2,
+	} ScanImplementation;
+
+protected:
+private:
+	typedef uintptr_t *(*FindWordFunction)(uintptr_t *current, uintptr_t *top);
+
+	static ScanImplementation _implementation; /**< The implementation in use */
+	static FindWordFunction _findNonEmptyWord; /**< Implementation of findNonEmptyWord() */
+	static FindWordFunction _findEmptyWord; /**< Implementation of findEmptyWord() */
+
+/*
+ * Function members
+ */
+public:
+	/**
+	 * Find the first non-empty heap map word at or after current.
+	 * @param current the first word to test
+	 * @param top the word after the last word to test
+	 * @return the address of the first non-empty word, or top if there is none
+	 */
+	MMINLINE static uintptr_t *
+	findNonEmptyWord(uintptr_t *current, uintptr_t *top)
+	{
+		if ((current >= top) || (0 != *current)) {
+			return current;
+		}
+		return _findNonEmptyWord(current + 1, top);
+	}
+
+	/**
+	 * Find the first empty heap map word at or after current.
+	 * @param current the first word to test
+	 * @param top the word after the last word to test
+	 * @return the address of the first empty word, or top if there is none
+	 */
+	MMINLINE static uintptr_t *
+	findEmptyWord(uintptr_t *current, uintptr_t *top)
+	{
+		if ((current >= top) || (0 == *current)) {
+			return current;
+		}
+		return _findEmptyWord(current + 1, top);
+	}
+
+	/**
+	 * Select the best implementation supported by the CPU.
+	 */
+	static void selectImplementation();
+
+	/**
+	 * Use the specified implementation.
+	 * @param implementation the implementation to use
+	 * @return true on success, false if the implementation is not supported by the CPU or the build
+	 */
+	static bool setImplementation(ScanImplementation implementation);
+
+	/**
+	 * @return the implementation in use
+	 */
+	static ScanImplementation getImplementation() { return _implementation; }
+
+	/**
+	 * @return a printable name for an implementation
+	 */
+	static const char *getImplementationName(ScanImplementation implementation);
+
+	/**
+	 * @return true if the implementation is supported by the CPU and the build
+	 */
+	static bool isImplementationSupported(ScanImplementation implementation);
+};
+
+#endif /* HEAPMAPWORDSCANNER_HPP_ */
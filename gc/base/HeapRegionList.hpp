@@ -73,6 +73,8 @@ protected:
 	RegionListKind _regionListKind;
 	/**< Do regions on the list represent only themselves, or do they encode region ranges (Large & MultiFree) */
 	bool _singleRegionsOnly;
+	/**< Number of operations that found the list in use by another thread (waited for its lock, or retried an update) */
+	volatile uintptr_t _contentionCount;
 	
 private:	
 	
@@ -91,13 +93,16 @@ public:
 	MM_HeapRegionList(RegionListKind regionListKind, bool singleRegionsOnly) :
 		_length(0),
 		_regionListKind(regionListKind),
-		_singleRegionsOnly(singleRegionsOnly)
+		_singleRegionsOnly(singleRegionsOnly),
+		_contentionCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
 
 	uintptr_t length() { return _length; }
 
+	uintptr_t getContentionCount() { return _contentionCount; }
+
 	virtual bool isEmpty() = 0;
 
 	virtual uintptr_t getTotalRegions() = 0;
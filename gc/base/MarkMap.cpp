@@ -58,13 +58,16 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 {
 	/* TODO: The multiplier should really be some constant defined globally */
 	const uintptr_t MODRON_PARALLEL_MULTIPLIER = 32;
-	uintptr_t heapAlignment = _extensions->heapAlignment;
+	uintptr_t regionSize = _extensions->regionSize;
 
-	/* Determine the size of heap that a work unit of mark map clearing corresponds to */
+	/* Determine the size of heap that a work unit of mark map clearing corresponds to (a whole number of regions) */
 	uintptr_t heapClearUnitFactor = env->_currentTask->getThreadCount();
 	heapClearUnitFactor = ((heapClearUnitFactor == 1) ? 1 : heapClearUnitFactor * MODRON_PARALLEL_MULTIPLIER);
 	uintptr_t heapClearUnitSize = _extensions->heap->getMemorySize() / heapClearUnitFactor;
-	heapClearUnitSize = MM_Math::roundToCeiling(heapAlignment, heapClearUnitSize);
+	heapClearUnitSize = MM_Math::roundToCeiling(regionSize, OMR_MAX(heapClearUnitSize, 1));
+
+	/* Heap below this address was cleared in the background since the last collection */
+	uint8_t *cleanHeapTop = (uint8_t *)_cleanHeapTop;
 
 	/* Walk all object segments to determine what ranges of the mark map should be cleared */
 	MM_HeapRegionDescriptor *region;
@@ -84,21 +87,12 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 				uintptr_t heapCurrentClearSize = (heapClearUnitSize > heapClearSizeRemaining) ? heapClearSizeRemaining : heapClearUnitSize;
 				Assert_MM_true(heapCurrentClearSize > 0);
 
-				/* Check if the thread should clear the corresponding mark map range for the current heap range */
-				if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					/* Convert the heap address/size to its corresponding mark map address/size */
-					/* NOTE: We calculate the low and high heap offsets, and build the mark map index and size values
-					 * from these to avoid rounding errors (if we use the size, the conversion routine could get a different
-					 * rounding result then the actual end address)
-					 */
-					uintptr_t heapClearOffset = ((uintptr_t)heapClearAddress) - _heapMapBaseDelta;
-					uintptr_t heapMapClearIndex = convertHeapIndexToHeapMapIndex(env, heapClearOffset, sizeof(uintptr_t));
-					uintptr_t heapMapClearSize =
-						convertHeapIndexToHeapMapIndex(env, heapClearOffset + heapCurrentClearSize, sizeof(uintptr_t))
-						- heapMapClearIndex;
-
-					/* And clear the mark map */
-					OMRZeroMemory((void *) (((uintptr_t)_heapMapBits) + heapMapClearIndex), heapMapClearSize);
+				/* Skip ranges that are already clear (every thread skips the same units, so work unit numbering stays consistent) */
+				if ((heapClearAddress + heapCurrentClearSize) > cleanHeapTop) {
+					/* Check if the thread should clear the corresponding mark map range for the current heap range */
+					if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+						clearMarkMapForHeapRange(env, heapClearAddress, heapCurrentClearSize);
+					}
 				}
 
 				/* Move to the next address range in the segment */
@@ -108,3 +102,21 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 		}
 	}
 }
+
+void
+MM_MarkMap::clearMarkMapForHeapRange(MM_EnvironmentBase *env, void *lowAddress, uintptr_t size)
+{
+	/* Convert the heap address/size to its corresponding mark map address/size */
+	/* NOTE: We calculate the low and high heap offsets, and build the mark map index and size values
+	 * from these to avoid rounding errors (if we use the size, the conversion routine could get a different
+	 * rounding result then the actual end address)
+	 */
+	uintptr_t heapClearOffset = ((uintptr_t)lowAddress) - _heapMapBaseDelta;
+	uintptr_t heapMapClearIndex = convertHeapIndexToHeapMapIndex(env, heapClearOffset, sizeof(uintptr_t));
+	uintptr_t heapMapClearSize =
+		convertHeapIndexToHeapMapIndex(env, heapClearOffset + size, sizeof(uintptr_t))
+		- heapMapClearIndex;
+
+	/* And clear the mark map */
+	OMRZeroMemory((void *) (((uintptr_t)_heapMapBits) + heapMapClearIndex), heapMapClearSize);
+}
@@ -41,15 +41,30 @@ class MM_MarkMap : public MM_HeapMap
 {
 private:
 	bool _isMarkMapValid; /** < Is this mark map valid */
+	void *_cleanHeapTop; /**< All committed heap below this address is known to have clear mark bits (set when a background clear is stopped, consumed by the next initializeMarkMap()) */
 	
 public:
 	MMINLINE bool isMarkMapValid() const { return _isMarkMapValid; }
 	MMINLINE void setMarkMapValid(bool isMarkMapValid) {  _isMarkMapValid = isMarkMapValid; }
 
+	MMINLINE void *getCleanHeapTop() const { return _cleanHeapTop; }
+	MMINLINE void setCleanHeapTop(void *cleanHeapTop) { _cleanHeapTop = cleanHeapTop; }
+
  	static MM_MarkMap *newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize);
  	
+	/**
+	 * Clear the mark map in parallel for all committed heap. Work units are a whole number of
+	 * heap regions; units entirely below the clean heap top are skipped.
+	 */
  	void initializeMarkMap(MM_EnvironmentBase *env);
 
+	/**
+	 * Clear the mark bits corresponding to a committed range of the heap.
+	 * @param lowAddress base of the heap range
+	 * @param size size of the heap range, in bytes
+	 */
+	void clearMarkMapForHeapRange(MM_EnvironmentBase *env, void *lowAddress, uintptr_t size);
+
 	MMINLINE void *getMarkBits() { return _heapMapBits; };
  	
 	MMINLINE uintptr_t getHeapMapBaseRegionRounded() { return _heapMapBaseDelta; }
@@ -104,6 +119,7 @@ public:
 	MM_MarkMap(MM_EnvironmentBase *env, uintptr_t maxHeapSize) :
 		MM_HeapMap(env, maxHeapSize, env->getExtensions()->isSegregatedHeap())
 		, _isMarkMapValid(false)
+		, _cleanHeapTop(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
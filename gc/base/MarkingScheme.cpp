@@ -319,8 +319,15 @@ MM_MarkingScheme::markLiveObjectsInit(MM_EnvironmentBase *env, bool initMarkMap)
 	workerSetupForGC(env);
 
 	if(initMarkMap) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t clearStartTime = omrtime_hires_clock();
 		_markMap->initializeMarkMap(env);
-		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		env->_markStats.addToMarkMapClearTime(clearStartTime, omrtime_hires_clock());
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			/* the range cleared in the background has been consumed; marking dirties it again */
+			_markMap->setCleanHeapTop(NULL);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
 	}
 }
 
@@ -66,6 +66,10 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	if (extensions->useTransparentHugePages) {
+		options |= OMRPORT_VMEM_ADVISE_HUGEPAGE;
+	}
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
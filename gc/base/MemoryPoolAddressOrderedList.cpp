@@ -37,6 +37,7 @@
 #include "LargeObjectAllocateStats.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 
 /**
  * Create and initialize a new instance of the receiver.
@@ -125,6 +126,9 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	_sizeClassIndexEnabled = ext->sizeClassFreeListIndex;
+	clearSizeClassIndex();
+
 	return true;
 }
 
@@ -394,6 +398,110 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	/* The size class index has the same constraint */
+	if (_sizeClassIndexEnabled) {
+		updateSizeClassIndexBeyondEntry(freeEntry);
+	}
+}
+
+/****************************************
+ * Size Class Index Functionality
+ ****************************************
+ */
+
+/**
+ * Forget every size class index entry, so that all searches start from the head of the free list.
+ */
+void
+MM_MemoryPoolAddressOrderedList::clearSizeClassIndex()
+{
+	for (uintptr_t sizeClass = 0; sizeClass < SIZE_CLASS_INDEX_COUNT; sizeClass++) {
+		_sizeClassIndex[sizeClass] = NULL;
+	}
+}
+
+/**
+ * Find the free entry after which a search for an entry of the given size class may start.
+ * Entries which have fallen below the head of the free list (consumed by TLH allocation) are stale and are discarded.
+ * @param sizeClass floor(log2) of the size being searched for
+ * @return the free entry to start searching after, or NULL if the search must start at the head of the free list
+ */
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findSizeClassIndexEntry(uintptr_t sizeClass)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = _sizeClassIndex[sizeClass];
+
+	if ((NULL != freeEntry) && ((NULL == _heapFreeList) || (freeEntry < _heapFreeList))) {
+		_sizeClassIndex[sizeClass] = NULL;
+		freeEntry = NULL;
+	}
+
+	return freeEntry;
+}
+
+/**
+ * Replace every size class index entry referring to a free entry which is being moved or removed.
+ * @param oldFreeEntry the free entry leaving the list
+ * @param newFreeEntry the (smaller) entry replacing it, or the entry preceding it if it was removed (may be NULL)
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndex(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < SIZE_CLASS_INDEX_COUNT; sizeClass++) {
+		if (_sizeClassIndex[sizeClass] == oldFreeEntry) {
+			_sizeClassIndex[sizeClass] = newFreeEntry;
+		}
+	}
+}
+
+/**
+ * Update all size class index entries to point no further than the given free entry.
+ * Used when free entries are inserted in the middle of the free list, which may make them the first entry of a size class.
+ * @param freeEntry the free entry preceding the inserted entries (NULL if they were inserted at the head)
+ */
+void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndexBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < SIZE_CLASS_INDEX_COUNT; sizeClass++) {
+		if (_sizeClassIndex[sizeClass] > freeEntry) {
+			_sizeClassIndex[sizeClass] = freeEntry;
+		}
+	}
+}
+
+/**
+ * Rebuild the size class index with a single walk of the free list.
+ * The walk stops once the size class of the largest free entry has been found.
+ */
+void
+MM_MemoryPoolAddressOrderedList::rebuildSizeClassIndex()
+{
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	uintptr_t sizeClassesFound = 0;
+	uintptr_t sizeClassLimit = (0 == _largestFreeEntry) ? SIZE_CLASS_INDEX_COUNT : (MM_Math::floorLog2(_largestFreeEntry) + 1);
+
+	clearSizeClassIndex();
+
+	while ((NULL != currentFreeEntry) && (sizeClassesFound < sizeClassLimit)) {
+		uintptr_t sizeClass = MM_Math::floorLog2(currentFreeEntry->getSize());
+		/* this is the first entry of every size class not yet seen up to its own */
+		while (sizeClassesFound <= sizeClass) {
+			_sizeClassIndex[sizeClassesFound] = previousFreeEntry;
+			sizeClassesFound += 1;
+		}
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext();
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	if (_sizeClassIndexEnabled) {
+		rebuildSizeClassIndex();
+	}
 }
 
 /****************************************
@@ -410,6 +518,11 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+	uintptr_t sizeClass = 0;
+	uintptr_t sizeClassMinimumSize = 0;
+	bool recordSizeClassIndex;
+	bool sizeClassEntryFound;
+	MM_HeapLinkedFreeHeader *sizeClassIndexEntry;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
@@ -432,12 +545,41 @@ retry:
 		candidateHintSize = allocateHintUsed->size;
 	}
 
+	/* The size class index may let the search skip further than the hint.  The index for the size class can
+	 * only be refreshed by a walk that started at the head or at an index entry for the same size class.
+	 */
+	recordSizeClassIndex = false;
+	sizeClassEntryFound = false;
+	sizeClassIndexEntry = NULL;
+	if (_sizeClassIndexEnabled) {
+		sizeClass = MM_Math::floorLog2(sizeInBytesRequired);
+		sizeClassMinimumSize = (uintptr_t)1 << sizeClass;
+		sizeClassIndexEntry = findSizeClassIndexEntry(sizeClass);
+		if (NULL != sizeClassIndexEntry) {
+			if ((NULL == allocateHintUsed) || (sizeClassIndexEntry >= currentFreeEntry)) {
+				previousFreeEntry = sizeClassIndexEntry;
+				currentFreeEntry = sizeClassIndexEntry->getNext();
+				candidateHintSize = sizeClassMinimumSize - 1;
+				allocateHintUsed = NULL;
+				recordSizeClassIndex = true;
+			}
+		} else {
+			recordSizeClassIndex = (NULL == allocateHintUsed);
+		}
+	}
+
 	while(currentFreeEntry) {
 		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
 		/* while we are walking, keep track of the largest free entry.  We will need this in the case of allocation failure to update the pool's largest free */
 		if (currentFreeEntrySize > largestFreeEntry) {
 			largestFreeEntry = currentFreeEntrySize;
 		}
+
+		/* Remember the entry preceding the first one large enough for the size class */
+		if (recordSizeClassIndex && !sizeClassEntryFound && (sizeClassMinimumSize <= currentFreeEntrySize)) {
+			sizeClassEntryFound = true;
+			sizeClassIndexEntry = previousFreeEntry;
+		}
 		
 		if(sizeInBytesRequired <= currentFreeEntrySize) {
 			break;
@@ -454,6 +596,10 @@ retry:
 		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
 	}
 
+	if (recordSizeClassIndex && sizeClassEntryFound) {
+		_sizeClassIndex[sizeClass] = sizeClassIndexEntry;
+	}
+
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -485,6 +631,9 @@ retry:
 
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext())) {
 		updateHint(currentFreeEntry, recycleEntry);
+		if (_sizeClassIndexEnabled) {
+			updateSizeClassIndex(currentFreeEntry, recycleEntry);
+		}
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		/* Adjust the free memory size and count */
@@ -496,6 +645,9 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (_sizeClassIndexEnabled) {
+			updateSizeClassIndex(currentFreeEntry, previousFreeEntry);
+		}
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -700,6 +852,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	clearSizeClassIndex();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 
 	resetFreeEntryAllocateStats(_largeObjectAllocateStats);
@@ -791,6 +944,9 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	/* Coalescing may remove indexed entries from the list */
+	clearSizeClassIndex();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -892,6 +1048,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	/* Contraction may remove indexed entries from the list */
+	clearSizeClassIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -984,6 +1143,9 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 		currentFreeEntry = currentFreeEntry->getNext();
 	}
 
+	/* Added entries may precede indexed entries */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1076,6 +1238,9 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Removed entries may be indexed */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1430,6 +1595,9 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 {
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	/* Moved entries may be indexed */
+	clearSizeClassIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1482,6 +1650,9 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
+		if (recycled && _sizeClassIndexEnabled) {
+			clearSizeClassIndex();
+		}
 	} else {
 		MM_HeapLinkedFreeHeader  *currentFreeEntry = _heapFreeList;
 		MM_HeapLinkedFreeHeader  *next;
@@ -1498,6 +1669,9 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 			} else if ((void*)next > chunkBase) {
 				/* Insert chunk between current entry and next one */
 				recycled = recycleHeapChunk(chunkBase, chunkTop, currentFreeEntry, next);
+				if (recycled && _sizeClassIndexEnabled) {
+					updateSizeClassIndexBeyondEntry(currentFreeEntry);
+				}
 				break;
 			}
 
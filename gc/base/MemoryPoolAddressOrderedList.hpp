@@ -29,6 +29,8 @@
 #include "HeapRegionDescriptor.hpp"
 #include "EnvironmentBase.hpp"
 
+#define SIZE_CLASS_INDEX_COUNT (sizeof(uintptr_t) * 8)
+
 class MM_AllocateDescription;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 class MM_ConcurrentSweepScheme;
@@ -53,6 +55,10 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size class index support */
+	bool _sizeClassIndexEnabled; /**< True if _sizeClassIndex is maintained and used by allocation (see -Xgc:sizeClassFreeListIndex) */
+	MM_HeapLinkedFreeHeader *_sizeClassIndex[SIZE_CLASS_INDEX_COUNT]; /**< For each power of two size class, a free entry such that all entries up to and including it are smaller than the class (NULL to search from the head) */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -69,6 +75,11 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	void clearSizeClassIndex();
+	MM_HeapLinkedFreeHeader *findSizeClassIndexEntry(uintptr_t sizeClass);
+	void updateSizeClassIndex(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
+	void updateSizeClassIndexBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	void rebuildSizeClassIndex();
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
@@ -132,6 +143,11 @@ public:
 	virtual void mergeFreeEntryAllocateStats() {_largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeCountForVeryLargeEntries();}
 	
 	virtual bool initializeSweepPool(MM_EnvironmentBase *env);
+
+	/**
+	 * Rebuild the size class index once the free list has been rebuilt by a sweep or compaction.
+	 */
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
 	
 	/**
 	 * Recalculate the memory pool statistics by actually examining the contents of the pool.
@@ -148,6 +164,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -156,6 +173,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -229,6 +229,8 @@ void
 MM_MemorySubSpace::reportAllocationFailureStart(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription)
 {
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	/* the allocating thread stopped when it asked for exclusive access to collect */
+	env->setAllocationFailureStartTime(omrtime_hires_clock() - env->getExclusiveAccessTime());
 	generateAllocationFailureStats(env, allocDescription);
 
 	env->allocationFailureStartReportIfRequired(allocDescription, getTypeFlags());
@@ -281,6 +283,8 @@ void
 MM_MemorySubSpace::reportAllocationFailureEnd(MM_EnvironmentBase* env)
 {
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	_extensions->latencyStats.record(GC_LATENCY_ALLOCATION_FAILURE, omrtime_hires_delta(env->getAllocationFailureStartTime(), omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+
 	Trc_MM_AllocationFailureCycleEnd(env->getLanguageVMThread(),
 									 _extensions->heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_NEW),
 									 _extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW),
@@ -27,6 +27,7 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapResizeStats.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
@@ -746,6 +747,94 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 	}
 }
 
+/**
+ * Decide how much to expand or contract the nursery by to meet the -Xgc:heapSizingGCTimeRatio= and
+ * -Xgc:heapSizingMaxPause= goals, and store the result in _expansionSize or _contractionSize.
+ * Replaces the dynamic new space sizing time ratios when goal-driven heap sizing is enabled.
+ * @param scavengeTime length of the scavenge just completed, in milliseconds
+ * @param intervalTime time from the end of the previous scavenge to the end of this one, in milliseconds
+ */
+void
+MM_MemorySubSpaceSemiSpace::calculateGoalDrivenResize(MM_EnvironmentBase *env, uint64_t scavengeTime, uint64_t intervalTime)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_HeapResizeStats *resizeStats = extensions->heap->getResizeStats();
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	bool debug = extensions->debugDynamicNewSpaceSizing;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	/* Spaces have flipped, so the survivor space is the allocate space the mutator filled since the last scavenge */
+	uintptr_t allocateSize = _memorySubSpaceSurvivor->getActiveMemorySize();
+	uintptr_t survivedBytes = extensions->scavengerStats._flipBytes + extensions->scavengerStats._tenureAggregateBytes;
+	uint64_t mutatorTime = (intervalTime > scavengeTime) ? (intervalTime - scavengeTime) : 0;
+	resizeStats->updateScavengeHistory(allocateSize, survivedBytes, scavengeTime, mutatorTime);
+
+	float allocationRate = resizeStats->getAverageAllocationRate();
+	float survivalRate = resizeStats->getAverageSurvivalRate();
+	float averageScavengeMillis = resizeStats->getAverageScavengeMillis();
+	float copyRate = resizeStats->getAverageCopyRate();
+	if ((0 == allocateSize) || (0.0f == allocationRate) || (0.0f == averageScavengeMillis)) {
+		return;
+	}
+
+	/* A scavenge every allocateSize / allocationRate ms, each taking averageScavengeMillis, meets a target of
+	 * gcTimeRatio percent of time in scavenges with an allocate space of this size
+	 */
+	float targetPercentage = (float)extensions->heapSizingGCTimeRatio;
+	float desiredAllocateSize = (allocationRate * averageScavengeMillis * (100.0f - targetPercentage)) / targetPercentage;
+
+	/* Scavenge time is the time to copy what survives: an allocate space of S leaves survivalRate * S bytes
+	 * to copy at copyRate bytes/ms. Cap it at the size whose survivors can be copied within the pause goal
+	 */
+	if ((0 != extensions->heapSizingMaximumPause) && (0.0f < survivalRate) && (0.0f < copyRate)) {
+		float pauseAllocateSize = ((float)extensions->heapSizingMaximumPause * copyRate) / survivalRate;
+		desiredAllocateSize = OMR_MIN(desiredAllocateSize, pauseAllocateSize);
+	}
+
+	/* Change the whole nursery in proportion, within the dynamic new space sizing limits on each step */
+	float resizeFactor = (desiredAllocateSize / (float)allocateSize) - 1.0f;
+
+	if (debug) {
+		omrtty_printf("	Goal sizing allocRate:%lf survivalRate:%lf copyRate:%lf avgScav:%lf desiredAllocate:%zu factor:%lf\n",
+			(double)allocationRate, (double)survivalRate, (double)copyRate, (double)averageScavengeMillis, (uintptr_t)desiredAllocateSize, (double)resizeFactor);
+	}
+
+	if ((resizeFactor > SEMISPACE_GOAL_RESIZE_THRESHOLD) && (resizeFactor >= extensions->dnssMinimumExpansion)
+			&& (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+		double expansionFactor = OMR_MIN((double)resizeFactor, extensions->dnssMaximumExpansion);
+		uintptr_t expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(getCurrentSize() * expansionFactor));
+		expansionSize = MM_Math::roundToCeiling(regionSize, expansionSize);
+
+		/* the nursery is part of the heap the -Xgc:heapSizingCeiling= limits */
+		if (0 != extensions->heapSizingCeiling) {
+			uintptr_t heapSize = extensions->heap->getActiveMemorySize();
+			uintptr_t headroom = (heapSize < extensions->heapSizingCeiling) ? (extensions->heapSizingCeiling - heapSize) : 0;
+			expansionSize = MM_Math::roundToFloor(regionSize, OMR_MIN(expansionSize, headroom));
+		}
+
+		if ((0 != expansionSize) && canExpand(env, expansionSize)) {
+			_expansionSize = expansionSize;
+			resizeStats->setLastExpandReason(SCAV_RATIO_TOO_HIGH);
+			if (debug) {
+				omrtty_printf("	Goal expand decision - current size: %zu expanded size: %zu\n", getCurrentSize(), getCurrentSize() + _expansionSize);
+			}
+		}
+	} else if ((-resizeFactor > SEMISPACE_GOAL_RESIZE_THRESHOLD) && (-resizeFactor >= extensions->dnssMinimumContraction)
+			&& (NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+		double contractionFactor = OMR_MIN((double)-resizeFactor, extensions->dnssMaximumContraction);
+		uintptr_t contractionSize = MM_Math::roundToFloor(extensions->heapAlignment, (uintptr_t)(getCurrentSize() * contractionFactor));
+		contractionSize = MM_Math::roundToFloor(regionSize, contractionSize);
+
+		if ((0 != contractionSize) && canContract(env, contractionSize)) {
+			_contractionSize = contractionSize;
+			resizeStats->setLastContractReason(SCAV_RATIO_TOO_LOW);
+			if (debug) {
+				omrtty_printf("	Goal contract decision - current size: %zu contracted size: %zu\n", getCurrentSize(), getCurrentSize() - _contractionSize);
+			}
+		}
+	}
+}
+
 /**
  * Adjust the sub space memory by resizing the allocate and survivor space (expand or contract).
  */
@@ -808,7 +897,9 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 
 		_lastScavengeEndTime = extensions->scavengerStats._endTime;
 
-		if (doDynamicNewSpaceSizing) {
+		if (doDynamicNewSpaceSizing && extensions->isGoalDrivenHeapSizing()) {
+			calculateGoalDrivenResize(env, scavengeTime, intervalTime);
+		} else if (doDynamicNewSpaceSizing) {
 			double expectedTimeRatio = (extensions->dnssExpectedTimeRatioMaximum + extensions->dnssExpectedTimeRatioMinimum) / 2;
 
 			/* Find the ratio of time to scavenge versus the interval time since the last scavenge */
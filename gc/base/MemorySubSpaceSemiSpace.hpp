@@ -36,6 +36,8 @@ class MM_PhysicalSubArena;
 class MM_ObjectAllocationInterface;
 
 #define MODRON_SURVIVOR_SPACE_RATIO_DEFAULT 50
+/* goal-driven sizing leaves the nursery alone when it is within this fraction of the size its goals ask for */
+#define SEMISPACE_GOAL_RESIZE_THRESHOLD 0.05f
 
 /**
  * @todo Provide class documentation
@@ -91,6 +93,7 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	void calculateGoalDrivenResize(MM_EnvironmentBase *env, uint64_t scavengeTime, uint64_t intervalTime);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
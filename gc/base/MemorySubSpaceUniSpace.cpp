@@ -22,6 +22,9 @@
 #include "AllocateDescription.hpp"
 #include "Collector.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapResizeStats.hpp"
+#include "Math.hpp"
 #include "PhysicalSubArena.hpp"
 #include "MemorySpace.hpp"
 
@@ -81,6 +84,31 @@ MM_MemorySubSpaceUniSpace::performResize(MM_EnvironmentBase *env, MM_AllocateDes
 	} else if (_expansionSize != 0) {
 		resizeAmount = performExpand(env);
 	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (_releaseFreePagesOnResize) {
+		/* Goal-driven sizing found the heap larger than its goals require, so return the free pages it keeps to the OS */
+		_releaseFreePagesOnResize = false;
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t startTime = omrtime_hires_clock();
+		uintptr_t releasedBytes = releaseFreeMemoryPages(env);
+		uint64_t endTime = omrtime_hires_clock();
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			omrtime_hires_clock(),
+			J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+			HEAP_RELEASE_FREE_PAGES,
+			getTypeFlags(),
+			_extensions->heap->getResizeStats()->getRatioContractPercentage(),
+			releasedBytes,
+			getActiveMemorySize(),
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
+			1
+			);
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	
 	env->popVMstate(oldVMState);
 
@@ -94,7 +122,9 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(J9VMSTATE_GC_CHECK_RESIZE);
-	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
+	if (_extensions->isGoalDrivenHeapSizing()) {
+		timeForGoalDrivenResize(env, allocDescription, _systemGC);
+	} else if (!timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
 	env->popVMstate(oldVMState);
@@ -134,6 +164,142 @@ MM_MemorySubSpaceUniSpace::performExpand(MM_EnvironmentBase *env)
 	return actualExpandAmount;
 }
 
+/**
+ * Determine how much we should attempt to expand or contract the subspace by to meet the -Xgc:heapSizingGCTimeRatio=
+ * and -Xgc:heapSizingMaxPause= goals, and store the result in _expansionSize or _contractionSize.
+ * The -Xsoftmx (or -Xgc:heapSizingCeiling=), an allocation that can not be satisfied and -Xminf all take
+ * precedence over the goals, and the heap is sized by its free ratio until the collector can measure its gc time.
+ *
+ * @return true if expansion or contraction size is non zero
+ */
+bool
+MM_MemorySubSpaceUniSpace::timeForGoalDrivenResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC)
+{
+	MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+	uintptr_t activeMemorySize = getActiveMemorySize();
+	uintptr_t actualSoftMx = _extensions->heap->getActualSoftMxSize(env);
+
+	_expansionSize = 0;
+	_contractionSize = 0;
+
+	/* Above the ceiling we contract down to it whatever the goals say */
+	if ((0 != actualSoftMx) && (actualSoftMx < activeMemorySize)) {
+		return timeForHeapContract(env, allocDescription, systemGC);
+	}
+
+	/* Percentage of time being spent in GC. It is not rounded to a whole percent, as the collector's
+	 * getGCTimePercentage() is, so that goals of a percent or two can be compared against it
+	 */
+	float gcPercentage = resizeStats->calculateExactGCPercentage();
+
+	/* No gc time history yet so fall back to sizing by free ratio */
+	if (0.0f == gcPercentage) {
+		if (!timeForHeapContract(env, allocDescription, systemGC)) {
+			return timeForHeapExpand(env, allocDescription);
+		}
+		return true;
+	}
+
+	/* An allocation we can not satisfy, or less than -Xminf free, is handled as it would be without goals */
+	uintptr_t bytesRequired = 0;
+	bool expandToSatisfy = false;
+	if (NULL != allocDescription) {
+		bytesRequired = allocDescription->getBytesRequested();
+		expandToSatisfy = (env->getMemorySpace()->findLargestFreeEntry(env, allocDescription) < bytesRequired);
+	}
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	uintptr_t minimumFree = (activeMemorySize / _extensions->heapFreeMinimumRatioDivisor) * _extensions->heapFreeMinimumRatioMultiplier;
+	if (expandToSatisfy || (currentFree < (minimumFree + bytesRequired))) {
+		return timeForHeapExpand(env, allocDescription);
+	}
+
+	uintptr_t gcCount = 0;
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	gcCount = _extensions->globalGCStats.gcCount;
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+
+	float targetPercentage = (float)_extensions->heapSizingGCTimeRatio;
+	uintptr_t maximumPause = _extensions->heapSizingMaximumPause;
+	bool pauseGoalMissed = (0 != maximumPause) && resizeStats->isGlobalPauseHistoryValid()
+			&& (resizeStats->getAverageGlobalPauseMillis() > (float)maximumPause);
+
+	if ((gcPercentage > targetPercentage) && !pauseGoalMissed) {
+		/* Too much time in gc. Collections are about as frequent as free memory is small, so grow free memory
+		 * in proportion to how far we are from the goal. A larger heap lengthens pauses, so we do not grow
+		 * while the pause goal is being missed.
+		 */
+		if ((NULL == _physicalSubArena) || !_physicalSubArena->canExpand(env) || (0 == maxExpansionInSpace(env))) {
+			return false;
+		}
+		if ((resizeStats->getLastHeapExpansionGCCount() + _extensions->heapExpansionStabilizationCount) > gcCount) {
+			return false;
+		}
+
+		uintptr_t desiredFree = (uintptr_t)(((float)currentFree * gcPercentage) / targetPercentage);
+		uintptr_t expandSize = desiredFree - currentFree;
+		expandSize = adjustExpansionWithinFreeLimits(env, expandSize);
+		expandSize = adjustExpansionWithinUserIncrement(env, expandSize);
+		expandSize = adjustExpansionWithinSoftMax(env, expandSize, 0);
+		_expansionSize = MM_Math::roundToCeiling(_extensions->heapAlignment, expandSize);
+		if (0 != _expansionSize) {
+			resizeStats->setLastExpandReason(GC_RATIO_TOO_HIGH);
+		}
+		return 0 != _expansionSize;
+	}
+
+	/* Well under the gc time goal (the margin keeps us from oscillating about it), or missing the pause goal */
+	if ((gcPercentage < (targetPercentage * 0.5f)) || (pauseGoalMissed && (gcPercentage <= targetPercentage))) {
+		uintptr_t contractionSize = 0;
+		if (gcPercentage < targetPercentage) {
+			/* free memory we could give up and still spend no more than the goal in gc */
+			uintptr_t desiredFree = (uintptr_t)(((float)currentFree * gcPercentage) / targetPercentage);
+			desiredFree = OMR_MAX(desiredFree, minimumFree + bytesRequired);
+			if (desiredFree < currentFree) {
+				contractionSize = currentFree - desiredFree;
+			}
+		}
+		if (pauseGoalMissed) {
+			/* pause time grows with the heap, so shrink the heap by how far the average pause is over the goal */
+			uintptr_t pauseHeapSize = (uintptr_t)((float)activeMemorySize * ((float)maximumPause / resizeStats->getAverageGlobalPauseMillis()));
+			uintptr_t pauseContractionSize = OMR_MIN(activeMemorySize - pauseHeapSize, currentFree - (minimumFree + bytesRequired));
+			contractionSize = OMR_MAX(contractionSize, pauseContractionSize);
+		}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		/* whether or not we manage to contract, the free pages we keep are not needed */
+		_releaseFreePagesOnResize = true;
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
+		if ((NULL == _physicalSubArena) || !_physicalSubArena->canContract(env) || (0 == maxContraction(env))) {
+			return false;
+		}
+		if ((resizeStats->getLastHeapExpansionGCCount() + _extensions->heapContractionStabilizationCount) > gcCount) {
+			return false;
+		}
+		/* Don't shrink on a system GC if we had less than -Xminf free at its start */
+		if (systemGC && (resizeStats->getFreeBytesAtSystemGCStart() < minimumFree)) {
+			return false;
+		}
+
+		/* But we don't contract too quickly or by a trivial amount */
+		uintptr_t maxContract = (uintptr_t)(activeMemorySize * _extensions->globalMaximumContraction);
+		uintptr_t minContract = (uintptr_t)(activeMemorySize * _extensions->globalMinimumContraction);
+		maxContract = OMR_MAX(maxContract, _extensions->regionSize);
+		contractionSize = MM_Math::roundToFloor(_extensions->regionSize, OMR_MIN(contractionSize, maxContract));
+		if (contractionSize < minContract) {
+			contractionSize = 0;
+		}
+
+		_contractionSize = contractionSize;
+		if (0 != _contractionSize) {
+			resizeStats->setLastContractReason(GC_RATIO_TOO_LOW);
+		}
+		return 0 != _contractionSize;
+	}
+
+	return false;
+}
+
 /**
  * Determine how much we should attempt to contract heap by and call contract()
  * @return The amount we actually managed to contract the heap
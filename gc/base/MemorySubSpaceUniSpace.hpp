@@ -38,6 +38,10 @@
 class MM_MemorySubSpaceUniSpace : public MM_MemorySubSpace
 {
 protected:
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	bool _releaseFreePagesOnResize; /**< set by goal-driven sizing when the next resize should release free pages to the OS */
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	uintptr_t adjustExpansionWithinFreeLimits(MM_EnvironmentBase *env, uintptr_t expandSize);
 	uintptr_t adjustExpansionWithinSoftMax(MM_EnvironmentBase *env, uintptr_t expandSize, uintptr_t minimumBytesRequired);
 	uintptr_t checkForRatioExpand(MM_EnvironmentBase *env, uintptr_t bytesRequired);	
@@ -47,6 +51,7 @@ protected:
 	uintptr_t calculateTargetContractSize(MM_EnvironmentBase *env, uintptr_t allocSize, bool ratioContract);
 	bool timeForHeapContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC);
 	bool timeForHeapExpand(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);	
+	bool timeForGoalDrivenResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC);
 	uintptr_t performExpand(MM_EnvironmentBase *env);
 	uintptr_t performContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
@@ -61,6 +66,9 @@ public:
 		bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize, uintptr_t memoryFlags, uint32_t objectFlags)
 	:
 		MM_MemorySubSpace(env, NULL, physicalSubArena, usesGlobalCollector, minimumSize, initialSize, maximumSize, memoryFlags, objectFlags)
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		, _releaseFreePagesOnResize(false)
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PACKETDEQUE_HPP_)
+#define PACKETDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "Packet.hpp"
+
+/**
+ * Fixed capacity Chase-Lev work stealing deque of packets.
+ * The owning GC thread pushes and pops at the bottom without taking any lock, while
+ * other GC threads steal from the top using a single compare and swap.
+ * @ingroup GC_Base
+ */
+class MM_PacketDeque : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	enum {
+		_capacity = 64, /**< Maximum number of packets held in the deque (must be a power of two) */
+		_indexMask = _capacity - 1
+	};
+
+protected:
+private:
+	volatile uintptr_t _top; /**< Index of the next packet to be stolen */
+	uintptr_t _topPadding[7]; /**< Keep thieves and the owner on separate cache lines */
+	volatile uintptr_t _bottom; /**< Index of the next free slot at the owner end */
+	uintptr_t _victimSeed; /**< Owner private seed used to pick random steal victims */
+	MM_Packet *volatile _packets[_capacity];
+
+/* Methods */
+public:
+	/**
+	 * Push a packet on the owner end of the deque.  Only the owning thread may call this.
+	 * @param packet the packet to push
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) >= (uintptr_t)_capacity) {
+			return false;
+		}
+		_packets[bottom & _indexMask] = packet;
+		/* the slot must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop a packet from the owner end of the deque.  Only the owning thread may call this.
+	 * @return the most recently pushed packet, or NULL if the deque is empty
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation before reading top so a racing thief can not take the same slot */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		MM_Packet *packet = NULL;
+
+		if ((intptr_t)(bottom - top) > 0) {
+			/* more than one entry left - no thief can reach this slot */
+			packet = _packets[bottom & _indexMask];
+		} else if (bottom == top) {
+			/* last entry - race any thieves for it */
+			packet = _packets[bottom & _indexMask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+			_bottom = top + 1;
+		} else {
+			/* a thief emptied the deque */
+			_bottom = top;
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Attempt to steal a packet from the top of the deque.  May be called by any thread.
+	 * @return the oldest packet in the deque, or NULL if the deque was empty or the steal lost a race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readBarrier();
+		uintptr_t bottom = _bottom;
+
+		if ((intptr_t)(bottom - top) > 0) {
+			MM_Packet *packet = _packets[top & _indexMask];
+			if (top == MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				return packet;
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Answer whether the deque appears to hold any packets.  The answer may be stale by the time it is used.
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Pick the next victim to steal from using the owner private xorshift seed.
+	 * @param dequeCount the number of deques to choose from
+	 * @return an index in the range [0, dequeCount)
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t dequeCount)
+	{
+		uintptr_t seed = _victimSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_victimSeed = seed;
+		return seed % dequeCount;
+	}
+
+	/**
+	 * Create a PacketDeque object.
+	 * @param seed initial (non-zero) seed for victim selection
+	 */
+	MM_PacketDeque(uintptr_t seed) :
+		MM_BaseNonVirtual()
+		,_top(0)
+		,_bottom(0)
+		,_victimSeed(seed | 1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PACKETDEQUE_HPP_ */
@@ -29,8 +29,13 @@ MM_PacketList::initialize(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->packetListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	Assert_MM_true(0 < extensions->packetListSplit);
+	if (extensions->numaAwarePacketLists) {
+		_nodeCount = OMR_MAX(1, extensions->_numaManager.getAffinityLeaderCount());
+	}
+	/* every node gets the same number of sublists so the node of a sublist is simply its index divided by _sublistsPerNode */
+	_sublistsPerNode = (extensions->packetListSplit + _nodeCount - 1) / _nodeCount;
+	_sublistCount = _nodeCount * _sublistsPerNode;
 
 	_sublists = (struct PacketSublist *)extensions->getForge()->allocate(sizeof(struct PacketSublist) * _sublistCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -65,75 +70,107 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 void 
 MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
-	/* just push everything on the first list */
-	PacketSublist *list = &_sublists[0];
-	MM_Packet *current = head;
-	uintptr_t i;
-	
-	list->_lock.acquire();
-	
-	if (NULL == list->_head) {
-		list->_tail = tail;
+	if (1 == _nodeCount) {
+		/* without NUMA-aware lists just push everything on the first list */
+		PacketSublist *list = &_sublists[0];
+		MM_Packet *current = head;
+
+		list->_lock.acquire();
+
+		if (NULL == list->_head) {
+			list->_tail = tail;
+		} else {
+			list->_head->_previous = tail;
+		}
+		tail->_next = list->_head;
+		list->_head = head;
+		incrementCount(count);
+
+		for (uintptr_t i = 0; i < count; ++i) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+
+		list->_lock.release();
 	} else {
-		list->_head->_previous = tail;
-	}
-	tail->_next = list->_head;
-	list->_head = head;
-	incrementCount(count);
-	
-	for (i = 0; i < count; ++i) {
-		current->setSublistIndex(0);
-		current = current->_next;
-	}
+		/* spread the packets evenly over all of the sublists, and therefore all of the NUMA nodes, so that every node starts with packets of its own */
+		uintptr_t perSublist = (count + _sublistCount - 1) / _sublistCount;
+		MM_Packet *current = head;
+		uintptr_t remaining = count;
+
+		for (uintptr_t index = 0; (index < _sublistCount) && (0 < remaining); index++) {
+			PacketSublist *list = &_sublists[index];
+			uintptr_t chunkCount = OMR_MIN(perSublist, remaining);
+			MM_Packet *chunkHead = current;
+			MM_Packet *chunkTail = current;
+
+			chunkHead->_previous = NULL;
+			chunkHead->setSublistIndex(index);
+			for (uintptr_t i = 1; i < chunkCount; ++i) {
+				chunkTail = chunkTail->_next;
+				chunkTail->setSublistIndex(index);
+			}
+			current = chunkTail->_next;
+			remaining -= chunkCount;
+			Assert_MM_true((0 == remaining) == (chunkTail == tail));
 
-	list->_lock.release();
+			list->_lock.acquire();
+
+			if (NULL == list->_head) {
+				list->_tail = chunkTail;
+			} else {
+				list->_head->_previous = chunkTail;
+			}
+			chunkTail->_next = list->_head;
+			list->_head = chunkHead;
+			incrementCount(chunkCount);
+
+			list->_lock.release();
+		}
+	}
 }
 
 bool
 MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 {
-	bool didPop = false;
-	
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
 	
-	/* acquire all of our locks */
+	/* detach each sublist in turn so only one lock is held at a time */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
 		PacketSublist *list = &_sublists[i];
-		list->_lock.acquire();
-	}
+		MM_Packet *sublistHead = NULL;
+		MM_Packet *sublistTail = NULL;
+		uintptr_t sublistCount = 0;
 
-	/* accumulate all of the packets into a single list */
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		PacketSublist *list = &_sublists[i];
-	
 		if (NULL != list->_head) {
-			didPop = true;
+			list->_lock.acquire();
+			sublistHead = list->_head;
+			sublistTail = list->_tail;
+			for (MM_Packet *walk = sublistHead; NULL != walk; walk = walk->_next) {
+				sublistCount += 1;
+			}
+			list->_head = NULL;
+			list->_tail = NULL;
+			decrementCount(sublistCount);
+			list->_lock.release();
+		}
 
+		if (NULL != sublistHead) {
+			Assert_MM_true(NULL != sublistTail);
 			if (NULL == *head) {
-				*head = list->_head;
+				*head = sublistHead;
 			} else {
-				(*tail)->_next = list->_head;
+				(*tail)->_next = sublistHead;
+				sublistHead->_previous = *tail;
 			}
-			Assert_MM_true(NULL != list->_tail);
-			*tail = list->_tail;
-	
-			list->_head = NULL;
-			list->_tail = NULL;
+			*tail = sublistTail;
+			*count += sublistCount;
 		}
 	}
 	
-	*count = _count;
-	_count = 0;
-	
-	/* release all of our locks */
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		PacketSublist *list = &_sublists[i];
-		list->_lock.release();
-	}
-	
-	return didPop;
+	return (NULL != *head);
 }
 
 void
@@ -183,8 +220,24 @@ MM_PacketList::getHead()
 	uintptr_t count = 0;
 	
 	if (popList(&head, &tail, &count)) {
-		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		PacketSublist *list = &_sublists[0];
+		MM_Packet *current = head;
+
+		list->_lock.acquire();
+		while (NULL != current) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		if (NULL == list->_head) {
+			list->_tail = tail;
+		} else {
+			list->_head->_previous = tail;
+		}
+		tail->_next = list->_head;
+		list->_head = head;
+		incrementCount(count);
+		result = list->_head;
+		list->_lock.release();
 	}
 
 	return result;
@@ -49,6 +49,8 @@ private:
 	struct PacketSublist *_sublists;	/**< An array of PacketSublist structures which is _sublistCount elements long */
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA nodes the sublists are grouped by (1 if NUMA aware packet lists are disabled) */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists belonging to each NUMA node */
 	volatile uintptr_t _count;  /**< Number of items in the list */
 	
 /* Functionality Section */
@@ -96,7 +98,45 @@ private:
 	MMINLINE uintptr_t
 	getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return (getNodeIndex(env) * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
+	}
+
+	/**
+	 * Determine the NUMA node whose sublists the specified environment prefers.
+	 * GC threads are bound round-robin to the affinity leaders by slave ID.
+	 *
+	 * @param env the current environment
+	 *
+	 * @return a node index in the range [0, _nodeCount)
+	 */
+	MMINLINE uintptr_t
+	getNodeIndex(MM_EnvironmentBase *env)
+	{
+		return (1 == _nodeCount) ? 0 : (env->getSlaveID() % _nodeCount);
+	}
+
+	/**
+	 * Unlink the head of the specified sublist.
+	 * Must be called with the sublist lock held.
+	 *
+	 * @param list the sublist to pop from
+	 *
+	 * @return the packet removed, or NULL if the sublist was empty
+	 */
+	MMINLINE MM_Packet *
+	popSublist(PacketSublist *list)
+	{
+		MM_Packet *packet = list->_head;
+		if (NULL != packet) {
+			list->_head = packet->_next;
+			decrementCount(1);
+			if (NULL == list->_head) {
+				list->_tail = NULL;
+			} else {
+				list->_head->_previous = NULL;
+			}
+		}
+		return packet;
 	}
 		
 protected:
@@ -154,16 +194,23 @@ public:
 		incrementCount(1);
 		
 		list->_lock.release();
+
+		if (1 < _nodeCount) {
+			env->_workPacketStats.recordNUMANodePush(index / _sublistsPerNode);
+		}
 	}
 	
 	/**
 	 * Pop a packet off of the packetList.
+	 * The sublists of the caller's NUMA node are searched first; the sublists of other
+	 * nodes are only searched once all of the local sublists are empty.
 	 *
 	 * @return packet The packet to put on the list
 	 */
 	MMINLINE MM_Packet *pop(MM_EnvironmentBase *env)
 	{
 		uintptr_t index = getSublistIndex(env);
+		uintptr_t homeNode = index / _sublistsPerNode;
 		MM_Packet *packet = NULL;
 
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -171,24 +218,24 @@ public:
 
 			if (NULL != list->_head) {
 				list->_lock.acquire();
-				if (NULL != list->_head) {
-					packet = list->_head;
-					list->_head = packet->_next;
-					decrementCount(1);
-					if (NULL == list->_head) {
-						list->_tail = NULL;
-					} else {
-						list->_head->_previous = NULL;
-					}		
-				}
+				packet = popSublist(list);
 				list->_lock.release();
 
 				if (NULL != packet) {
 					break;
 				}
 			}
-			
-			index = (index + 1) %  _sublistCount;
+
+			/* walk the remaining sublists of the current node before moving on to the next node */
+			uintptr_t nodeBase = index - (index % _sublistsPerNode);
+			index = nodeBase + (((index - nodeBase) + 1) % _sublistsPerNode);
+			if (0 == ((i + 1) % _sublistsPerNode)) {
+				index = (nodeBase + _sublistsPerNode) % _sublistCount;
+			}
+		}
+
+		if ((NULL != packet) && (1 < _nodeCount)) {
+			env->_workPacketStats.recordNUMANodePop(homeNode, homeNode != (index / _sublistsPerNode));
 		}
 
 		return packet;
@@ -230,6 +277,8 @@ public:
 		MM_BaseNonVirtual()
 		,_sublists(NULL)
 		,_sublistCount(0)
+		,_nodeCount(1)
+		,_sublistsPerNode(0)
 		,_count(0)
 	{
 		_typeId = __FUNCTION__;
@@ -74,6 +74,16 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	/* Enviroment initialization specific for GC threads (after slave ID is set) */
 	env->initializeGCThread();
 
+	if (extensions->numaAwarePacketLists && extensions->_numaManager.isPhysicalNUMASupported()) {
+		/* bind the thread to the node whose packet list sublists it prefers (see MM_PacketList::getNodeIndex) */
+		uintptr_t affinityLeaderCount = 0;
+		J9MemoryNodeDetail const *affinityLeaders = extensions->_numaManager.getAffinityLeaders(&affinityLeaderCount);
+		if (0 < affinityLeaderCount) {
+			uintptr_t j9NodeNumber = affinityLeaders[slaveID % affinityLeaderCount].j9NodeNumber;
+			env->setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+
 	/* Signal that the thread was created succesfully */
 	slaveInfo->slaveFlags = SLAVE_INFO_FLAG_OK;
 
@@ -448,10 +458,13 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 		 * a GC cycle. It may not be safe to do so at the beginning of a task
 		 */	
 		recomputeActiveThreadCount(env);
+		/* Don't wake more threads than the task has asked for */
+		_activeThreadCount = OMR_MAX((uintptr_t)1, OMR_MIN(_activeThreadCount, task->getRecommendedThreadCount()));
 	}
 
 	task->setThreadCount(_activeThreadCount);
 	task->setSynchronizeMutex(_synchronizeMutex);
+	task->setSynchronizeBarrier(_synchronizeBarrier);
 	
 	for(uintptr_t index=0; index < _activeThreadCount; index++) {
 		_statusTable[index] = slave_status_reserved;
@@ -35,6 +35,7 @@
 #include "GCExtensionsBase.hpp"
 
 class MM_EnvironmentBase;
+class MM_TreeBarrier;
 
 class MM_ParallelDispatcher : public MM_Dispatcher
 {
@@ -65,6 +66,7 @@ protected:
 	/* Task as they are dispatched.  For now, since there is only one task active at any time, a */
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
+	MM_TreeBarrier *_synchronizeBarrier; /**< when set, tasks synchronize their threads through this barrier rather than the synchronize mutex */
 	
 	bool _slaveThreadsReservedForGC;  /**< States whether or not the slave threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
@@ -137,6 +139,7 @@ public:
 		,_slaveThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
+		,_synchronizeBarrier(NULL)
 		,_slaveThreadsReservedForGC(false)
 		,_inShutdown(false)
 		,_threadCountMaximum(1)
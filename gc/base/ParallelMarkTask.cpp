@@ -26,6 +26,7 @@
 #include "ParallelMarkTask.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "GlobalGCStats.hpp"
 #include "WorkStack.hpp"
@@ -42,12 +43,21 @@ MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
 	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
 
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
 	_markingScheme->markLiveObjectsInit(env, _initMarkMap);
+
+	uint64_t rootsStartTime = omrtime_hires_clock();
 	_markingScheme->markLiveObjectsRoots(env);
+	env->getExtensions()->latencyStats.record(GC_LATENCY_ROOTS, omrtime_hires_delta(rootsStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+
 	_markingScheme->markLiveObjectsScan(env);
 	_markingScheme->markLiveObjectsComplete(env);
 
 	env->_workStack.flush(env);
+
+	/* thread stats are cleared in setup, so they hold this task's stalls */
+	addIdleTicks(env->_workPacketStats.getStallTime() + env->_markStats.getStallTime());
 }
 
 void
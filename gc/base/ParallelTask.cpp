@@ -26,6 +26,7 @@
 #include "AtomicOperations.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
+#include "TreeBarrier.hpp"
 
 #include "ModronAssertions.h"
 
@@ -72,7 +73,23 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	Trc_MM_SynchronizeGCThreads_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 	
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && (NULL != _synchronizeBarrier)) {
+		uintptr_t slaveID = env->getSlaveID();
+		const char *reachedID = NULL;
+		uintptr_t reachedWorkUnitIndex = 0;
+
+		_synchronizeBarrier->arrive(slaveID, _totalThreadCount, id, env->getWorkUnitIndex(), &reachedID, &reachedWorkUnitIndex);
+		Assert_GC_true_with_message4(env, reachedID == id,
+			"%s at %p from synchronizeGCThreads: call from (%s), other threads at (%s)\n", getBaseVirtualTypeId(), this, id, reachedID);
+		Assert_GC_true_with_message4(env, reachedWorkUnitIndex == env->getWorkUnitIndex(),
+			"%s at %p from synchronizeGCThreads: call with syncPointWorkUnitIndex %zu, other threads at %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), reachedWorkUnitIndex);
+
+		if (0 == slaveID) {
+			_synchronizeBarrier->release(slaveID, _totalThreadCount);
+		} else {
+			_synchronizeBarrier->waitForRelease(slaveID, _totalThreadCount);
+		}
+	} else if(1 < _totalThreadCount) {
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -114,7 +131,10 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, c
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && (NULL != _synchronizeBarrier)) {
+		/* The master is thread 0, the root of the barrier, so it is the last to see every thread arrive */
+		isMasterThread = arriveAndReleaseRoot(env, id, "synchronizeGCThreadsAndReleaseMaster");
+	} else if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 
 		omrthread_monitor_enter(_synchronizeMutex);
@@ -169,7 +189,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
-	if(1 < _totalThreadCount) {
+	if ((1 < _totalThreadCount) && (NULL != _synchronizeBarrier)) {
+		isReleasedThread = arriveAndReleaseRoot(env, id, "synchronizeGCThreadsAndReleaseSingleThread");
+	} else if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
 
@@ -219,6 +241,11 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message2(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
+	if (NULL != _synchronizeBarrier) {
+		/* only the root of the barrier is released from a synchronize, so it releases the others */
+		_synchronizeBarrier->release(env->getSlaveID(), _totalThreadCount);
+		return;
+	}
 	omrthread_monitor_enter(_synchronizeMutex);
 	_synchronizeCount = 0;
 	_synchronizeIndex += 1;
@@ -240,6 +267,21 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 		_threadCount -= 1;
 		MM_Task::complete(env);
 		
+	} else if (NULL != _synchronizeBarrier) {
+		uintptr_t slaveID = env->getSlaveID();
+		const char *reachedID = NULL;
+		uintptr_t reachedWorkUnitIndex = 0;
+
+		MM_AtomicOperations::subtract(&_threadCount, 1);
+		MM_Task::complete(env);
+
+		/* Synchronization on exit - the master, at the root of the barrier, returns once every thread is done
+		 * with the task, so that it can delete the task.  Other threads must not touch the task once they arrive.
+		 * The work unit index is not checked, as an aborted MM_ParallelScrubCardTableTask leaves it unpredictable.
+		 */
+		_synchronizeBarrier->arrive(slaveID, _totalThreadCount, id, 0, &reachedID, &reachedWorkUnitIndex);
+		Assert_GC_true_with_message3(env, reachedID == id,
+			"%s at %p from complete: reach end of the task however threads are waiting at (%s)\n", getBaseVirtualTypeId(), this, reachedID);
 	} else {
 		omrthread_monitor_enter(_synchronizeMutex);
 
@@ -279,6 +321,35 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	}
 }
 
+/**
+ * Synchronize through the barrier, releasing only thread 0 (the root of the barrier) once every thread has
+ * arrived.  The other threads wait until releaseSynchronizedGCThreads() is called.
+ * @return true if the calling thread was released
+ */
+bool
+MM_ParallelTask::arriveAndReleaseRoot(MM_EnvironmentBase *env, const char *id, const char *caller)
+{
+	uintptr_t slaveID = env->getSlaveID();
+	const char *reachedID = NULL;
+	uintptr_t reachedWorkUnitIndex = 0;
+	bool isReleasedThread = false;
+
+	_synchronizeBarrier->arrive(slaveID, _totalThreadCount, id, env->getWorkUnitIndex(), &reachedID, &reachedWorkUnitIndex);
+	Assert_GC_true_with_message4(env, reachedID == id,
+		"%s at %p from %s: other threads at (%s)\n", getBaseVirtualTypeId(), this, caller, reachedID);
+	Assert_GC_true_with_message4(env, reachedWorkUnitIndex == env->getWorkUnitIndex(),
+		"%s at %p from %s: other threads at syncPointWorkUnitIndex %zu\n", getBaseVirtualTypeId(), this, caller, reachedWorkUnitIndex);
+
+	if (0 == slaveID) {
+		_synchronized = true;
+		isReleasedThread = true;
+	} else {
+		_synchronizeBarrier->waitForRelease(slaveID, _totalThreadCount);
+	}
+
+	return isReleasedThread;
+}
+
 /**
  * Return true if threads are currently syncronized, false otherwise
  * @return true if threads are currently syncronized, false otherwise
@@ -32,6 +32,7 @@
 #include "Task.hpp"
 
 class MM_EnvironmentBase;
+class MM_TreeBarrier;
 
 /**
  * @todo Provide class documentation
@@ -55,11 +56,15 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	MM_TreeBarrier *_synchronizeBarrier; /**< when set, threads synchronize through this barrier rather than the synchronize mutex */
 public:
 	
 	/*
 	 * Function members
 	 */
+private:
+	bool arriveAndReleaseRoot(MM_EnvironmentBase *env, const char *id, const char *caller);
+
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -70,6 +75,7 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
+	MMINLINE virtual void setSynchronizeBarrier(MM_TreeBarrier *synchronizeBarrier) { _synchronizeBarrier = synchronizeBarrier; }
 	virtual void complete(MM_EnvironmentBase *env);
 
 	/**
@@ -97,6 +103,7 @@ public:
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_synchronizeBarrier(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
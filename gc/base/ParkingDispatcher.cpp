@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Task.hpp"
+#include "TreeBarrier.hpp"
+
+#include "ParkingDispatcher.hpp"
+
+MM_ParkingDispatcher *
+MM_ParkingDispatcher::newInstance(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize)
+{
+	MM_ParkingDispatcher *dispatcher;
+
+	dispatcher = (MM_ParkingDispatcher *)env->getForge()->allocate(sizeof(MM_ParkingDispatcher), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (dispatcher) {
+		new(dispatcher) MM_ParkingDispatcher(env, handler, handler_arg, defaultOSStackSize);
+		if(!dispatcher->initialize(env)) {
+			dispatcher->kill(env);
+			return NULL;
+		}
+	}
+	return dispatcher;
+}
+
+bool
+MM_ParkingDispatcher::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelDispatcher::initialize(env)) {
+		return false;
+	}
+
+	_parkingSlots = (MM_DispatcherParkingSlot *)env->getForge()->allocate(_threadCountMaximum * sizeof(MM_DispatcherParkingSlot), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _parkingSlots) {
+		return false;
+	}
+	memset(_parkingSlots, 0, _threadCountMaximum * sizeof(MM_DispatcherParkingSlot));
+
+	for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+		if (0 != omrthread_monitor_init_with_name(&_parkingSlots[index].monitor, 0, "MM_ParkingDispatcher::parkingSlot")) {
+			return false;
+		}
+	}
+
+	_synchronizeBarrier = MM_TreeBarrier::newInstance(env, _threadCountMaximum);
+	if (NULL == _synchronizeBarrier) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_ParkingDispatcher::kill(MM_EnvironmentBase *env)
+{
+	if (NULL != _parkingSlots) {
+		for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+			if (NULL != _parkingSlots[index].monitor) {
+				omrthread_monitor_destroy(_parkingSlots[index].monitor);
+			}
+		}
+		env->getForge()->free(_parkingSlots);
+		_parkingSlots = NULL;
+	}
+	if (NULL != _synchronizeBarrier) {
+		_synchronizeBarrier->kill(env);
+		_synchronizeBarrier = NULL;
+	}
+
+	MM_ParallelDispatcher::kill(env);
+}
+
+void
+MM_ParkingDispatcher::park(uintptr_t slaveID)
+{
+	MM_DispatcherParkingSlot *slot = &_parkingSlots[slaveID];
+
+	omrthread_monitor_enter(slot->monitor);
+	while (!slot->unparked) {
+		omrthread_monitor_wait(slot->monitor);
+	}
+	slot->unparked = false;
+	omrthread_monitor_exit(slot->monitor);
+}
+
+void
+MM_ParkingDispatcher::unpark(uintptr_t slaveID)
+{
+	MM_DispatcherParkingSlot *slot = &_parkingSlots[slaveID];
+
+	omrthread_monitor_enter(slot->monitor);
+	slot->unparked = true;
+	omrthread_monitor_notify(slot->monitor);
+	omrthread_monitor_exit(slot->monitor);
+}
+
+void
+MM_ParkingDispatcher::wakeChildren(uintptr_t slaveID)
+{
+	uintptr_t wakeCount = _wakeCount;
+	uintptr_t firstChild = (2 * slaveID) + 1;
+
+	for (uintptr_t child = firstChild; (child < (firstChild + 2)) && (child < wakeCount); child++) {
+		unpark(child);
+	}
+}
+
+/**
+ * Run the main loop for a slave thread.  The thread only touches its own status and task table entries,
+ * so it does not need the slave thread mutex to accept or complete a task.  Tasks are only dispatched
+ * and threads only marked dying once every thread has completed the previous task.
+ */
+void
+MM_ParkingDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
+{
+	uintptr_t slaveID = env->getSlaveID();
+
+	setThreadInitializationComplete(env);
+
+	while (true) {
+		park(slaveID);
+
+		/* Pass the wakeup on first, so that it fans out across the tree while this thread starts its task.
+		 * A thread can be unparked with nothing to do (it was unparked again while finishing a task) in
+		 * which case its children find nothing to do either and park again.
+		 */
+		wakeChildren(slaveID);
+
+		uintptr_t status = _statusTable[slaveID];
+		if (slave_status_dying == status) {
+			break;
+		}
+		if (slave_status_reserved == status) {
+			acceptTask(env);
+			env->_currentTask->run(env);
+			completeTask(env);
+		}
+	}
+}
+
+/**
+ * Wake the first <code>count</code> threads through the wakeup tree.  The caller has already set their status
+ * and task, which the unpark publishes to them.
+ */
+void
+MM_ParkingDispatcher::wakeUpThreads(uintptr_t count)
+{
+	/* Shutdown passes the number of slave threads, which does not include the master's slot */
+	_wakeCount = _inShutdown ? _threadCountMaximum : count;
+	wakeChildren(0);
+}
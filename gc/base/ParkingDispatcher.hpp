@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PARKING_DISPATCHER_HPP_)
+#define PARKING_DISPATCHER_HPP_
+
+#include "omrcfg.h"
+
+#include "modronopt.h"
+#include "modronbase.h"
+
+#include "ParallelDispatcher.hpp"
+
+class MM_EnvironmentBase;
+
+#define PARKING_SLOT_SIZE 128
+
+/**
+ * The monitor a slave thread parks on between tasks.  Slots are padded to a cache line so that
+ * unparking one thread does not disturb the threads beside it.
+ */
+typedef struct MM_DispatcherParkingSlot {
+	omrthread_monitor_t monitor; /**< the slave waits on this monitor while parked */
+	volatile bool unparked; /**< set to release the slave, cleared by the slave as it leaves the slot */
+	uint8_t padding[PARKING_SLOT_SIZE - sizeof(omrthread_monitor_t) - sizeof(bool)];
+} MM_DispatcherParkingSlot;
+
+/**
+ * A dispatcher that parks each slave thread on a monitor of its own, rather than on the shared slave thread mutex.
+ * Waking threads for a task fans out as a binary tree: the master unparks threads 1 and 2, and each thread
+ * unparks its own two children before accepting its task, so that every thread is running after log2(n) wakeups
+ * and no thread contends on a shared monitor to start or finish its task.
+ * Tasks synchronize their threads, and wait for them to complete, through an MM_TreeBarrier arranged the same way.
+ * Selected with -Xgc:parkingDispatcher.
+ */
+class MM_ParkingDispatcher : public MM_ParallelDispatcher
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_DispatcherParkingSlot *_parkingSlots; /**< a parking slot per slave thread, indexed by slave ID */
+	volatile uintptr_t _wakeCount; /**< threads with a slave ID below this are woken by the current wakeup */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Wait until the slave thread is unparked.
+	 * @param slaveID the parked thread
+	 */
+	void park(uintptr_t slaveID);
+
+	/**
+	 * Release a parked slave thread, or one about to park, from its slot.
+	 * @param slaveID the thread to unpark
+	 */
+	void unpark(uintptr_t slaveID);
+
+	/**
+	 * Pass the current wakeup on to a thread's children in the wakeup tree.
+	 * @param slaveID the thread that was woken
+	 */
+	void wakeChildren(uintptr_t slaveID);
+
+protected:
+	virtual void slaveEntryPoint(MM_EnvironmentBase *env);
+	virtual void wakeUpThreads(uintptr_t count);
+
+	bool initialize(MM_EnvironmentBase *env);
+
+public:
+	static MM_ParkingDispatcher *newInstance(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	MM_ParkingDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize) :
+		MM_ParallelDispatcher(env, handler, handler_arg, defaultOSStackSize)
+		,_parkingSlots(NULL)
+		,_wakeCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PARKING_DISPATCHER_HPP_ */
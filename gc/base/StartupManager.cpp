@@ -33,19 +33,85 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCPARALLEL_SLIDING_COMPACT "-Xgc:parallelSlidingCompact"
+#define OMR_XGCPARALLEL_SLIDING_COMPACT_LENGTH 27
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCAVENGER_PREFETCH_DISTANCE "-Xgc:scavengerPrefetchDistance="
+#define OMR_XGCSCAVENGER_PREFETCH_DISTANCE_LENGTH 31
+#define OMR_XGCSCAVENGER_HOT_FIELD_COPY_ORDER "-Xgc:scavengerHotFieldCopyOrder"
+#define OMR_XGCSCAVENGER_HOT_FIELD_COPY_ORDER_LENGTH 31
+#define OMR_XGCSCAVENGER_HOT_FIELD_COPY_DEPTH "-Xgc:scavengerHotFieldCopyDepth="
+#define OMR_XGCSCAVENGER_HOT_FIELD_COPY_DEPTH_LENGTH 32
+#define OMR_XGCSCAVENGER_CARD_MARKING "-Xgc:scavengerCardMarking"
+#define OMR_XGCSCAVENGER_CARD_MARKING_LENGTH 25
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCASYNC_LOGGING_BUFFERS "-Xgc:asyncLoggingBuffers="
+#define OMR_XGCASYNC_LOGGING_BUFFERS_LENGTH 25
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING_STALL_WHEN_FULL "-Xgc:asyncLoggingStallWhenFull"
+#define OMR_XGCASYNC_LOGGING_STALL_WHEN_FULL_LENGTH 30
+#define OMR_XGCVERBOSE_BINARY_FORMAT "-Xgc:verboseBinaryFormat"
+#define OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH 24
+#define OMR_XGCHEAP_SIZING_GC_TIME_RATIO "-Xgc:heapSizingGCTimeRatio="
+#define OMR_XGCHEAP_SIZING_GC_TIME_RATIO_LENGTH 27
+#define OMR_XGCHEAP_SIZING_MAX_PAUSE "-Xgc:heapSizingMaxPause="
+#define OMR_XGCHEAP_SIZING_MAX_PAUSE_LENGTH 24
+#define OMR_XGCHEAP_SIZING_CEILING "-Xgc:heapSizingCeiling="
+#define OMR_XGCHEAP_SIZING_CEILING_LENGTH 23
+#define OMR_XGCADAPTIVE_GC_THREADING_MINIMUM_WORK "-Xgc:adaptiveGCThreadingMinimumWork="
+#define OMR_XGCADAPTIVE_GC_THREADING_MINIMUM_WORK_LENGTH 36
+#define OMR_XGCADAPTIVE_GC_THREADING "-Xgc:adaptiveGCThreading"
+#define OMR_XGCADAPTIVE_GC_THREADING_LENGTH 24
+#define OMR_XGCNO_ADAPTIVE_GC_THREADING "-Xgc:noAdaptiveGCThreading"
+#define OMR_XGCNO_ADAPTIVE_GC_THREADING_LENGTH 26
+#define OMR_XGCPARKING_DISPATCHER "-Xgc:parkingDispatcher"
+#define OMR_XGCPARKING_DISPATCHER_LENGTH 22
+#define OMR_XGCNO_PARKING_DISPATCHER "-Xgc:noParkingDispatcher"
+#define OMR_XGCNO_PARKING_DISPATCHER_LENGTH 24
+#define OMR_XGCTRANSPARENT_HUGE_PAGES "-Xgc:transparentHugePages"
+#define OMR_XGCTRANSPARENT_HUGE_PAGES_LENGTH 25
+#define OMR_XGCNO_TRANSPARENT_HUGE_PAGES "-Xgc:noTransparentHugePages"
+#define OMR_XGCNO_TRANSPARENT_HUGE_PAGES_LENGTH 27
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORK_STEALING_PACKETS "-Xgc:workStealingPackets"
+#define OMR_XGCWORK_STEALING_PACKETS_LENGTH 24
+#define OMR_XGCNUMA_AWARE_PACKET_LISTS "-Xgc:numaAwarePacketLists"
+#define OMR_XGCNUMA_AWARE_PACKET_LISTS_LENGTH 25
+#define OMR_XGCFVTEST_SIMULATE_NUMA_NODES "-Xgc:fvtest_simulateNUMANodes="
+#define OMR_XGCFVTEST_SIMULATE_NUMA_NODES_LENGTH 30
+#define OMR_XGCSIZE_CLASS_FREE_LIST_INDEX "-Xgc:sizeClassFreeListIndex"
+#define OMR_XGCSIZE_CLASS_FREE_LIST_INDEX_LENGTH 27
+#define OMR_XGCBACKGROUND_MARK_MAP_CLEAR "-Xgc:backgroundMarkMapClear"
+#define OMR_XGCBACKGROUND_MARK_MAP_CLEAR_LENGTH 27
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+#define OMR_XGCTLH_ADAPTIVE_SIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLH_ADAPTIVE_SIZING_LENGTH 22
+#define OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL "-Xgc:tlhAdaptiveRefreshInterval="
+#define OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL_LENGTH 32
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCARD_CLEANING_MAX_RUN_LENGTH "-Xgc:cardCleaningMaxRunLength="
+#define OMR_XGCCARD_CLEANING_MAX_RUN_LENGTH_LENGTH 30
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCSEGREGATED_CONCURRENT_SWEEP "-Xgc:segregatedConcurrentSweep"
+#define OMR_XGCSEGREGATED_CONCURRENT_SWEEP_LENGTH 30
+#define OMR_XGCSEGREGATED_LOCK_FREE_REGION_LISTS "-Xgc:segregatedLockFreeRegionLists"
+#define OMR_XGCSEGREGATED_LOCK_FREE_REGION_LISTS_LENGTH 34
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -170,6 +236,12 @@ MM_StartupManager::parseGcOptions(MM_GCExtensionsBase *extensions)
 		} while (true);
 	}
 
+	if (result && extensions->verboseBinaryFormat && extensions->asyncLogging) {
+		/* the binary writer has no asynchronous variant, so one of the two would be silently ignored */
+		omrtty_printf("Error parsing OMR GC options: '%s' and '%s' cannot be used together\n", OMR_XGCVERBOSE_BINARY_FORMAT, OMR_XGCASYNC_LOGGING);
+		result = false;
+	}
+
 	if (result) {
 		result = parseLanguageOptions(extensions);
 	}
@@ -260,6 +332,9 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCPARALLEL_SLIDING_COMPACT, OMR_XGCPARALLEL_SLIDING_COMPACT_LENGTH)) {
+		extensions->parallelSlidingCompact = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -272,6 +347,155 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFERS, OMR_XGCASYNC_LOGGING_BUFFERS_LENGTH)) {
+		uintptr_t bufferCount = 0;
+		/* a full buffer is handed to the drain thread before the next is claimed, so at least two are needed */
+		if ((0 >= getUDATAValue(option + OMR_XGCASYNC_LOGGING_BUFFERS_LENGTH, &bufferCount)) || (2 > bufferCount)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferCount = bufferCount;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		uintptr_t bufferSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &bufferSize) || (0 == bufferSize)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferSize = bufferSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_STALL_WHEN_FULL, OMR_XGCASYNC_LOGGING_STALL_WHEN_FULL_LENGTH)) {
+		extensions->asyncLoggingStallWhenFull = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_BINARY_FORMAT, OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH)) {
+		extensions->verboseBinaryFormat = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_GC_THREADING_MINIMUM_WORK, OMR_XGCADAPTIVE_GC_THREADING_MINIMUM_WORK_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCADAPTIVE_GC_THREADING_MINIMUM_WORK_LENGTH, &extensions->adaptiveGCThreadingMinimumWork)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_GC_THREADING, OMR_XGCADAPTIVE_GC_THREADING_LENGTH)) {
+		extensions->adaptiveGCThreading = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_ADAPTIVE_GC_THREADING, OMR_XGCNO_ADAPTIVE_GC_THREADING_LENGTH)) {
+		extensions->adaptiveGCThreading = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCPARKING_DISPATCHER, OMR_XGCPARKING_DISPATCHER_LENGTH)) {
+		extensions->parkingDispatcher = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_PARKING_DISPATCHER, OMR_XGCNO_PARKING_DISPATCHER_LENGTH)) {
+		extensions->parkingDispatcher = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCTRANSPARENT_HUGE_PAGES, OMR_XGCTRANSPARENT_HUGE_PAGES_LENGTH)) {
+		extensions->useTransparentHugePages = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_TRANSPARENT_HUGE_PAGES, OMR_XGCNO_TRANSPARENT_HUGE_PAGES_LENGTH)) {
+		extensions->useTransparentHugePages = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_SIZING_GC_TIME_RATIO, OMR_XGCHEAP_SIZING_GC_TIME_RATIO_LENGTH)) {
+		uintptr_t gcTimeRatio = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_SIZING_GC_TIME_RATIO_LENGTH, &gcTimeRatio)) || (0 == gcTimeRatio) || (100 <= gcTimeRatio)) {
+			result = false;
+		} else {
+			extensions->heapSizingGCTimeRatio = gcTimeRatio;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_SIZING_MAX_PAUSE, OMR_XGCHEAP_SIZING_MAX_PAUSE_LENGTH)) {
+		uintptr_t maximumPause = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_SIZING_MAX_PAUSE_LENGTH, &maximumPause)) || (0 == maximumPause)) {
+			result = false;
+		} else {
+			extensions->heapSizingMaximumPause = maximumPause;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_SIZING_CEILING, OMR_XGCHEAP_SIZING_CEILING_LENGTH)) {
+		uintptr_t ceiling = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCHEAP_SIZING_CEILING_LENGTH, &ceiling) || (0 == ceiling)) {
+			result = false;
+		} else {
+			extensions->heapSizingCeiling = ceiling;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCWORK_STEALING_PACKETS, OMR_XGCWORK_STEALING_PACKETS_LENGTH)) {
+		extensions->workStealingPackets = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNUMA_AWARE_PACKET_LISTS, OMR_XGCNUMA_AWARE_PACKET_LISTS_LENGTH)) {
+		extensions->numaAwarePacketLists = true;
+		extensions->_numaManager.shouldEnablePhysicalNUMA(true);
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZE_CLASS_FREE_LIST_INDEX, OMR_XGCSIZE_CLASS_FREE_LIST_INDEX_LENGTH)) {
+		extensions->sizeClassFreeListIndex = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBACKGROUND_MARK_MAP_CLEAR, OMR_XGCBACKGROUND_MARK_MAP_CLEAR_LENGTH)) {
+		extensions->backgroundMarkMapClear = true;
+	}
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	else if (0 == strncmp(option, OMR_XGCTLH_ADAPTIVE_SIZING, OMR_XGCTLH_ADAPTIVE_SIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL, OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL_LENGTH)) {
+		uintptr_t refreshInterval = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLH_ADAPTIVE_REFRESH_INTERVAL_LENGTH, &refreshInterval)) || (0 == refreshInterval)) {
+			result = false;
+		} else {
+			extensions->tlhAdaptiveRefreshInterval = refreshInterval;
+		}
+	}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCARD_CLEANING_MAX_RUN_LENGTH, OMR_XGCCARD_CLEANING_MAX_RUN_LENGTH_LENGTH)) {
+		uintptr_t maxRunLength = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCARD_CLEANING_MAX_RUN_LENGTH_LENGTH, &maxRunLength)) || (0 == maxRunLength)) {
+			result = false;
+		} else {
+			extensions->cardCleaningMaxRunLength = maxRunLength;
+		}
+	}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_CONCURRENT_SWEEP, OMR_XGCSEGREGATED_CONCURRENT_SWEEP_LENGTH)) {
+		extensions->segregatedConcurrentSweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_LOCK_FREE_REGION_LISTS, OMR_XGCSEGREGATED_LOCK_FREE_REGION_LISTS_LENGTH)) {
+		extensions->segregatedLockFreeRegionLists = true;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+	else if (0 == strncmp(option, OMR_XGCFVTEST_SIMULATE_NUMA_NODES, OMR_XGCFVTEST_SIMULATE_NUMA_NODES_LENGTH)) {
+		uintptr_t simulatedNodeCount = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCFVTEST_SIMULATE_NUMA_NODES_LENGTH, &simulatedNodeCount)) {
+			result = false;
+		} else {
+			extensions->_numaManager.setSimulatedNodeCountForFVTest(simulatedNodeCount);
+		}
+	}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_PREFETCH_DISTANCE, OMR_XGCSCAVENGER_PREFETCH_DISTANCE_LENGTH)) {
+		uintptr_t prefetchDistance = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGER_PREFETCH_DISTANCE_LENGTH, &prefetchDistance)) || (MAXIMUM_SCAVENGER_PREFETCH_DISTANCE < prefetchDistance)) {
+			result = false;
+		} else {
+			extensions->scavengerPrefetchDistance = prefetchDistance;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HOT_FIELD_COPY_DEPTH, OMR_XGCSCAVENGER_HOT_FIELD_COPY_DEPTH_LENGTH)) {
+		uintptr_t hotFieldCopyDepth = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_HOT_FIELD_COPY_DEPTH_LENGTH, &hotFieldCopyDepth)) {
+			result = false;
+		} else {
+			extensions->scavengerHotFieldCopyDepth = hotFieldCopyDepth;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_HOT_FIELD_COPY_ORDER, OMR_XGCSCAVENGER_HOT_FIELD_COPY_ORDER_LENGTH)) {
+		extensions->scavengerHotFieldCopyOrder = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_CARD_MARKING, OMR_XGCSCAVENGER_CARD_MARKING_LENGTH)) {
+		extensions->scavengerCardMarking = true;
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -38,3 +38,12 @@ MM_SweepPoolManagerAddressOrderedList::newInstance(MM_EnvironmentBase *env)
 
 	return sweepPoolManager;
 }
+
+/**
+ * Let the pool rebuild any free list index once all chunks have been connected.
+ */
+void
+MM_SweepPoolManagerAddressOrderedList::poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool)
+{
+	memoryPool->postProcess(envModron, MM_MemoryPool::forSweep);
+}
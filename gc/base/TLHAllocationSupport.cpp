@@ -154,8 +154,11 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
-		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		if (extensions->tlhAdaptiveSizing) {
+			/* the object is allocated outside the TLH, but it is still part of the thread's allocation rate */
+			_bytesAllocatedOutsideTLH += sizeInBytesRequired;
+		} else if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+			/* increase thread hungriness if we did not refresh */
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -163,6 +166,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	if (extensions->tlhAdaptiveSizing) {
+		adaptRefreshSize(env);
+	}
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -180,6 +187,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		}
 		wipeTLH(env);
 	} else {
+		if (NULL != getRealAlloc()) {
+			stats->_tlhWastedBytes += getSize();
+		}
 		clear(env);
 	}
 
@@ -261,11 +271,14 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		if (0 < getSize()) {
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
+			if (getRefreshSize() > stats->_tlhMaxRefreshSize) {
+				stats->_tlhMaxRefreshSize = getRefreshSize();
+			}
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
@@ -275,6 +288,36 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 }
 
 
+void
+MM_TLHAllocationSupport::adaptRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t now = omrtime_hires_clock();
+
+	/* A TLH that was flushed (by a GC) since the last refresh says nothing about the rate, so keep the current size */
+	if ((0 != _lastRefreshTime) && (NULL != getRealAlloc())) {
+		uint64_t bytesAllocated = ((uintptr_t)getRealAlloc() - (uintptr_t)getBase()) + _bytesAllocatedOutsideTLH;
+		uint64_t elapsedMicros = omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 == elapsedMicros) {
+			elapsedMicros = 1;
+		}
+		uint64_t sampledRate = (bytesAllocated * 1000) / elapsedMicros;
+		/* smooth the rate so that a single burst or stall does not swing the size from one extreme to the other */
+		_allocationRate = (0 == _allocationRate) ? sampledRate : (((_allocationRate * 3) + sampledRate) / 4);
+
+		uint64_t refreshSize = (_allocationRate * extensions->tlhAdaptiveRefreshInterval) / 1000;
+		if (refreshSize < extensions->tlhMinimumSize) {
+			refreshSize = extensions->tlhMinimumSize;
+		} else if (refreshSize > extensions->tlhMaximumSize) {
+			refreshSize = extensions->tlhMaximumSize;
+		}
+		setRefreshSize(MM_Math::roundToCeiling(sizeof(uintptr_t), (uintptr_t)refreshSize));
+	}
+	_lastRefreshTime = now;
+	_bytesAllocatedOutsideTLH = 0;
+}
+
 /**
  * Attempt to allocate an object in this TLH.
  */
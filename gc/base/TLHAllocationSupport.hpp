@@ -78,6 +78,9 @@ private:
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
+	uint64_t _lastRefreshTime; /**< hires clock time of the last refresh, used by adaptive TLH sizing (0 before the first refresh) */
+	uint64_t _allocationRate; /**< smoothed TLH allocation rate of the thread in bytes per millisecond, used by adaptive TLH sizing */
+	uint64_t _bytesAllocatedOutsideTLH; /**< bytes of objects too large to refresh the TLH for since the last refresh, counted in the adaptive allocation rate */
 
 public:
 protected:
@@ -134,6 +137,14 @@ private:
 	void restart(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * Sample the allocation rate of the thread from the TLH being replaced, the objects allocated outside it
+	 * and the time since the last refresh, and set the refresh size to what the thread is expected to allocate
+	 * in tlhAdaptiveRefreshInterval.
+	 * Called when the TLH is refreshed, before it is cached or cleared.
+	 */
+	void adaptRefreshSize(MM_EnvironmentBase *env);
+
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
@@ -181,7 +192,10 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_lastRefreshTime(0),
+		_allocationRate(0),
+		_bytesAllocatedOutsideTLH(0)
 	{};
 
 	/*
@@ -37,6 +37,7 @@
 
 class MM_Dispatcher;
 class MM_EnvironmentBase;
+class MM_TreeBarrier;
 
 /**
  * @todo Provide class documentation
@@ -49,6 +50,8 @@ protected:
 	MM_Dispatcher *_dispatcher;
 
 	uintptr_t _oldVMstate; /**< the vmState at the start of the task */
+	uintptr_t _recommendedThreadCount; /**< threads the task's expected work needs, or UDATA_MAX to use all available threads */
+	volatile uint64_t _idleTicks; /**< hi-res ticks the task's threads spent stalled, summed over all threads */
 	
 public:
 	virtual void setup(MM_EnvironmentBase *env);
@@ -72,11 +75,31 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * Limit the number of threads the dispatcher should activate for this task.  The dispatcher never
+	 * uses more threads than it would otherwise have chosen.
+	 * @param threadCount threads the task's expected work needs, or UDATA_MAX for no preference
+	 */
+	MMINLINE void setRecommendedThreadCount(uintptr_t threadCount) { _recommendedThreadCount = threadCount; }
+	MMINLINE uintptr_t getRecommendedThreadCount() { return _recommendedThreadCount; }
+
+	/**
+	 * Account time a thread spent stalled (waiting for work or for other threads) while running this task.
+	 * @param ticks hi-res ticks the calling thread was stalled
+	 */
+	MMINLINE void addIdleTicks(uint64_t ticks) { MM_AtomicOperations::addU64(&_idleTicks, ticks); }
+	MMINLINE uint64_t getIdleTicks() { return _idleTicks; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
 	}
 
+	MMINLINE virtual void setSynchronizeBarrier(MM_TreeBarrier *synchronizeBarrier)
+	{
+		/* in a Task we don't need a barrier */
+	}
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
@@ -153,7 +176,9 @@ public:
 	MM_Task(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher) :
 		MM_BaseVirtual(),
 		_dispatcher(dispatcher),
-		_oldVMstate(0)
+		_oldVMstate(0),
+		_recommendedThreadCount(UDATA_MAX),
+		_idleTicks(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+
+#include "EnvironmentBase.hpp"
+
+#include "TreeBarrier.hpp"
+
+MM_TreeBarrier *
+MM_TreeBarrier::newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum)
+{
+	MM_TreeBarrier *barrier = (MM_TreeBarrier *)env->getForge()->allocate(sizeof(MM_TreeBarrier), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != barrier) {
+		new(barrier) MM_TreeBarrier(env, threadCountMaximum);
+		if (!barrier->initialize(env)) {
+			barrier->kill(env);
+			barrier = NULL;
+		}
+	}
+	return barrier;
+}
+
+void
+MM_TreeBarrier::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TreeBarrier::initialize(MM_EnvironmentBase *env)
+{
+	_slots = (MM_TreeBarrierSlot *)env->getForge()->allocate(_slotCount * sizeof(MM_TreeBarrierSlot), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _slots) {
+		return false;
+	}
+	memset(_slots, 0, _slotCount * sizeof(MM_TreeBarrierSlot));
+
+	for (uintptr_t index = 0; index < _slotCount; index++) {
+		if (0 != omrthread_monitor_init_with_name(&_slots[index].monitor, 0, "MM_TreeBarrier::slot")) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_TreeBarrier::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _slots) {
+		for (uintptr_t index = 0; index < _slotCount; index++) {
+			if (NULL != _slots[index].monitor) {
+				omrthread_monitor_destroy(_slots[index].monitor);
+			}
+		}
+		env->getForge()->free(_slots);
+		_slots = NULL;
+	}
+}
+
+void
+MM_TreeBarrier::arrive(uintptr_t threadID, uintptr_t threadCount, const char *id, uintptr_t workUnitIndex, const char **reachedID, uintptr_t *reachedWorkUnitIndex)
+{
+	MM_TreeBarrierSlot *slot = &_slots[threadID];
+	uintptr_t firstChild = (2 * threadID) + 1;
+	uintptr_t childCount = getChildCount(threadID, threadCount);
+	const char *subtreeID = id;
+	uintptr_t subtreeWorkUnitIndex = workUnitIndex;
+
+	if (0 < childCount) {
+		omrthread_monitor_enter(slot->monitor);
+		while (slot->arrivedChildren < childCount) {
+			omrthread_monitor_wait(slot->monitor);
+		}
+		/* No child can arrive again until this thread has arrived in turn and been released, or the task has ended */
+		slot->arrivedChildren = 0;
+		omrthread_monitor_exit(slot->monitor);
+
+		/* Pass on a child's sync point if it differs from ours, preferring a different ID to a different index */
+		for (uintptr_t child = firstChild; child < (firstChild + childCount); child++) {
+			MM_TreeBarrierSlot *childSlot = &_slots[child];
+			if (childSlot->syncPointID != id) {
+				subtreeID = childSlot->syncPointID;
+				subtreeWorkUnitIndex = childSlot->syncPointWorkUnitIndex;
+			} else if ((subtreeID == id) && (childSlot->syncPointWorkUnitIndex != workUnitIndex)) {
+				subtreeWorkUnitIndex = childSlot->syncPointWorkUnitIndex;
+			}
+		}
+	}
+
+	slot->syncPointID = subtreeID;
+	slot->syncPointWorkUnitIndex = subtreeWorkUnitIndex;
+	/* Only the parent changes releaseCount, and it can not release this thread before it has arrived */
+	slot->awaitedReleaseCount = slot->releaseCount;
+
+	if (0 != threadID) {
+		uintptr_t parentID = (threadID - 1) / 2;
+		MM_TreeBarrierSlot *parentSlot = &_slots[parentID];
+		omrthread_monitor_enter(parentSlot->monitor);
+		parentSlot->arrivedChildren += 1;
+		/* only wake the parent once all of its children are here */
+		if (parentSlot->arrivedChildren == getChildCount(parentID, threadCount)) {
+			omrthread_monitor_notify(parentSlot->monitor);
+		}
+		omrthread_monitor_exit(parentSlot->monitor);
+	}
+
+	*reachedID = subtreeID;
+	*reachedWorkUnitIndex = subtreeWorkUnitIndex;
+}
+
+void
+MM_TreeBarrier::waitForRelease(uintptr_t threadID, uintptr_t threadCount)
+{
+	MM_TreeBarrierSlot *slot = &_slots[threadID];
+
+	omrthread_monitor_enter(slot->monitor);
+	while (slot->awaitedReleaseCount == slot->releaseCount) {
+		omrthread_monitor_wait(slot->monitor);
+	}
+	omrthread_monitor_exit(slot->monitor);
+
+	release(threadID, threadCount);
+}
+
+void
+MM_TreeBarrier::release(uintptr_t threadID, uintptr_t threadCount)
+{
+	uintptr_t firstChild = (2 * threadID) + 1;
+	uintptr_t childCount = getChildCount(threadID, threadCount);
+
+	for (uintptr_t child = firstChild; child < (firstChild + childCount); child++) {
+		MM_TreeBarrierSlot *childSlot = &_slots[child];
+		omrthread_monitor_enter(childSlot->monitor);
+		childSlot->releaseCount += 1;
+		omrthread_monitor_notify(childSlot->monitor);
+		omrthread_monitor_exit(childSlot->monitor);
+	}
+}
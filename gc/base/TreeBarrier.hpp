@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(TREE_BARRIER_HPP_)
+#define TREE_BARRIER_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "modronopt.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+#define TREE_BARRIER_SLOT_SIZE 128
+
+/**
+ * The state a thread waits on in the barrier.  Slots are padded to a cache line so that signalling one
+ * thread does not disturb the threads beside it.
+ */
+typedef struct MM_TreeBarrierSlot {
+	omrthread_monitor_t monitor; /**< the thread waits on this monitor for its children to arrive, or to be released */
+	volatile uintptr_t arrivedChildren; /**< children that have arrived, reset by the thread once they all have */
+	volatile uintptr_t releaseCount; /**< incremented by the thread's parent to release it */
+	uintptr_t awaitedReleaseCount; /**< releaseCount when the thread arrived, only touched by the thread itself */
+	const char *syncPointID; /**< the sync point reached by the thread, or by a child that reached a different one */
+	uintptr_t syncPointWorkUnitIndex; /**< the work unit index the sync point was reached with */
+	uint8_t padding[TREE_BARRIER_SLOT_SIZE - sizeof(omrthread_monitor_t) - (4 * sizeof(uintptr_t)) - sizeof(const char *)];
+} MM_TreeBarrierSlot;
+
+/**
+ * A barrier for the threads running a task, arranged as a binary tree over their slave IDs.
+ * Each thread waits on a monitor of its own for its two children to arrive, and then tells its parent,
+ * so that thread 0 (the master) knows that every thread has arrived after log2(n) hand-offs and no thread
+ * contends on a shared monitor.  Threads are released down the same tree.
+ */
+class MM_TreeBarrier : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_TreeBarrierSlot *_slots; /**< a slot per thread, indexed by slave ID */
+	uintptr_t _slotCount; /**< the number of slots, and so the most threads the barrier can hold */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of children of a thread, whose slave IDs follow (2 * threadID) + 1
+	 */
+	MMINLINE uintptr_t getChildCount(uintptr_t threadID, uintptr_t threadCount)
+	{
+		uintptr_t firstChild = (2 * threadID) + 1;
+		return (firstChild < threadCount) ? OMR_MIN((uintptr_t)2, threadCount - firstChild) : 0;
+	}
+
+protected:
+public:
+	static MM_TreeBarrier *newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait for the threads below this one in the tree to arrive, then report the arrival of them all to this
+	 * thread's parent.  Once thread 0 returns, every thread has arrived.  A thread that has arrived may leave
+	 * the barrier at once, or wait to be released with waitForRelease().
+	 * @param threadID the slave ID of the arriving thread
+	 * @param threadCount the number of threads taking part
+	 * @param id the sync point reached by this thread
+	 * @param workUnitIndex the work unit index of this thread
+	 * @param[out] reachedID set to id, or to a different sync point reached by a thread below this one
+	 * @param[out] reachedWorkUnitIndex set to the work unit index reachedID was reached with
+	 */
+	void arrive(uintptr_t threadID, uintptr_t threadCount, const char *id, uintptr_t workUnitIndex, const char **reachedID, uintptr_t *reachedWorkUnitIndex);
+
+	/**
+	 * Wait until this thread's parent releases it, then release its own children.
+	 * @param threadID the slave ID of a thread that has arrived
+	 * @param threadCount the number of threads taking part
+	 */
+	void waitForRelease(uintptr_t threadID, uintptr_t threadCount);
+
+	/**
+	 * Release the children of a thread, which releases every thread below it in turn.
+	 * Thread 0 calls this to release all threads once they have arrived.
+	 * @param threadID the slave ID of the releasing thread
+	 * @param threadCount the number of threads taking part
+	 */
+	void release(uintptr_t threadID, uintptr_t threadCount);
+
+	MM_TreeBarrier(MM_EnvironmentBase *env, uintptr_t threadCountMaximum) :
+		MM_BaseVirtual()
+		,_slots(NULL)
+		,_slotCount(threadCountMaximum)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* TREE_BARRIER_HPP_ */
@@ -116,6 +116,18 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->workStealingPackets && supportsWorkStealing()) {
+		/* one deque for each GC thread, indexed by slave ID */
+		_packetDequeCount = _extensions->gcThreadCount;
+		_packetDeques = (MM_PacketDeque *)env->getForge()->allocate(sizeof(MM_PacketDeque) * _packetDequeCount, MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			new(&_packetDeques[i]) MM_PacketDeque(i + 1);
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -220,6 +232,12 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _packetDeques) {
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+		_packetDequeCount = 0;
+	}
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -258,6 +276,16 @@ void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
+
+	/* Only one thread is active here, so each deque can be drained from its owner end */
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		while(NULL != (packet = _packetDeques[i].pop())) {
+			MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+			packet->setOwner(env);
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+	}
 	
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
@@ -286,6 +314,7 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 	assume0(_deferredFullPacketList.getCount() == 0);
 	assume0(_deferredPacketList.getCount() == 0);
 	assume0(_emptyPacketList.getCount() == _activePackets);
+	assume0(0 == _dequedPacketCount);
 
 	clearOverflowFlag();
 }
@@ -328,6 +357,7 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
+				|| (0 != _dequedPacketCount)
 				|| (!_overflowHandler->isEmpty()));
 				
 	return res;
@@ -386,6 +416,19 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		return NULL;
 	}
 
+	if (isWorkStealingActive(env)) {
+		/* Prefer our own most recently produced work, then take the oldest work of another thread */
+		if (NULL == (packet = popPacketDeque(env))) {
+			packet = stealPacket(env);
+		}
+		if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return packet;
+		}
+	}
+
 	if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
 		if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
 			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
@@ -424,6 +467,10 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 {
+	if (isWorkStealingActive(env)) {
+		return getInputPacketWorkStealing(env);
+	}
+
 	MM_Packet *packet = NULL;
 	bool doneFlag = false;
 	volatile uintptr_t doneIndex = _inputListDoneIndex;
@@ -493,6 +540,149 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	return packet;
 }
 
+/**
+ * Get an input packet when work stealing is active.
+ * Idle threads repeatedly try to steal from the other threads' deques.  Termination is
+ * detected without a monitor: each idle thread registers in _stealTerminationState and
+ * the last thread to go idle while no work is available advances the termination round,
+ * which releases every other idle thread of that round.
+ *
+ * @return Pointer to an input packet, or NULL if all work has been completed
+ */
+MM_Packet *
+MM_WorkPackets::getInputPacketWorkStealing(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	bool mustSyncThreadsAndExit = env->_currentTask->shouldYieldFromTask(env);
+	uintptr_t epoch = _stealTerminationState & ~(uintptr_t)_stealIdleCountMask;
+
+	Assert_MM_true(threadCount <= (uintptr_t)_stealIdleCountMask);
+
+	while (true) {
+		if (!mustSyncThreadsAndExit) {
+			while (inputPacketAvailable(env)) {
+				if (NULL != (packet = getInputPacketNoWait(env))) {
+					return packet;
+				}
+			}
+		}
+
+		/* Register as idle in the current termination round */
+		uintptr_t oldState = _stealTerminationState;
+		while (true) {
+			if (epoch != (oldState & ~(uintptr_t)_stealIdleCountMask)) {
+				return NULL;
+			}
+			uintptr_t observedState = MM_AtomicOperations::lockCompareExchange(&_stealTerminationState, oldState, oldState + 1);
+			if (observedState == oldState) {
+				break;
+			}
+			oldState = observedState;
+		}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t waitStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		uintptr_t spins = 0;
+		while (true) {
+			uintptr_t state = _stealTerminationState;
+			if (epoch != (state & ~(uintptr_t)_stealIdleCountMask)) {
+				/* Another thread completed the round */
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.addToCompleteStallTime(waitStartTime, omrtime_hires_clock());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				return NULL;
+			}
+
+			if ((state & _stealIdleCountMask) == threadCount) {
+				/* Every thread is idle so no more work can be produced - complete the round */
+				if (state == MM_AtomicOperations::lockCompareExchange(&_stealTerminationState, state, epoch + _stealEpochIncrement)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					env->_workPacketStats.addToCompleteStallTime(waitStartTime, omrtime_hires_clock());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					return NULL;
+				}
+			} else if (!mustSyncThreadsAndExit && inputPacketAvailable(env)) {
+				/* Leave the idle set before taking work so the round can not complete underneath us */
+				if (state == MM_AtomicOperations::lockCompareExchange(&_stealTerminationState, state, state - 1)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+					env->_workPacketStats.addToWorkStallTime(waitStartTime, omrtime_hires_clock());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+					break;
+				}
+			} else {
+				spins += 1;
+				if (0 == (spins % _stealSpinCount)) {
+					omrthread_yield();
+				} else {
+					MM_AtomicOperations::yieldCPU();
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Push a non-empty packet on the work stealing deque owned by the current thread.
+ * @return true if the packet was pushed, false if the deque is full
+ */
+bool
+MM_WorkPackets::pushPacketDeque(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	/* Account for the packet before it becomes visible to thieves so the count never underflows */
+	MM_AtomicOperations::add(&_dequedPacketCount, 1);
+	if (_packetDeques[env->getSlaveID()].push(packet)) {
+		return true;
+	}
+	MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+	return false;
+}
+
+/**
+ * Pop the most recently pushed packet from the work stealing deque owned by the current thread.
+ * @return a packet, or NULL if the deque is empty
+ */
+MM_Packet *
+MM_WorkPackets::popPacketDeque(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = _packetDeques[env->getSlaveID()].pop();
+	if (NULL != packet) {
+		MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+		packet->setOwner(env);
+	}
+	return packet;
+}
+
+/**
+ * Attempt to steal a packet from the deques of randomly chosen GC threads.
+ * @return a packet, or NULL if no packet could be stolen
+ */
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	MM_PacketDeque *ownDeque = &_packetDeques[env->getSlaveID()];
+
+	for (uintptr_t attempt = 0; (attempt < _packetDequeCount) && (0 != _dequedPacketCount); attempt++) {
+		uintptr_t victim = ownDeque->nextVictim(_packetDequeCount);
+		if (victim != env->getSlaveID()) {
+			env->_workPacketStats.workPacketStealAttempts += 1;
+			packet = _packetDeques[victim].steal();
+			if (NULL != packet) {
+				MM_AtomicOperations::subtract(&_dequedPacketCount, 1);
+				env->_workPacketStats.workPacketsStolen += 1;
+				packet->setOwner(env);
+				break;
+			}
+		}
+	}
+
+	return packet;
+}
+
 /**
  * Get an output packet
  * 
@@ -574,6 +764,10 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	MM_Packet *packet = NULL;
 	
 	packet = getPacket(env, &_fullPacketList);
+	if ((NULL == packet) && isWorkStealingActive(env)) {
+		/* Full packets may be parked on our own deque rather than the shared list */
+		packet = popPacketDeque(env);
+	}
 	if(NULL != packet) {
 		/* Move the contents of the packet to overflow */
 		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
@@ -704,6 +898,14 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	uintptr_t freeSlots = packet->freeSlots();
 	bool mustNotifyWaitingThreads = false;
 
+	if ((freeSlots != _slotsInPacket) && isWorkStealingActive(env)) {
+		/* Keep the work local to this thread; idle threads will steal it if required */
+		packet->resetOwner();
+		if (pushPacketDeque(env, packet)) {
+			return;
+		}
+	}
+
     /* Empty packet */
 	if(freeSlots == _slotsInPacket) {
 		list = &_emptyPacketList;
@@ -32,6 +32,7 @@
 
 #include "BaseVirtual.hpp"
 #include "Packet.hpp"
+#include "PacketDeque.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
 
@@ -60,7 +61,10 @@ protected:
 		_fullPacketThreshold = _slotsInPacket >> 4,
 		_satisfactoryCapacity = _slotsInPacket / 2,
 		_indexMask = 0xff,
-		_maxPacketSearch = 20
+		_maxPacketSearch = 20,
+		_stealIdleCountMask = 0xffff, /**< Low bits of _stealTerminationState count the idle threads */
+		_stealEpochIncrement = 0x10000, /**< High bits of _stealTerminationState identify the termination round */
+		_stealSpinCount = 64 /**< Number of idle spins between yields while waiting for work to steal */
 	};
 
 	uintptr_t _packetsPerBlock;
@@ -82,6 +86,11 @@ protected:
 	volatile uintptr_t _inputListWaitCount;
 	volatile uintptr_t _inputListDoneIndex;
 
+	MM_PacketDeque *_packetDeques; /**< Per GC thread work stealing deques (indexed by slave ID), or NULL if work stealing is disabled */
+	uintptr_t _packetDequeCount; /**< Number of entries in _packetDeques */
+	volatile uintptr_t _dequedPacketCount; /**< Number of non-empty packets currently held in _packetDeques */
+	volatile uintptr_t _stealTerminationState; /**< Termination round (high bits) and idle thread count (low bits) for the lock free termination barrier */
+
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
@@ -97,6 +106,28 @@ protected:
 	
 	virtual MM_WorkPacketOverflow *createOverflowHandler(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 
+	/**
+	 * Answer whether the receiver may hand packets between threads through work stealing deques.
+	 * Subclasses whose packets are shared with mutator threads must not use the deques.
+	 * @return true if work stealing may be enabled
+	 */
+	virtual bool supportsWorkStealing() { return true; }
+
+	/**
+	 * Answer whether the given thread should use the work stealing deques.  Only threads
+	 * dispatched on a parallel task own a deque.
+	 */
+	MMINLINE bool
+	isWorkStealingActive(MM_EnvironmentBase *env)
+	{
+		return (NULL != _packetDeques) && (NULL != env->_currentTask) && (env->getSlaveID() < _packetDequeCount);
+	}
+
+	bool pushPacketDeque(MM_EnvironmentBase *env, MM_Packet *packet);
+	MM_Packet *popPacketDeque(MM_EnvironmentBase *env);
+	MM_Packet *stealPacket(MM_EnvironmentBase *env);
+	MM_Packet *getInputPacketWorkStealing(MM_EnvironmentBase *env);
+
 private:
 	
 /* Methods */
@@ -220,6 +251,10 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
+		_packetDeques(NULL),
+		_packetDequeCount(0),
+		_dequedPacketCount(0),
+		_stealTerminationState(0),
 		_overflowHandler(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -348,6 +348,11 @@ retry:
 		goto retry;
 	}
 
+	/* Small regions left unswept by a concurrent sweep may free a region */
+	if (_regionPool->sweepPendingSmallRegion(env)) {
+		goto retry;
+	}
+
 	arrayletAllocationUnlock();
 
 	return NULL;
@@ -367,6 +372,15 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 		excess = (2 * excess) + 1;
 	}
 
+	/* Small regions left unswept by a concurrent sweep are freed one at a time, and are only coalesced by the next
+	 * collection, so sweeping them can only satisfy a single region request.
+	 */
+	if (1 == neededRegions) {
+		while ((NULL == region) && _regionPool->sweepPendingSmallRegion(env)) {
+			region = _regionPool->allocateFromRegionPool(env, 1, OMR_SIZECLASSES_LARGE, 0);
+		}
+	}
+
 	uintptr_t *result = (region == NULL) ? NULL : (uintptr_t *)region->getLowAddress();
 
 	/* Flush the large page right away. */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Realtime
+ */
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "omrutil.h"
+
+#include "BackgroundSweeperSegregated.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "RegionPoolSegregated.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_BackgroundSweeperSegregated *
+MM_BackgroundSweeperSegregated::newInstance(MM_EnvironmentBase *env)
+{
+	MM_BackgroundSweeperSegregated *sweeper = (MM_BackgroundSweeperSegregated *)env->getForge()->allocate(sizeof(MM_BackgroundSweeperSegregated), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sweeper) {
+		new(sweeper) MM_BackgroundSweeperSegregated(env);
+		if (!sweeper->initialize(env)) {
+			sweeper->kill(env);
+			sweeper = NULL;
+		}
+	}
+	return sweeper;
+}
+
+void
+MM_BackgroundSweeperSegregated::doWork(MM_EnvironmentBase *env)
+{
+	while (!isStopRequested() && _regionPool->sweepPendingSmallRegion(env)) {
+		/* one region per iteration, so that a stop request is seen promptly */
+		_regionsSwept += 1;
+	}
+}
+
+void
+MM_BackgroundSweeperSegregated::startSweep(MM_EnvironmentBase *env, MM_RegionPoolSegregated *regionPool)
+{
+	if (isIdle()) {
+		_regionPool = regionPool;
+		_regionsSwept = 0;
+		requestWork();
+	}
+}
+
+void
+MM_BackgroundSweeperSegregated::stopSweep(MM_EnvironmentBase *env)
+{
+	stopWork();
+}
+
+MM_BackgroundSweeperSegregated::MM_BackgroundSweeperSegregated(MM_EnvironmentBase *env)
+	: MM_BackgroundWorker(env, "Segregated Sweep Helper")
+	, _regionPool(NULL)
+	, _regionsSwept(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
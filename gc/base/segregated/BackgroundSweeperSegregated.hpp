@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Realtime
+ */
+
+#if !defined(BACKGROUNDSWEEPERSEGREGATED_HPP_)
+#define BACKGROUNDSWEEPERSEGREGATED_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BackgroundWorker.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+class MM_RegionPoolSegregated;
+
+/**
+ * Sweeps the small regions left on the sweep lists by a concurrent sweep on a dedicated thread between
+ * collections, so that allocating threads find swept regions on the available lists rather than sweeping
+ * them on demand. Regions are taken from the sweep lists one at a time, so the background thread and
+ * allocating threads never sweep the same region.
+ * The sweep must be stopped before the next collection uses the region lists or the mark map.
+ * @ingroup GC_Modron_Realtime
+ */
+class MM_BackgroundSweeperSegregated : public MM_BackgroundWorker
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	MM_RegionPoolSegregated *_regionPool; /**< The region pool being swept */
+	uintptr_t _regionsSwept; /**< The number of small regions the sweep thread has swept since the sweep was started */
+
+/*
+ * Function members
+ */
+public:
+	static MM_BackgroundSweeperSegregated *newInstance(MM_EnvironmentBase *env);
+
+	/**
+	 * Request that the sweep thread sweep the small regions remaining on the sweep lists of the region pool.
+	 * Must be called with exclusive VM access, at the end of a collection.
+	 * @param regionPool the region pool to sweep
+	 */
+	void startSweep(MM_EnvironmentBase *env, MM_RegionPoolSegregated *regionPool);
+
+	/**
+	 * Stop the sweep in progress, if any, and wait for the sweep thread to become idle.
+	 * Regions not yet swept stay on the sweep lists.
+	 */
+	void stopSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of small regions the sweep thread swept since the sweep was last started. Only stable once the sweep is stopped.
+	 */
+	MMINLINE uintptr_t getRegionsSwept() { return _regionsSwept; }
+
+	MM_BackgroundSweeperSegregated(MM_EnvironmentBase *env);
+
+protected:
+	/**
+	 * Sweep small regions one at a time, until there are none left or the thread is asked to stop.
+	 */
+	virtual void doWork(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* BACKGROUNDSWEEPERSEGREGATED_HPP_ */
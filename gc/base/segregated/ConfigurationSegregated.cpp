@@ -35,6 +35,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpaceSegregated.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParkingDispatcher.hpp"
 #include "PhysicalArenaRegionBased.hpp"
 #include "PhysicalSubArenaRegionBased.hpp"
 #include "RegionPoolSegregated.hpp"
@@ -219,6 +220,9 @@ MM_ConfigurationSegregated::createGlobalCollector(MM_EnvironmentBase* env)
 MM_Dispatcher *
 MM_ConfigurationSegregated::createDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize)
 {
+	if (env->getExtensions()->parkingDispatcher) {
+		return MM_ParkingDispatcher::newInstance(env, handler, handler_arg, defaultOSStackSize);
+	}
 	return MM_ParallelDispatcher::newInstance(env, handler, handler_arg, defaultOSStackSize);
 }
 
@@ -63,6 +63,14 @@ public:
 	
 	virtual MM_HeapRegionDescriptorSegregated* pop() = 0;
 
+	/**
+	 * Remove all regions from the receiver, to be moved in bulk to another list.
+	 * @param[out] back the last region removed, or NULL if the receiver was empty
+	 * @param[out] length the number of regions removed
+	 * @return the first region removed, or NULL if the receiver was empty. The removed regions are linked through next and prev.
+	 */
+	virtual MM_HeapRegionDescriptorSegregated *detachAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length) = 0;
+
 	/*
 	 * This method must be used with care.  
 	 * In particular, it is wrong to detach from a list
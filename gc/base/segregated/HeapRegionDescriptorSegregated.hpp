@@ -47,6 +47,7 @@ private:
 	MM_HeapRegionManager *_regionManager;
 	OMR_SizeClasses *_segregatedSizeClasses;
 	uintptr_t _nextArrayletIndex; /**< next arraylet to use for allocation */
+	uintptr_t _sweepEpoch; /**< the region pool sweep epoch in which the region was last swept or allocated from the free lists (see MM_RegionPoolSegregated::isRegionSwept()) */
 	
 	/*
 	 * Function members
@@ -61,6 +62,7 @@ public:
 		,_regionManager(NULL)
 		,_segregatedSizeClasses(env->getOmrVM()->_sizeClasses)
 		,_nextArrayletIndex(0)
+		,_sweepEpoch(0)
 	{
 		_arrayletBackPointers = ((uintptr_t **)(this + 1));
 		_typeId = __FUNCTION__;
@@ -100,6 +102,9 @@ public:
 	bool isFree() { return getRegionType() == FREE; }
 	bool isCanonical() { return isReserved() || isSmall() || getRangeCount() >= 1; }
 
+	MMINLINE uintptr_t getSweepEpoch() { return _sweepEpoch; }
+	MMINLINE void setSweepEpoch(uintptr_t sweepEpoch) { _sweepEpoch = sweepEpoch; }
+
 	void setRange(RegionType type, uintptr_t range);
 	uintptr_t getRange() { return getRangeCount(); };
 	MM_HeapRegionDescriptorSegregated *splitRange(uintptr_t numRegionsToSplit);
@@ -70,6 +70,20 @@ public:
 
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count) = 0;
 
+	/* check that the receiver is not empty before performing dequeue */
+	virtual MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty()
+	{
+		return isEmpty() ? NULL : dequeue();
+	}
+
+	/**
+	 * Remove all regions from the receiver, to be moved in bulk to another list.
+	 * @param[out] back the last region removed, or NULL if the receiver was empty
+	 * @param[out] length the number of regions removed
+	 * @return the first region removed, or NULL if the receiver was empty. The removed regions are linked through next and prev.
+	 */
+	virtual MM_HeapRegionDescriptorSegregated *detachAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length) = 0;
+
 	virtual uintptr_t debugCountFreeBytesInRegions() = 0;
 
 	/* Virtual methods inherited from RegionList */
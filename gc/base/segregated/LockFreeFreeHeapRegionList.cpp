@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "GCExtensionsBase.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeFreeHeapRegionList *
+MM_LockFreeFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind)
+{
+	MM_LockFreeFreeHeapRegionList *fpl = (MM_LockFreeFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockFreeFreeHeapRegionList), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_LockFreeFreeHeapRegionList(regionListKind);
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_LockFreeFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	_regions.initialize(env->getExtensions()->heapRegionManager, &_length, &_contentionCount);
+	return true;
+}
+
+void
+MM_LockFreeFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_LockFreeFreeHeapRegionList::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t count = 0;
+	omrtty_printf("LockFreeFreeHeapRegionList 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = _regions.peek(); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, count, cur->getRange());
+		count += 1;
+	}
+	omrtty_printf("\n");
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
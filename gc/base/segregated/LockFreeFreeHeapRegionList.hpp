@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(LOCKFREEFREEHEAPREGIONLIST_HPP_)
+#define LOCKFREEFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+#include "modronopt.h"
+
+#include "FreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionStack.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A FreeHeapRegionList of single regions shared between threads without a lock.
+ * Lists of region ranges are searched and split by allocate(), and regions are removed from the middle of
+ * the coalesce list by detach(), neither of which can be done on a lock-free stack, so those lists are
+ * always MM_LockingFreeHeapRegionList.
+ * @ingroup GC_Realtime
+ */
+class MM_LockFreeFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockFreeHeapRegionStack _regions; /**< The regions on the list */
+
+/* Methods */
+public:
+	static MM_LockFreeFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind) :
+		MM_FreeHeapRegionList(regionListKind, true),
+		_regions()
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+		_regions.push(region, region, 1);
+	}
+
+	virtual void
+	push(MM_HeapRegionQueue *src)
+	{
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAll(&back, &srcLength);
+		if (NULL != front) {
+			_regions.push(front, back, srcLength);
+		}
+	}
+
+	virtual void
+	push(MM_FreeHeapRegionList *src)
+	{
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAll(&back, &srcLength);
+		if (NULL != front) {
+			_regions.push(front, back, srcLength);
+		}
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *pop() { return _regions.pop(); }
+
+	virtual void
+	detach(MM_HeapRegionDescriptorSegregated *cur)
+	{
+		Assert_MM_unreachable();
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	detachAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length)
+	{
+		return _regions.popAll(back, length);
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		if (1 == numRegions) {
+			region = MM_FreeHeapRegionList::allocate(env, szClass);
+		}
+		return region;
+	}
+
+	virtual bool isEmpty() { return _regions.isEmpty(); }
+	virtual uintptr_t getTotalRegions() { return length(); }
+	virtual uintptr_t getMaxRegions() { return isEmpty() ? 0 : 1; }
+
+	virtual void showList(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEFREEHEAPREGIONLIST_HPP_ */
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionQueue *
+MM_LockFreeHeapRegionQueue::newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes)
+{
+	MM_LockFreeHeapRegionQueue *regionList = (MM_LockFreeHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionQueue), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (regionList) {
+		new (regionList) MM_LockFreeHeapRegionQueue(regionListKind, singleRegionsOnly, trackFreeBytes);
+		if (!regionList->initialize(env)) {
+			regionList->kill(env);
+			return NULL;
+		}
+	}
+	return regionList;
+}
+
+void
+MM_LockFreeHeapRegionQueue::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionQueue::initialize(MM_EnvironmentBase *env)
+{
+	_regions.initialize(env->getExtensions()->heapRegionManager, &_length, &_contentionCount);
+	return true;
+}
+
+void
+MM_LockFreeHeapRegionQueue::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+uintptr_t
+MM_LockFreeHeapRegionQueue::getTotalRegions()
+{
+	if (_singleRegionsOnly) {
+		return length();
+	} else {
+		uintptr_t count = 0;
+		for (MM_HeapRegionDescriptorSegregated *cur = _regions.peek(); cur != NULL; cur = cur->getNext()) {
+			count += cur->getRange();
+		}
+		return count;
+	}
+}
+
+void
+MM_LockFreeHeapRegionQueue::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t index = 0;
+	uintptr_t count = 0;
+	omrtty_printf("LockFreeHeapRegionQueue 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = _regions.peek(); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, index, cur->getRange());
+		count += 1;
+		index += cur->getRange();
+	}
+	omrtty_printf("\n");
+}
+
+uintptr_t
+MM_LockFreeHeapRegionQueue::debugCountFreeBytesInRegions()
+{
+	uintptr_t freeBytes = 0;
+	for (MM_HeapRegionDescriptorSegregated *cur = _regions.peek(); cur != NULL; cur = cur->getNext()) {
+		freeBytes += cur->debugCountFreeBytes();
+	}
+	return freeBytes;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
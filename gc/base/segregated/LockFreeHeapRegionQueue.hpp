@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONQUEUE_HPP_)
+#define LOCKFREEHEAPREGIONQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionQueue.hpp"
+#include "LockFreeHeapRegionStack.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A HeapRegionQueue shared between threads without a lock.
+ * Regions are kept on a MM_LockFreeHeapRegionStack, so they are dequeued in LIFO rather than FIFO order;
+ * none of the region pool queues depend on the order.
+ * Walking the queue (getTotalRegions of a multi region queue, showList, debugCountFreeBytesInRegions) is
+ * only accurate while no other thread is updating it.
+ * @ingroup GC_Realtime
+ */
+class MM_LockFreeHeapRegionQueue : public MM_HeapRegionQueue
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockFreeHeapRegionStack _regions; /**< The regions on the queue */
+
+public:
+	static MM_LockFreeHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionOnly, bool trackFreeBytes = false);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionQueue(RegionListKind regionListKind, bool singleRegionOnly, bool trackFreeBytes) :
+		MM_HeapRegionQueue(regionListKind, singleRegionOnly, trackFreeBytes),
+		_regions()
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual bool isEmpty() { return _regions.isEmpty(); }
+
+	virtual uintptr_t getTotalRegions();
+
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *region)
+	{
+		_regions.push(region, region, 1);
+	}
+
+	virtual void enqueue(MM_HeapRegionQueue *src)
+	{
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAll(&back, &srcLength);
+		if (NULL != front) {
+			_regions.push(front, back, srcLength);
+		}
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeue() { return _regions.pop(); }
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty() { return _regions.pop(); }
+
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count)
+	{
+		uintptr_t moved = 0;
+		while (moved < count) {
+			MM_HeapRegionDescriptorSegregated *region = _regions.pop();
+			if (NULL == region) {
+				break;
+			}
+			target->enqueue(region);
+			moved += 1;
+		}
+		return moved;
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	detachAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length)
+	{
+		return _regions.popAll(back, length);
+	}
+
+	virtual uintptr_t debugCountFreeBytesInRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONQUEUE_HPP_ */
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Realtime
+ */
+
+#if !defined(LOCKFREEHEAPREGIONSTACK_HPP_)
+#define LOCKFREEHEAPREGIONSTACK_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A stack of regions linked through their next pointers, updated with compare and swap instead of a lock.
+ *
+ * The top of the stack is a tagged reference: the low 32 bits hold the region table index of the top region
+ * plus one (zero when the stack is empty), and the high 32 bits hold a tag that is incremented by every update.
+ * The tag makes a compare and swap fail if the top region was popped and pushed again since it was read (ABA).
+ * Region descriptors are never freed while the heap exists, so a thread can safely read the next pointer of a
+ * region that another thread has just popped; its compare and swap then fails on the tag.
+ *
+ * The owning list provides the length and contention counters, so that they are reported through MM_HeapRegionList.
+ * The length is incremented before regions are pushed and decremented after they are popped, so it is never less
+ * than the number of regions on the stack.
+ *
+ * @ingroup GC_Realtime
+ */
+class MM_LockFreeHeapRegionStack
+{
+/* Data members & types */
+public:
+protected:
+private:
+	volatile uint64_t _top; /**< Tagged reference to the top region */
+	volatile uintptr_t *_length; /**< Number of regions on the stack, owned by the list */
+	volatile uintptr_t *_contentionCount; /**< Number of failed compare and swaps, owned by the list */
+	MM_HeapRegionManager *_heapRegionManager; /**< Maps region table indices to descriptors */
+
+/* Methods */
+public:
+	void
+	initialize(MM_HeapRegionManager *heapRegionManager, volatile uintptr_t *length, volatile uintptr_t *contentionCount)
+	{
+		_heapRegionManager = heapRegionManager;
+		_length = length;
+		_contentionCount = contentionCount;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == (uint32_t)_top; }
+
+	/**
+	 * @return the top region (for walking the stack when it is not being updated)
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *peek() { return regionForReference(_top); }
+
+	/**
+	 * Push a list of regions linked through next.
+	 * @param front the region to become the top of the stack
+	 * @param back the last region of the list
+	 * @param count the number of regions in the list
+	 */
+	MMINLINE void
+	push(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count)
+	{
+		uint64_t index = (uint64_t)_heapRegionManager->physicalTableDescriptorIndexForAddress(front->getLowAddress()) + 1;
+		MM_AtomicOperations::add(_length, count);
+		while (true) {
+			uint64_t oldTop = _top;
+			back->setNext(regionForReference(oldTop));
+			uint64_t newTop = nextTag(oldTop) | index;
+			if (oldTop == MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, newTop)) {
+				break;
+			}
+			MM_AtomicOperations::add(_contentionCount, 1);
+		}
+	}
+
+	/**
+	 * @return the region removed from the top of the stack, with cleared links, or NULL if the stack is empty
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (true) {
+			uint64_t oldTop = _top;
+			region = regionForReference(oldTop);
+			if (NULL == region) {
+				break;
+			}
+			MM_HeapRegionDescriptorSegregated *next = region->getNext();
+			uint64_t newTop = nextTag(oldTop);
+			if (NULL != next) {
+				newTop |= (uint64_t)_heapRegionManager->physicalTableDescriptorIndexForAddress(next->getLowAddress()) + 1;
+			}
+			if (oldTop == MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, newTop)) {
+				MM_AtomicOperations::subtract(_length, 1);
+				region->setNext(NULL);
+				region->setPrev(NULL);
+				break;
+			}
+			MM_AtomicOperations::add(_contentionCount, 1);
+		}
+		return region;
+	}
+
+	/**
+	 * Remove every region from the stack.
+	 * @param[out] back the last region removed, or NULL if the stack was empty
+	 * @param[out] length the number of regions removed
+	 * @return the first region removed, or NULL if the stack was empty. The removed regions are linked through next and prev.
+	 */
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	popAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length)
+	{
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		while (true) {
+			uint64_t oldTop = _top;
+			front = regionForReference(oldTop);
+			if ((NULL == front) || (oldTop == MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, nextTag(oldTop)))) {
+				break;
+			}
+			MM_AtomicOperations::add(_contentionCount, 1);
+		}
+
+		/* the removed regions are now private to this thread, so the prev links can be filled in */
+		MM_HeapRegionDescriptorSegregated *prev = NULL;
+		uintptr_t count = 0;
+		for (MM_HeapRegionDescriptorSegregated *cur = front; NULL != cur; cur = cur->getNext()) {
+			cur->setPrev(prev);
+			prev = cur;
+			count += 1;
+		}
+		if (0 != count) {
+			MM_AtomicOperations::subtract(_length, count);
+		}
+		*back = prev;
+		*length = count;
+		return front;
+	}
+
+	MM_LockFreeHeapRegionStack() :
+		_top(0),
+		_length(NULL),
+		_contentionCount(NULL),
+		_heapRegionManager(NULL)
+	{
+	}
+
+protected:
+private:
+	MMINLINE static uint64_t
+	nextTag(uint64_t reference)
+	{
+		return ((reference >> 32) + 1) << 32;
+	}
+
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	regionForReference(uint64_t reference)
+	{
+		uintptr_t index = (uintptr_t)(uint32_t)reference;
+		if (0 == index) {
+			return NULL;
+		}
+		return (MM_HeapRegionDescriptorSegregated *)_heapRegionManager->physicalTableDescriptorForIndex(index - 1);
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONSTACK_HPP_ */
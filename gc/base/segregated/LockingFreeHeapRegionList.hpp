@@ -67,67 +67,29 @@ public:
 	}
 	
 	virtual void
-	push(MM_HeapRegionQueue *srcAsPQ)
-	{ 
-		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
-		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
-			return;
-		}
-		lock();
-		src->lock();
-		
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		
-		/* Add to front of self */
-		back->setNext(_head); /* OK even if _head is NULL */
-		if (_head == NULL) {
-			_tail = back;
-		} else {
-			_head->setPrev(back);
+	push(MM_HeapRegionQueue *src)
+	{
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAll(&back, &srcLength);
+		if (NULL != front) {
+			lock();
+			pushInternal(front, back, srcLength);
+			unlock();
 		}
-		_head = front;
-		_length += srcLength;
-		
-		src->unlock();
-		unlock();
 	}
 	
 	virtual void 
-	push(MM_FreeHeapRegionList *srcAsFPL) 
+	push(MM_FreeHeapRegionList *src) 
 	{ 
-		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
-		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
-			return;
-		}
-		lock();
-		src->lock();
-		
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		
-		/* Add to front of self */
-		back->setNext(_head); /* OK even if _head is NULL */
-		if (_head == NULL) {
-			_tail = back;
-		} else {
-			_head->setPrev(back);
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAll(&back, &srcLength);
+		if (NULL != front) {
+			lock();
+			pushInternal(front, back, srcLength);
+			unlock();
 		}
-		_head = front;
-		_length += srcLength;
-		
-		src->unlock();
-		unlock();
 	}
 
 	virtual MM_HeapRegionDescriptorSegregated *
@@ -147,6 +109,25 @@ public:
 		unlock();
 	}
 
+	virtual MM_HeapRegionDescriptorSegregated *
+	detachAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length)
+	{
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		*back = NULL;
+		*length = 0;
+		if (NULL != _head) { /* Nothing to move - single read needs no lock */
+			lock();
+			front = _head;
+			*back = _tail;
+			*length = _length;
+			_head = NULL;
+			_tail = NULL;
+			_length = 0;
+			unlock();
+		}
+		return front;
+	}
+
 	virtual MM_HeapRegionDescriptorSegregated* allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
 
 	virtual uintptr_t getTotalRegions();
@@ -165,7 +146,14 @@ public:
 
 protected:
 private:
-	MMINLINE void lock() { omrthread_monitor_enter(_lockMonitor); }
+	MMINLINE void
+	lock()
+	{
+		if (0 != omrthread_monitor_try_enter(_lockMonitor)) {
+			omrthread_monitor_enter(_lockMonitor);
+			_contentionCount += 1;
+		}
+	}
 	
 	MMINLINE void unlock() { omrthread_monitor_exit(_lockMonitor); }
 
@@ -184,6 +172,20 @@ private:
 		}
 	}
 
+	/* Add a list of regions linked through next and prev to the front of self */
+	void
+	pushInternal(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t length)
+	{
+		back->setNext(_head); /* OK even if _head is NULL */
+		if (_head == NULL) {
+			_tail = back;
+		} else {
+			_head->setPrev(back);
+		}
+		_head = front;
+		_length += length;
+	}
+
 	MM_HeapRegionDescriptorSegregated *
 	popInternal()
 	{
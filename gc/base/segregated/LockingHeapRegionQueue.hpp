@@ -36,9 +36,6 @@
 
 class MM_LockingHeapRegionQueue : public MM_HeapRegionQueue
 {
-/* For efficient pushFront operation */
-friend class MM_LockingFreeHeapRegionList;
-	
 /* Data members & types */
 public:
 protected:
@@ -83,22 +80,17 @@ public:
 	}
 
 	/* enqueue src at the _end_ of the receiver's queue */
-	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
+	virtual void enqueue(MM_HeapRegionQueue *src)
 	{
-		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
-		if (NULL == src->_head) { /* Nothing to move - single read needs no lock */
+		/* Remove from src */
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->detachAll(&back, &srcLength);
+		if (NULL == front) {
 			return;
 		}
+
 		lock();
-		src->lock();
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		
 		/* Add to back of self */
 		front->setPrev(_tail); /* OK even if _tail is NULL */
 		if (_tail == NULL) {
@@ -108,11 +100,28 @@ public:
 		}
 		_tail = back;
 		_length += srcLength;
-		
-		src->unlock();
 		unlock();
 	}
 
+	virtual MM_HeapRegionDescriptorSegregated *
+	detachAll(MM_HeapRegionDescriptorSegregated **back, uintptr_t *length)
+	{
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		*back = NULL;
+		*length = 0;
+		if (NULL != _head) { /* Nothing to move - single read needs no lock */
+			lock();
+			front = _head;
+			*back = _tail;
+			*length = _length;
+			_head = NULL;
+			_tail = NULL;
+			_length = 0;
+			unlock();
+		}
+		return front;
+	}
+
 	virtual MM_HeapRegionDescriptorSegregated *dequeue()
 	{
 		lock();
@@ -122,7 +131,7 @@ public:
 	}
 
 	/* check that the receiver is not empty before locking it and performing dequeue */
-	MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty()
+	virtual MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty()
 	{
 		MM_HeapRegionDescriptorSegregated *region = NULL;
 		if (0 != _length) {
@@ -133,13 +142,10 @@ public:
 		return region;
 	}
 
-	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count)
 	{
-		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
 		lock();
-		target->lock();
 		uintptr_t moved = dequeueInternal(target, count);
-		target->unlock();
 		unlock();
 		return moved;
 	}
@@ -156,7 +162,10 @@ protected:
 private:		
 	MMINLINE void lock() {
 		if (_needLock) {
-			omrthread_monitor_enter(_lockMonitor);
+			if (0 != omrthread_monitor_try_enter(_lockMonitor)) {
+				omrthread_monitor_enter(_lockMonitor);
+				_contentionCount += 1;
+			}
 		}
 	}
 	MMINLINE void unlock() {
@@ -178,7 +187,7 @@ private:
 		_length++;
 	}
 
-	uintptr_t dequeueInternal(MM_LockingHeapRegionQueue *target, uintptr_t count)
+	uintptr_t dequeueInternal(MM_HeapRegionQueue *target, uintptr_t count)
 	{
 		uintptr_t moved = 0;
 		while (count-- > 0) {
@@ -187,7 +196,7 @@ private:
 				break;
 			}
 			moved++;
-			target->enqueueInternal(p);
+			target->enqueue(p);
 		}
 		return moved;
 	}
@@ -28,6 +28,8 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingFreeHeapRegionList.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -86,16 +88,19 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	Assert_MM_true(0 < _splitAvailableListSplitCount);
 	for (szClass=OMR_SIZECLASSES_MIN_SMALL; szClass<=OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			uintptr_t splitAvailableListsSize = sizeof(MM_LockingHeapRegionQueue) * _splitAvailableListSplitCount;
-			_smallAvailableRegions[szClass][i] = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			uintptr_t splitAvailableListsSize = sizeof(MM_HeapRegionQueue *) * _splitAvailableListSplitCount;
+			_smallAvailableRegions[szClass][i] = (MM_HeapRegionQueue **)env->getForge()->allocate(splitAvailableListsSize, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
 			if (NULL == _smallAvailableRegions[szClass][i]) {
 				return false;
 			}
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
+			MM_HeapRegionQueue **regionQueue = _smallAvailableRegions[szClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				/* The available lists should track the free bytes in their regions (4th param = true) */
-				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
-				if (!(&regionQueue[j])->initialize(env)) {
+				regionQueue[j] = NULL;
+			}
+			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+				/* The available lists should track the free bytes in their regions (5th param = true) */
+				regionQueue[j] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
+				if (NULL == regionQueue[j]) {
 					return false;
 				}
 			}
@@ -131,12 +136,20 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 MM_HeapRegionQueue*
 MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
 {
+	/* queues private to one thread have no lock to replace */
+	if (concurrentAccess && env->getExtensions()->segregatedLockFreeRegionLists) {
+		return MM_LockFreeHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, trackFreeBytes);
+	}
 	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
 }
 
 MM_FreeHeapRegionList*
 MM_RegionPoolSegregated::allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly)
 {
+	/* lists of region ranges are searched and split under their lock, so only the single region list can be lock-free */
+	if (singleRegionsOnly && env->getExtensions()->segregatedLockFreeRegionLists) {
+		return MM_LockFreeFreeHeapRegionList::newInstance(env, regionListKind);
+	}
 	return MM_LockingFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly);
 }
 
@@ -182,12 +195,15 @@ MM_RegionPoolSegregated::tearDown(MM_EnvironmentBase *env)
 	
 	for (int32_t szClass=OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (uintptr_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
+			MM_HeapRegionQueue **regionQueueArray = _smallAvailableRegions[szClass][i];
 			if (NULL != regionQueueArray) {
 				for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-					(&regionQueueArray[j])->tearDown(env);
+					if (NULL != regionQueueArray[j]) {
+						regionQueueArray[j]->kill(env);
+					}
 				}
 				env->getForge()->free(regionQueueArray);
+				_smallAvailableRegions[szClass][i] = NULL;
 			}
 		}
 		if (_smallFullRegions[szClass]) {
@@ -212,14 +228,19 @@ MM_RegionPoolSegregated::addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQue
 void
 MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 {
+	/* every region in use (including any left unswept by a concurrent sweep) now needs to be swept */
+	_sweepEpoch += 1;
+	_isSweepingSmallConcurrently = false;
+	_concurrentSweepRegionCount = 0;
+	_concurrentSweepRegionsRemaining = 0;
 	_currentTotalCountOfSweepRegions = 0;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_darkMatterCellCount[sizeClass] = 0;
 		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
+			MM_HeapRegionQueue **regionQueue = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
+				_smallSweepRegions[sizeClass]->enqueue(regionQueue[j]);
 			}
 		}
 		_initialCountOfSweepRegions[sizeClass] = _currentCountOfSweepRegions[sizeClass] = _smallSweepRegions[sizeClass]->getTotalRegions();
@@ -247,7 +268,7 @@ MM_RegionPoolSegregated::enqueueAvailable(MM_HeapRegionDescriptorSegregated *reg
 {
 	for (int32_t i = 0; i < NUM_DEFRAG_BUCKETS; i++) {
 		if (occupancy >= defragBucketThresholds[i]) {
-			(&(_smallAvailableRegions[sizeClass][i])[splitListIndex])->enqueue(region);
+			_smallAvailableRegions[sizeClass][i][splitListIndex]->enqueue(region);
 			break;
 		}
 	}
@@ -307,6 +328,7 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 	
 	if (region != NULL) {
 		incrementRegionsInUse(region->getRange()); /* we must add here because we will return remainder later */
+		region->setSweepEpoch(_sweepEpoch);
 		
 		/* We must notify the allocation tracker that a fresh region has been allocated, it will know how to
 		 * account for bytes lost to internal fragmentation and will account for all the memory allocated
@@ -324,9 +346,22 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
 	uintptr_t splitIndex = env->getSlaveID() % _splitAvailableListSplitCount;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
-		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+		MM_HeapRegionQueue *primaryQueue = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET][splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
+			primaryQueue->enqueue(_smallAvailableRegions[sizeClass][i][splitIndex]);
+		}
+	}
+}
+
+void
+MM_RegionPoolSegregated::joinBucketLists(MM_EnvironmentBase *env)
+{
+	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (uintptr_t splitIndex = 0; splitIndex < _splitAvailableListSplitCount; splitIndex++) {
+			MM_HeapRegionQueue *primaryQueue = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET][splitIndex];
+			for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
+				primaryQueue->enqueue(_smallAvailableRegions[sizeClass][i][splitIndex]);
+			}
 		}
 	}
 }
@@ -346,18 +381,20 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 
 	/* try bucket 0, i.e. primary bucket first */
 	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
-	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
-	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
+	MM_HeapRegionQueue **primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
+	MM_HeapRegionQueue *allocationQueue = primaryQueueArray[startList];
 	region = allocationQueue->dequeueIfNonEmpty();
 	if (region != NULL) {
+		Assert_MM_true(isRegionSwept(region));
 		return region;
 	}
 
 	/* if primary bucket fails, try the other split queues, starting from the current thread's split index */
 	for (uintptr_t j=startList+1; j<startList+_splitAvailableListSplitCount; j++) {
-		allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
+		allocationQueue = primaryQueueArray[j%_splitAvailableListSplitCount];
 		region = allocationQueue->dequeueIfNonEmpty();
 		if (region != NULL) {
+			Assert_MM_true(isRegionSwept(region));
 			return region;
 		}
 	}
@@ -365,11 +402,12 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 	/* if all split lists in the primary bucket fail, try the remaining buckets */
 	if (_isSweepingSmall) {
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
+			MM_HeapRegionQueue **queueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
-				allocationQueue = &queueArray[j%_splitAvailableListSplitCount];
+				allocationQueue = queueArray[j%_splitAvailableListSplitCount];
 				region = allocationQueue->dequeueIfNonEmpty();
 				if (region != NULL) {
+					Assert_MM_true(isRegionSwept(region));
 					return region;
 				}
 			}
@@ -389,6 +427,7 @@ MM_RegionPoolSegregated::allocateRegionFromArrayletSizeClass(MM_EnvironmentBase
 {
 	MM_HeapRegionDescriptorSegregated *region = _arrayletAvailableRegions->dequeue();
 	if (region != NULL) {
+		Assert_MM_true(isRegionSwept(region));
 		return region;
 	}
 	return NULL;
@@ -410,10 +449,98 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
 		decrementCurrentTotalCountOfSweepRegions(1);
 		_smallFullRegions[sizeClass]->enqueue(region);
+		if (_isSweepingSmallConcurrently) {
+			concurrentSweepSmallRegionDone(env);
+		}
 	}
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::sweepPendingSmallRegion(MM_EnvironmentBase *env)
+{
+	if (!_isSweepingSmallConcurrently) {
+		/* the sweep lists belong to a collection's sweep, or are already empty */
+		return false;
+	}
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		if (0 == _currentCountOfSweepRegions[sizeClass]) {
+			continue;
+		}
+		MM_HeapRegionDescriptorSegregated *region = _smallSweepRegions[sizeClass]->dequeue();
+		if (NULL == region) {
+			continue;
+		}
+		decrementCurrentCountOfSweepRegions(sizeClass, 1);
+		decrementCurrentTotalCountOfSweepRegions(1);
+
+		_sweepScheme->sweepRegion(env, region);
+
+		/* same disposition as MM_SweepSchemeSegregated::incrementalSweepSmall() */
+		MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+		uintptr_t numCells = region->getNumCells();
+		if (memoryPoolACL->getFreeCount() < numCells) {
+			uintptr_t occupancy = (memoryPoolACL->getMarkCount() * 100) / numCells;
+			if (env->getExtensions()->nonDeterministicSweep) {
+				updateOccupancy(sizeClass, occupancy);
+			}
+			if (memoryPoolACL->getMarkCount() == numCells) {
+				_smallFullRegions[sizeClass]->enqueue(region);
+			} else {
+				enqueueAvailable(region, sizeClass, occupancy, env->getEnvironmentId() % _splitAvailableListSplitCount);
+			}
+		} else {
+			region->emptyRegionReturned(env);
+			addFreeRegion(env, region);
+		}
+		concurrentSweepSmallRegionDone(env);
+		return true;
+	}
+	return false;
+}
+
+void
+MM_RegionPoolSegregated::startConcurrentSweepSmall(MM_EnvironmentBase *env)
+{
+	_concurrentSweepRegionCount = _currentTotalCountOfSweepRegions;
+	_concurrentSweepRegionsRemaining = _currentTotalCountOfSweepRegions;
+	if (0 == _concurrentSweepRegionsRemaining) {
+		joinBucketLists(env);
+		setSweepSmallPages(false);
+	} else {
+		_isSweepingSmallConcurrently = true;
+	}
+}
+
+void
+MM_RegionPoolSegregated::concurrentSweepSmallRegionDone(MM_EnvironmentBase *env)
+{
+	/* regions are counted once they are back on a list, so no sweep is still adding to the buckets when the count reaches zero */
+	if (0 == MM_AtomicOperations::subtract(&_concurrentSweepRegionsRemaining, 1)) {
+		joinBucketLists(env);
+		setSweepSmallPages(false);
+		_isSweepingSmallConcurrently = false;
+	}
+}
+
+uintptr_t
+MM_RegionPoolSegregated::getContentionCount()
+{
+	uintptr_t count = _singleFreeList->getContentionCount() + _multiFreeList->getContentionCount() + _coalesceFreeList->getContentionCount();
+	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
+			MM_HeapRegionQueue **regionQueue = _smallAvailableRegions[sizeClass][i];
+			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+				count += regionQueue[j]->getContentionCount();
+			}
+		}
+		count += _smallFullRegions[sizeClass]->getContentionCount() + _smallSweepRegions[sizeClass]->getContentionCount();
+	}
+	count += _arrayletAvailableRegions->getContentionCount() + _arrayletFullRegions->getContentionCount() + _arrayletSweepRegions->getContentionCount();
+	count += _largeFullRegions->getContentionCount() + _largeSweepRegions->getContentionCount();
+	return count;
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
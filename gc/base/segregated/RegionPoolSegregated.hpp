@@ -24,7 +24,7 @@
 
 #include "HeapRegionList.hpp"
 #include "HeapRegionManager.hpp"
-#include "LockingHeapRegionQueue.hpp"
+#include "HeapRegionQueue.hpp"
 #include "RegionPool.hpp"
 #include "SweepSchemeSegregated.hpp"
 
@@ -34,7 +34,6 @@ class MM_EnvironmentBase;
 class MM_FreeHeapRegionList;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
-class MM_LockingHeapRegionQueue;
 
 #define PRIMARY_BUCKET 0
 #define SKIP_AVAILABLE_REGION_FOR_ALLOCATION 1
@@ -73,7 +72,7 @@ private:
 	 * defragmentation purposes prefers the least occupied regions while allocation prefers the
 	 * most occupied.
 	*/
-	MM_LockingHeapRegionQueue *_smallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1][NUM_DEFRAG_BUCKETS]; /**< Regions that are available to be given out to allocation contexts and aren't entirely free. */
+	MM_HeapRegionQueue **_smallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1][NUM_DEFRAG_BUCKETS]; /**< Regions that are available to be given out to allocation contexts and aren't entirely free. */
 	
 	/** 
 	 * @note Some of the full regions may be attached to AllocationContexts, and thus being actively
@@ -130,6 +129,10 @@ private:
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
+	volatile bool _isSweepingSmallConcurrently; /**< if the small regions left on the sweep lists by the last collection are being swept after it */
+	uintptr_t _concurrentSweepRegionCount; /**< Number of small regions left by the last collection to be swept after it */
+	volatile uintptr_t _concurrentSweepRegionsRemaining; /**< Number of small regions left by the last collection that have not finished being swept */
+	uintptr_t _sweepEpoch; /**< incremented each time the in use regions are moved to the sweep lists */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
 
@@ -151,6 +154,17 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	/**
+	 * Account for a small region swept after the collection. The thread that finishes the last one completes the
+	 * sweep as the collection's sweep would have: the available list buckets are joined and sweeping is turned off.
+	 */
+	void concurrentSweepSmallRegionDone(MM_EnvironmentBase *env);
+
+	/**
+	 * Join all of the available list buckets into the primary bucket, for every split index.
+	 */
+	void joinBucketLists(MM_EnvironmentBase *env);
 	
 protected:
 public:
@@ -168,6 +182,36 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep one small region left on the sweep lists by a concurrent sweep (see MM_GCExtensionsBase::segregatedConcurrentSweep),
+	 * and return it to the free, full or available lists as the collection's sweep would.
+	 * May be called by any number of threads between collections.
+	 * @return true if a region was swept, false if no concurrent sweep is in progress or there are no small regions left to sweep
+	 */
+	bool sweepPendingSmallRegion(MM_EnvironmentBase *env);
+
+	/**
+	 * Start sweeping the small regions on the sweep lists after the collection. Must be called by a single thread
+	 * at the end of the collection's sweep, in place of joining the buckets and turning off sweeping.
+	 */
+	void startConcurrentSweepSmall(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of small regions the last collection left to be swept after it
+	 */
+	MMINLINE uintptr_t getConcurrentSweepRegionCount() { return _concurrentSweepRegionCount; }
+
+	/**
+	 * @return the number of small regions left by the last collection that have not been swept yet
+	 */
+	MMINLINE uintptr_t getConcurrentSweepRegionsRemaining() { return _concurrentSweepRegionsRemaining; }
+
+	/**
+	 * @return the number of operations on the shared region lists that found the list in use by another thread,
+	 * since startup (see MM_HeapRegionList::getContentionCount)
+	 */
+	uintptr_t getContentionCount();
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -235,6 +279,14 @@ public:
 	void resetSkipAvailableRegionForAllocation() { memset(&_skipAvailableRegionForAllocation[0], 0, sizeof(_skipAvailableRegionForAllocation)); }
 
 	void updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy);
+
+	MMINLINE uintptr_t getSweepEpoch() { return _sweepEpoch; }
+
+	/**
+	 * @return true if the region has been swept since the in use regions were last moved to the sweep lists,
+	 * or was allocated from the free lists since then. Only swept regions may be handed out for allocation.
+	 */
+	MMINLINE bool isRegionSwept(MM_HeapRegionDescriptorSegregated *region) { return _sweepEpoch == region->getSweepEpoch(); }
 	
 
 	MMINLINE MM_FreeHeapRegionList *getSingleFreeList() { return _singleFreeList; }
@@ -245,7 +297,7 @@ public:
 	MMINLINE MM_HeapRegionQueue *getArrayletSweepRegions() { return _arrayletSweepRegions; }
 	MMINLINE MM_HeapRegionQueue *getArrayletFullRegions() { return _arrayletFullRegions; }
 	MMINLINE MM_HeapRegionQueue *getArrayletAvailableRegions() { return _arrayletAvailableRegions; }
-	MMINLINE MM_LockingHeapRegionQueue *getSmallAvailableRegions(uintptr_t sizeClass, uintptr_t defragBucket, uintptr_t splitList) { return &_smallAvailableRegions[sizeClass][defragBucket][splitList]; }
+	MMINLINE MM_HeapRegionQueue *getSmallAvailableRegions(uintptr_t sizeClass, uintptr_t defragBucket, uintptr_t splitList) { return _smallAvailableRegions[sizeClass][defragBucket][splitList]; }
 	MMINLINE MM_HeapRegionQueue *getSmallSweepRegions(uintptr_t sizeClass) { return _smallSweepRegions[sizeClass]; }
 	MMINLINE MM_HeapRegionQueue *getSmallFullRegions(uintptr_t sizeClass) { return _smallFullRegions[sizeClass]; }
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
@@ -271,6 +323,10 @@ public:
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
 		, _isSweepingSmall(false)
+		, _isSweepingSmallConcurrently(false)
+		, _concurrentSweepRegionCount(0)
+		, _concurrentSweepRegionsRemaining(0)
+		, _sweepEpoch(1)
 	{
 		_typeId = __FUNCTION__;
 	}
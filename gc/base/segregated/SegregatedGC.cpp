@@ -16,6 +16,7 @@
  *    Multiple authors (IBM Corp.) - initial implementation and documentation
  *******************************************************************************/
 
+#include "BackgroundSweeperSegregated.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "Dispatcher.hpp"
@@ -26,6 +27,7 @@
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
@@ -90,6 +92,16 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	/* the mark map is cleared at the start of each mark, so small regions can be left unswept until the next collection */
+	if (_extensions->segregatedConcurrentSweep) {
+		_sweepScheme->setSweepSmallConcurrently(true);
+		_backgroundSweeper = MM_BackgroundSweeperSegregated::newInstance(env);
+		if (NULL == _backgroundSweeper) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -108,6 +120,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (NULL != _backgroundSweeper) {
+		_backgroundSweeper->kill(env);
+		_backgroundSweeper = NULL;
+	}
 }
 
 bool
@@ -130,12 +147,19 @@ void MM_SegregatedGC::heapReconfigured(MM_EnvironmentBase* env)
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
-	return true;
+	bool result = true;
+	if (NULL != _backgroundSweeper) {
+		result = _backgroundSweeper->startup();
+	}
+	return result;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _backgroundSweeper) {
+		_backgroundSweeper->shutdown();
+	}
 }
 
 void *
@@ -180,6 +204,15 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	_extensions->globalGCStats.clear();
 	_extensions->globalGCStats.gcCount++;
 
+	if (NULL != _backgroundSweeper) {
+		/* account for the concurrent sweep left by the last collection, which internalPreCollect() stopped */
+		MM_RegionPoolSegregated *regionPool = ((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool();
+		MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+		sweepStats->concurrentSweepRegions = regionPool->getConcurrentSweepRegionCount();
+		sweepStats->concurrentSweepBackgroundRegions = _backgroundSweeper->getRegionsSwept();
+		sweepStats->concurrentSweepUnsweptRegions = regionPool->getConcurrentSweepRegionsRemaining();
+	}
+
 	/*
 	 * Marking
 	 */
@@ -215,6 +248,7 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->masterCleanupAfterGC(env);
 	markStats->_endTime = omrtime_hires_clock();
+	_extensions->latencyStats.record(GC_LATENCY_MARK, omrtime_hires_delta(markStats->_startTime, markStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 	reportMarkEnd(env);
 
 	/*
@@ -230,6 +264,7 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
 	activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
 	sweepStats->_endTime = omrtime_hires_clock();
+	_extensions->latencyStats.record(GC_LATENCY_SWEEP, omrtime_hires_delta(sweepStats->_startTime, sweepStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 	reportSweepEnd(env);
 
 	/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
@@ -262,6 +297,13 @@ MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 
 	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
 
+	/* The collection is about to use the region lists and the mark map. Regions that have not been swept yet stay on
+	 * the sweep lists and are swept by this collection.
+	 */
+	if (NULL != _backgroundSweeper) {
+		_backgroundSweeper->stopSweep(env);
+	}
+
 	/* The minimum free entry size is always re-adjusted at the end of a cycle.
 	 * But if the current cycle is triggered due to OOM, at the start of the cycle
 	 * set the minimum free entry size to the smallest size class.
@@ -301,6 +343,11 @@ MM_SegregatedGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 	reportGCIncrementEnd(env);
 	reportGCEnd(env);
 	reportGCCycleEnd(env);
+
+	/* Sweep the small regions left by the collection, alongside the allocating threads */
+	if (NULL != _backgroundSweeper) {
+		_backgroundSweeper->startSweep(env, memoryPool->getRegionPool());
+	}
 }
 
 
@@ -463,6 +510,12 @@ MM_SegregatedGC::reportGCEnd(MM_EnvironmentBase *env)
 		totalActiveMemorySizeTotal
 	);
 
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
+	Trc_OMRMM_RegionPoolSegregated_contention(env->getOmrVMThread(),
+		_extensions->segregatedLockFreeRegionLists ? 1 : 0,
+		memoryPool->getRegionPool()->getContentionCount()
+	);
+
 	/* these are assigned to temporary variable out-of-line since some preprocessors get confused if you have directives in macros */
 	uintptr_t approximateActiveFreeMemorySize = 0;
 	uintptr_t activeMemorySize = 0;
@@ -549,6 +602,9 @@ MM_SegregatedGC::reportGCIncrementEnd(MM_EnvironmentBase *env)
 	}
 
 	stats->_endTime = omrtime_hires_clock();
+	uint64_t pauseMicros = omrtime_hires_delta(stats->_startTime, stats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_extensions->latencyStats.record(GC_LATENCY_PAUSE, pauseMicros);
+	_extensions->heap->getResizeStats()->updateGlobalPauseHistory(pauseMicros);
 
 	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_END(
 		_extensions->privateHookInterface,
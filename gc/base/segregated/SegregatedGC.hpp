@@ -30,6 +30,8 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_BackgroundSweeperSegregated;
+
 class MM_SegregatedGC : public MM_GlobalCollector
 {
 	/*
@@ -40,6 +42,7 @@ protected:
 	OMRPortLibrary *_portLibrary;
 	MM_SegregatedMarkingScheme *_markingScheme;
 	MM_SweepSchemeSegregated *_sweepScheme;
+	MM_BackgroundSweeperSegregated *_backgroundSweeper; /**< Sweeps small regions between collections when the sweep is concurrent, otherwise NULL */
 	MM_Dispatcher *_dispatcher;
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
@@ -115,6 +118,7 @@ public:
 		, _portLibrary(env->getPortLibrary())
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
+		, _backgroundSweeper(NULL)
 		, _dispatcher(_extensions->dispatcher)
 		, _scanBytes(0)
 		, _objectsMarked(0)
@@ -116,11 +116,22 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
-	regionPool->joinBucketListsForSplitIndex(env);
+	/* A heap walk needs every small region swept now. Otherwise, with a concurrent sweep the small regions are left on
+	 * the sweep lists to be swept after the collection (see MM_RegionPoolSegregated::sweepPendingSmallRegion()), and
+	 * allocation keeps searching all of the available list buckets until the last of them has been swept.
+	 */
+	bool sweepSmallConcurrently = _sweepSmallConcurrently && !_isFixHeapForWalk;
+	if (!sweepSmallConcurrently) {
+		incrementalSweepSmall(env);
+		regionPool->joinBucketListsForSplitIndex(env);
+	}
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
-		regionPool->setSweepSmallPages(false);
+		if (sweepSmallConcurrently) {
+			regionPool->startConcurrentSweepSmall(env);
+		} else {
+			regionPool->setSweepSmallPages(false);
+		}
 		postSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -142,6 +153,7 @@ void
 MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region)
 {
 	region->getMemoryPoolACL()->resetCounts();
+	region->setSweepEpoch(_memoryPool->getRegionPool()->getSweepEpoch());
 
 	switch (region->getRegionType()) {
 
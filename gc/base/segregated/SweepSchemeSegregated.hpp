@@ -49,6 +49,7 @@ protected:
 private:
 	bool _isFixHeapForWalk;
 	bool _clearMarkMapAfterSweep; /**< If a region should be unmarked after it is swept */
+	bool _sweepSmallConcurrently; /**< If small regions are left to be swept after the collection */
 
 	/*
 	 * Function members
@@ -64,6 +65,14 @@ public:
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
+
+	/**
+	 * Leave small regions to be swept after the collection, on demand by allocating threads or by a background thread.
+	 * Regions are swept using the marks of the collection that left them, so the mark map must not be cleared before
+	 * the next mark starts. Regions still unswept then are swept by the next collection, so that mark must clear the map.
+	 */
+	bool isSweepSmallConcurrently() { return _sweepSmallConcurrently; }
+	void setSweepSmallConcurrently(bool sweepSmallConcurrently) { _sweepSmallConcurrently = sweepSmallConcurrently; }
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -82,6 +91,7 @@ protected:
 		,_markMap(markMap)
 		,_isFixHeapForWalk(false)
 		,_clearMarkMapAfterSweep(true)
+		,_sweepSmallConcurrently(false)
 	{
 		_typeId = __FUNCTION__;
 	};
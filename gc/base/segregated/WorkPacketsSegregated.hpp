@@ -48,6 +48,11 @@ private:
 protected:
 	virtual MM_WorkPacketOverflow *createOverflowHandler(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 
+	/**
+	 * Incremental marking may yield with packets outstanding, which the termination barrier of the deques does not support.
+	 */
+	virtual bool supportsWorkStealing() { return false; }
+
 public:
 	static MM_WorkPacketsSegregated  *newInstance(MM_EnvironmentBase *env);
 
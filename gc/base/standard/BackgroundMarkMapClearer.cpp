@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+#include "omrutil.h"
+
+#include "BackgroundMarkMapClearer.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "MarkMap.hpp"
+
+MM_BackgroundMarkMapClearer *
+MM_BackgroundMarkMapClearer::newInstance(MM_EnvironmentBase *env)
+{
+	MM_BackgroundMarkMapClearer *clearer = (MM_BackgroundMarkMapClearer *)env->getForge()->allocate(sizeof(MM_BackgroundMarkMapClearer), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != clearer) {
+		new(clearer) MM_BackgroundMarkMapClearer(env);
+		if (!clearer->initialize(env)) {
+			clearer->kill(env);
+			clearer = NULL;
+		}
+	}
+	return clearer;
+}
+
+void
+MM_BackgroundMarkMapClearer::captureCommittedRanges(MM_EnvironmentBase *env)
+{
+	_rangeCount = 0;
+
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator regionIterator(_extensions->getHeap()->getHeapRegionManager());
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted() && (0 != region->getSize())) {
+			/* insertion sort by address, dropping the highest range when full */
+			uintptr_t index = _rangeCount;
+			if (BACKGROUND_MARK_MAP_CLEAR_MAXIMUM_RANGES == index) {
+				if (region->getLowAddress() > _rangeLow[index - 1]) {
+					continue;
+				}
+				index -= 1;
+			} else {
+				_rangeCount += 1;
+			}
+			while ((0 < index) && (region->getLowAddress() < _rangeLow[index - 1])) {
+				_rangeLow[index] = _rangeLow[index - 1];
+				_rangeHigh[index] = _rangeHigh[index - 1];
+				index -= 1;
+			}
+			_rangeLow[index] = region->getLowAddress();
+			_rangeHigh[index] = region->getHighAddress();
+		}
+	}
+}
+
+void
+MM_BackgroundMarkMapClearer::doWork(MM_EnvironmentBase *env)
+{
+	uintptr_t regionSize = _extensions->regionSize;
+
+	for (uintptr_t index = 0; index < _rangeCount; index++) {
+		uint8_t *clearAddress = (uint8_t *)_rangeLow[index];
+		uint8_t *rangeHigh = (uint8_t *)_rangeHigh[index];
+		while (clearAddress < rangeHigh) {
+			if (isStopRequested()) {
+				return;
+			}
+			uintptr_t clearSize = OMR_MIN(regionSize, (uintptr_t)(rangeHigh - clearAddress));
+			_markMap->clearMarkMapForHeapRange(env, clearAddress, clearSize);
+			clearAddress += clearSize;
+			_cleanHeapTop = clearAddress;
+		}
+	}
+}
+
+void
+MM_BackgroundMarkMapClearer::startClear(MM_EnvironmentBase *env, MM_MarkMap *markMap)
+{
+	if (isIdle()) {
+		_markMap = markMap;
+		_markMap->setCleanHeapTop(NULL);
+		_cleanHeapTop = NULL;
+		captureCommittedRanges(env);
+		requestWork();
+	}
+}
+
+void
+MM_BackgroundMarkMapClearer::stopClear(MM_EnvironmentBase *env, bool retainProgress)
+{
+	stopWork();
+	if (NULL != _markMap) {
+		_markMap->setCleanHeapTop(retainProgress ? _cleanHeapTop : NULL);
+		_markMap = NULL;
+	}
+}
+
+MM_BackgroundMarkMapClearer::MM_BackgroundMarkMapClearer(MM_EnvironmentBase *env)
+	: MM_BackgroundWorker(env, "Mark Map Clear Helper")
+	, _markMap(NULL)
+	, _rangeCount(0)
+	, _cleanHeapTop(NULL)
+{
+	_typeId = __FUNCTION__;
+}
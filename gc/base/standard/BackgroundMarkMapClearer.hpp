@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(BACKGROUNDMARKMAPCLEARER_HPP_)
+#define BACKGROUNDMARKMAPCLEARER_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BackgroundWorker.hpp"
+
+class MM_EnvironmentBase;
+class MM_MarkMap;
+
+#define BACKGROUND_MARK_MAP_CLEAR_MAXIMUM_RANGES 16
+
+/**
+ * Clears the mark map on a dedicated thread between global collections, so that the next mark
+ * does not have to clear it in the stop-the-world pause.
+ * The committed heap ranges are captured when a clear is requested and are cleared in address order, one
+ * region at a time. When the clear is stopped, the address below which all committed heap has been
+ * cleared is recorded in the mark map (see MM_MarkMap::setCleanHeapTop()) for initializeMarkMap() to skip.
+ * The clear must be stopped before anything else uses the mark map, and before committed heap changes.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_BackgroundMarkMapClearer : public MM_BackgroundWorker
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	MM_MarkMap *_markMap; /**< The mark map being cleared */
+	void *_rangeLow[BACKGROUND_MARK_MAP_CLEAR_MAXIMUM_RANGES]; /**< Base addresses of the committed heap ranges to clear, in ascending order */
+	void *_rangeHigh[BACKGROUND_MARK_MAP_CLEAR_MAXIMUM_RANGES]; /**< Top addresses of the committed heap ranges to clear */
+	uintptr_t _rangeCount; /**< Number of ranges to clear */
+	void * volatile _cleanHeapTop; /**< All committed heap below this address has been cleared by the clear thread */
+
+/*
+ * Function members
+ */
+public:
+	static MM_BackgroundMarkMapClearer *newInstance(MM_EnvironmentBase *env);
+
+	/**
+	 * Request that the clear thread clear the specified mark map for all committed heap.
+	 * Must be called with exclusive VM access, once no further use of the mark map is pending in this cycle.
+	 * @param markMap the mark map to clear
+	 */
+	void startClear(MM_EnvironmentBase *env, MM_MarkMap *markMap);
+
+	/**
+	 * Stop the clear in progress, if any, and wait for the clear thread to become idle.
+	 * @param retainProgress if true, record the range cleared so far in the mark map so that the next
+	 * initializeMarkMap() skips it; otherwise the whole map will be cleared again
+	 */
+	void stopClear(MM_EnvironmentBase *env, bool retainProgress);
+
+	MM_BackgroundMarkMapClearer(MM_EnvironmentBase *env);
+
+protected:
+	/**
+	 * Clear the captured ranges one region at a time, until done or asked to stop.
+	 */
+	virtual void doWork(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Record the committed heap ranges, lowest address first, keeping at most BACKGROUND_MARK_MAP_CLEAR_MAXIMUM_RANGES.
+	 */
+	void captureCommittedRanges(MM_EnvironmentBase *env);
+};
+
+#endif /* BACKGROUNDMARKMAPCLEARER_HPP_ */
@@ -96,12 +96,17 @@ makeMask(intptr_t maskSize)
 MMINLINE intptr_t
 countBits(uintptr_t x)
 {
+#if defined(__GNUC__)
+	/* getObjectOrdinal() counts the compressed mark bits below an object for every forwarded slot */
+	return (intptr_t)__builtin_popcountll((unsigned long long)x);
+#else /* __GNUC__ */
     intptr_t count = 0;
     while (x) {
         count++;
         x &= x-1;
     }
     return count;
+#endif /* __GNUC__ */
 }
 
 /************************************************************
@@ -556,20 +561,46 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	 *  o the J9HOOK_MM_OMR_OBJECT_RENAME hook has registered users. JVMPI does not support events being issued
 	 * 	  in parallel so we force single sub area compact to ensure all events issued under master GC thread.
 	 */
+	bool objectRenameHooked = J9_EVENT_IS_HOOKED(_extensions->omrHookInterface, J9HOOK_MM_OMR_OBJECT_RENAME);
 	if (aggressive ||
 		1 == env->_currentTask->getThreadCount() ||
-		J9_EVENT_IS_HOOKED(_extensions->omrHookInterface, J9HOOK_MM_OMR_OBJECT_RENAME)) {
+		objectRenameHooked) {
 		singleThreaded = true;
 	}
 
+	/* Sliding compaction leaves a single hole per segment even when run in parallel, so it is used for
+	 * aggressive compactions too, but not when object renames have to be reported on the master thread.
+	 */
+	bool sliding = _extensions->parallelSlidingCompact && !objectRenameHooked;
+	if (sliding) {
+		singleThreaded = false;
+	}
+
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
 	workerSetupForGC(env, singleThreaded);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
+	if (sliding) {
+		env->_compactStats._planStartTime = omrtime_hires_clock();
+		planSlide(env);
+		env->_compactStats._planEndTime = omrtime_hires_clock();
+
+		env->_compactStats._moveStartTime = omrtime_hires_clock();
+		slideObjects(env, objectCount, byteCount);
+		env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+		/* forwarding addresses of any page may be needed to fix up any object */
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
+
+		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupSlidObjects(env, fixupObjectsCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	}
 	/* If a single threaded compaction force compact to run on master thread. Required
 	 * to ensure all events issued on master thread.
 	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+	else if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
 		moveObjects(env, objectCount, byteCount, skippedObjectCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
@@ -613,7 +644,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (sliding) {
+			rebuildMarkbitsAfterSlide(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -1397,6 +1432,262 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 	}
 }
 
+/**
+ * Sliding compaction plan.
+ *
+ * Every live object slides down towards the base of its segment, so the destination of a subarea is the
+ * base of its segment plus the live bytes of the subareas below it. The live bytes are counted from the
+ * mark map in parallel; the prefix sums, and the range of lower subareas whose source addresses each
+ * destination overlaps, are cheap enough to compute on the master thread.
+ */
+void
+MM_CompactScheme::planSlide(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* multi threaded pass to count live bytes */
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::planning)) {
+				uintptr_t *end = (uintptr_t *)pageStart(pageIndex(subAreaTable[i+1].firstObject));
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, end);
+				omrobjectptr_t objectPtr = NULL;
+				uintptr_t liveBytes = 0;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+				}
+				subAreaTable[i].liveBytes = liveBytes;
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	/* single threaded pass to assign destinations and dependencies */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		GC_HeapRegionIteratorStandard regionIterator2(_rootManager);
+		subAreaTable = _subAreaTable;
+		while (NULL != (region = regionIterator2.nextRegion())) {
+			if (!region->isCommitted() || (0 == region->getSize())) {
+				continue;
+			}
+			omrobjectptr_t destination = subAreaTable[0].firstObject;
+			intptr_t i;
+			for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+				/* Objects only grow when they move, so liveBytes may overstate what the subareas below
+				 * actually use. Never slide a subarea up past its own first object.
+				 */
+				if (destination > subAreaTable[i].firstObject) {
+					destination = subAreaTable[i].firstObject;
+				}
+				subAreaTable[i].destination = destination;
+				destination = (omrobjectptr_t)((uintptr_t)destination + subAreaTable[i].liveBytes);
+			}
+			if (destination > subAreaTable[i].firstObject) {
+				destination = subAreaTable[i].firstObject;
+			}
+			subAreaTable[i].destination = destination;
+			intptr_t segmentEnd = i;
+
+			/* A subarea is slid into [destination, next destination), which overlaps the source addresses of
+			 * subareas firstDependency to lastDependency. Both move up monotonically with the destinations.
+			 */
+			uintptr_t first = 0;
+			uintptr_t last = 0;
+			for (i = 0; i < segmentEnd; i++) {
+				omrobjectptr_t destinationEnd = subAreaTable[i+1].destination;
+				while (subAreaTable[first+1].firstObject <= subAreaTable[i].destination) {
+					first += 1;
+				}
+				while (subAreaTable[last+1].firstObject < destinationEnd) {
+					last += 1;
+				}
+				subAreaTable[i].firstDependency = first;
+				subAreaTable[i].lastDependency = last;
+
+				/* everything above the final top of the segment is free once all subareas have moved */
+				omrobjectptr_t top = subAreaTable[segmentEnd].destination;
+				if (subAreaTable[i+1].firstObject <= top) {
+					subAreaTable[i].freeChunk = NULL;
+				} else if (subAreaTable[i].firstObject >= top) {
+					subAreaTable[i].freeChunk = subAreaTable[i].firstObject;
+				} else {
+					subAreaTable[i].freeChunk = top;
+				}
+			}
+			subAreaTable += (segmentEnd+1);
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		MM_MemorySubSpace *subspace = region->getSubSpace();
+		intptr_t i;
+		/* Subareas are claimed in address order, so every subarea a claimed one waits for has been claimed
+		 * already and the lowest unfinished subarea can always proceed.
+		 */
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating)) {
+				uintptr_t lastDependency = subAreaTable[i].lastDependency;
+				for (uintptr_t j = subAreaTable[i].firstDependency; (j <= lastDependency) && (j < (uintptr_t)i); j++) {
+					while (SubAreaEntry::init == subAreaTable[j].state) {
+						MM_AtomicOperations::yieldCPU();
+					}
+				}
+				MM_AtomicOperations::loadSync();
+
+				slideSubArea(env, subspace, subAreaTable, i, objectCount, byteCount);
+
+				MM_AtomicOperations::storeSync();
+				uintptr_t state = MM_AtomicOperations::lockCompareExchange(&subAreaTable[i].state, SubAreaEntry::init, SubAreaEntry::full);
+				Assert_MM_true(state == SubAreaEntry::init);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::slideSubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	omrobjectptr_t deadObject = subAreaTable[i].destination;
+	omrobjectptr_t destinationEnd = subAreaTable[i+1].destination;
+	uintptr_t *end = (uintptr_t *)pageStart(pageIndex(subAreaTable[i+1].firstObject));
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, end);
+
+	omrobjectptr_t objectPtr = NULL;
+	intptr_t page = -1; /* invalid value */
+	intptr_t counter = 0; /* obj on page, first is zero */
+	CompactTableEntry entry;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+
+		/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+		saveForwardingPtr(entry, objectPtr, deadObject, page, counter);
+
+		if (deadObject == objectPtr) {
+			/* objects that do not move do not grow */
+			deadObject = (omrobjectptr_t)((uintptr_t)deadObject + objectSize);
+			continue;
+		}
+		Assert_MM_true(deadObject < objectPtr);
+
+		uintptr_t objectSizeAfterMove = _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+
+		TRIGGER_J9HOOK_MM_OMR_OBJECT_RENAME(env->getExtensions()->omrHookInterface, env->getOmrVMThread(), objectPtr, deadObject);
+
+		objectCount += 1;
+		byteCount += objectSizeAfterMove;
+
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+		_extensions->objectModel.preMove(env->getOmrVMThread(), objectPtr);
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
+		memmove(deadObject, objectPtr, objectSize);
+
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+		_extensions->objectModel.postMove(env->getOmrVMThread(), deadObject);
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
+		deadObject = (omrobjectptr_t)((uintptr_t)deadObject + objectSizeAfterMove);
+	}
+
+	if (page != -1) {
+		_compactTable[page] = entry;
+	}
+
+	/* Objects that did not move did not grow, so the subarea may end short of where the next one starts.
+	 * Anything above the top of the segment is turned into free list entries by rebuildFreelist().
+	 */
+	Assert_MM_true(deadObject <= destinationEnd);
+	setFreeChunk(deadObject, destinationEnd);
+}
+
+void
+MM_CompactScheme::fixupSlidObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
+				if (subAreaTable[i].destination < subAreaTable[i+1].destination) {
+					fixupSubArea(env, subAreaTable[i].destination, subAreaTable[i+1].destination, false, objectCount);
+				}
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsAfterSlide(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* The compact table overlays the mark map, so all of it has to be cleared before any bit is set */
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+				_markMap->setBitsInRange(env, pageStart(pageIndex(subAreaTable[i].firstObject)), pageStart(pageIndex(subAreaTable[i+1].firstObject)), true);
+			}
+		}
+		subAreaTable += (i+1);
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/* Subareas slide into shared pages, so the bits are set atomically */
+	GC_HeapRegionIteratorStandard regionIterator2(_rootManager);
+	subAreaTable = _subAreaTable;
+	while (NULL != (region = regionIterator2.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::setting_mark_bits)) {
+				if (subAreaTable[i].destination < subAreaTable[i+1].destination) {
+					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, subAreaTable[i].destination, subAreaTable[i+1].destination, false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						_markMap->atomicSetBit(objectPtr);
+					}
+				}
+			}
+		}
+		subAreaTable += (i+1);
+	}
+}
+
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
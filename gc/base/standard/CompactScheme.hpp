@@ -86,6 +86,10 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		omrobjectptr_t destination; /**< sliding compact: address the live objects of the subarea slide down to */
+		uintptr_t liveBytes; /**< sliding compact: bytes the live objects of the subarea occupy once moved */
+		uintptr_t firstDependency; /**< sliding compact: lowest subarea whose objects must be moved before this one can be slid */
+		uintptr_t lastDependency; /**< sliding compact: highest subarea whose objects must be moved before this one can be slid */
         
     	/* legal values for currentAction */
     	enum {
@@ -94,7 +98,9 @@ private:
     		evacuating,
     		fixing_up,
     		rebuilding_mark_bits,
-    		fixing_heap_for_walk
+    		fixing_heap_for_walk,
+    		planning,
+    		setting_mark_bits
     	};
     	
     	/* legal values for state
@@ -209,6 +215,52 @@ protected:
     void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
+	/**
+	 * Sliding compact: count the live bytes of each subarea in parallel, then assign every subarea the
+	 * destination its objects slide down to and the range of lower subareas it has to wait for.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void planSlide(MM_EnvironmentStandard *env);
+
+	/**
+	 * Sliding compact: claim subareas in address order and slide each one to its planned destination
+	 * once the subareas its destination overlaps have been moved out.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Sliding compact: move the objects of subarea i to its planned destination, recording their
+	 * forwarding addresses in the compact table.
+	 *
+	 * @param env[in] the current thread
+	 * @param memorySubSpace[in] the subspace the subarea belongs to
+	 * @param subAreaTable[in] the subareas of the segment
+	 * @param[in] i The subarea to slide
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideSubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Sliding compact: fix up the objects each subarea slid, at their new addresses.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 */
+	void fixupSlidObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
+
+	/**
+	 * Sliding compact: rebuild the mark bits once objects have moved across subarea boundaries.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void rebuildMarkbitsAfterSlide(MM_EnvironmentStandard *env);
+
     void rebuildFreelist(MM_EnvironmentStandard *env);
 
     void addFreeEntry(MM_EnvironmentStandard *env,
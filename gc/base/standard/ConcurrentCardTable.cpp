@@ -1040,7 +1040,9 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentStandard *env)
  *
  * To be called by a STW parallel mark task to clean enough cards such that we
  * push a packet worth of references.  Loops calling getNextDirtyCard() until
- * we have pushed enough references or end of card table reached.
+ * we have pushed enough references or end of card table reached. Each call
+ * claims a run of up to cardCleaningMaxRunLength adjacent dirty cards which are
+ * then retraced with a single pass over the mark map.
  *
  * @param bytesTraced  - reference to counter to pass back count of bytes traced
  * 						 to caller
@@ -1067,28 +1069,42 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentStandard *env, uintptr_t *
 
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
+	Card *runTop = NULL;
+	uintptr_t maxRunLength = _extensions->cardCleaningMaxRunLength;
+
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false, &runTop, maxRunLength)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
 		assume0(nextDirtyCard != (Card *)EXCLUSIVE_VMACCESS_REQUESTED);
+		assume0(runTop > nextDirtyCard);
+
+		uintptr_t runLength = runTop - nextDirtyCard;
 
-		/* Reset counters if we are now cleaning phase 2 cards */
-		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
+		/* Reset counters if we are now cleaning phase 2 cards; the run may start in phase 1 */
+		if (!phase2 && runTop > _firstCardInPhase2) {
+			if (nextDirtyCard < _firstCardInPhase2) {
+				cards += _firstCardInPhase2 - nextDirtyCard;
+			}
 			incFinalCleanedCards(cards, phase2);
-			cards = 0;
+			cards = (nextDirtyCard < _firstCardInPhase2) ? (runTop - _firstCardInPhase2) : runLength;
 			phase2 = true;
+		} else {
+			cards += runLength;
 		}
+		env->_cardCleaningStats._cardsCleaned += runLength;
+		env->_cardCleaningStats.addCardRun(runLength);
 
-		/* Clean the card before we trace into it */
-		finalCleanCard(nextDirtyCard);
-		cards += 1;
+		/* Clean the cards before we trace into them */
+		for (Card *card = nextDirtyCard; card < runTop; card++) {
+			finalCleanCard(card);
+		}
 
-		/* Calculate address of first slot heap for the card to be cleaned... */
+		/* Calculate address of first slot heap for the cards to be cleaned... */
 		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
 		/* ..and address of last slot N.B Range is EXCLUSIVE */
-		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + (runLength * CARD_SIZE));
 
 		/* Then iterate over all marked objects in the heap between the two addresses */
 		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
@@ -1605,13 +1621,16 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentStandard *env)
  *
  * @param cardMask - mask to apply to cards to identify those cards the caller
  * 					 is interested in
+ * @param runTop - if not NULL, claim the run of up to maxRunLength adjacent dirty cards
+ * 					 starting at the returned card and return the card after the run here
+ * @param maxRunLength - the most cards to claim when runTop is not NULL
  *
  * @return Routine either returns address of next dirty card, NULL if no
  * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
  * for exclusive VM access.
  */
 Card*
-MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean)
+MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean, Card **runTop, uintptr_t maxRunLength)
 {
 	/* Get a local copy of next current range being cleaned */
 	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
@@ -1633,68 +1652,40 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardM
 		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
-		Card *nextDirtyCard, *currentCard;
-
-		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
-
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
-
-				if (currentCard >= lastCardToClean) {
-					break;
-				}
-			}
-
-			/* Have we found a card of interest yet ? */
-			if (0 == (*currentCard & cardMask)) {
-				/* No..so get next card. */
-				continue;
-			}
-
-			/* Yes..so check to see if another thread got to next dirty card before us ? */
-			if (firstCard != (Card *)currentRange->nextCard) {
-				/* Yes..so re-sync with race winner and start scan again */
-				break;
+		Card *nextDirtyCard = NULL;
+		Card *currentCard = MM_CardTable::findDirtyCard(firstCard, lastCardToClean, cardMask);
+
+		/* Have we found a card of interest, and if so did another thread get to it before us ? */
+		if ((currentCard < lastCardToClean) && (firstCard == (Card *)currentRange->nextCard)) {
+			/* No .. so attempt to grab this card, and any dirty cards which immediately follow it */
+			nextDirtyCard = currentCard;
+			if (NULL != runTop) {
+				currentCard = MM_CardTable::findDirtyCardRunTop(nextDirtyCard, lastCardToClean, cardMask, maxRunLength);
+				*runTop = currentCard;
 			} else {
-				/* No .. so attempt to grab this card*/
-				nextDirtyCard = currentCard;
 				currentCard += 1;
-				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
-					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
-				}
+			}
+			if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+				return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
+			}
 
-				/* Update next card to clean for next caller of getNextDirtyCard. If we fail
-				 * then someone beat us to it so re-sync with race winner and start again
-				 */
-				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-											  							  (uintptr_t)firstCard,
-											  							  (uintptr_t)currentCard)) {
-					break;
-				}
-				
+			/* Update next card to clean for next caller of getNextDirtyCard. If we fail
+			 * then someone beat us to it so re-sync with race winner and start again
+			 */
+			if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+										  							  (uintptr_t)firstCard,
+										  							  (uintptr_t)currentCard)) {
 				return nextDirtyCard;
 			}
-		} /* of currentCard < lastCardToClean */
 
-		/* We get here if we break out of FOR loop when another thread beat us to next
-		 * dirty card or we reach then end of the card table.
+			/* Step back inside the range so a claim which reached the last card does
+			 * not look like the end of the range below
+			 */
+			currentCard = nextDirtyCard;
+		}
+
+		/* We get here if another thread beat us to next dirty card or we
+		 * reach then end of the card table.
 		 *
 		 * Did we reach end of card table segment ?
 		 */
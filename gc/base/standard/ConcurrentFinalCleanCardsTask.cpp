@@ -20,6 +20,7 @@
 
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 
+#include "ConcurrentCardTable.hpp"
 #include "ConcurrentGC.hpp"
 
 #include "ConcurrentFinalCleanCardsTask.hpp"
@@ -40,6 +41,7 @@ MM_ConcurrentFinalCleanCardsTask::setup(MM_EnvironmentBase *env)
 		Assert_MM_true(NULL == env->_cycleState);
 		env->_cycleState = _cycleState;
 	}
+	env->_cardCleaningStats.clear();
 }
 
 void
@@ -50,6 +52,7 @@ MM_ConcurrentFinalCleanCardsTask::cleanup(MM_EnvironmentBase *env)
 	} else {
 		env->_cycleState = NULL;
 	}
+	_collector->getCardTable()->getCardTableStats()->mergeFinalCardCleaningStats(&env->_cardCleaningStats);
 }
 
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
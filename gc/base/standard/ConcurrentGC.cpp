@@ -3045,7 +3045,9 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
         /* reset overflow flag */
     	_markingScheme->getWorkPackets()->clearOverflowFlag();
 
-    	reportConcurrentFinalCardCleaningEnd(envStandard, omrtime_hires_clock() - startTime);
+    	uint64_t finalCleanTime = omrtime_hires_clock() - startTime;
+    	_extensions->latencyStats.record(GC_LATENCY_CARD_CLEAN, omrtime_hires_delta(0, finalCleanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+    	reportConcurrentFinalCardCleaningEnd(envStandard, finalCleanTime);
 
 		assume(_cardTable->isCardTableEmpty(envStandard),"internalPreCollect: card cleaning has failed to clean all cards");
 
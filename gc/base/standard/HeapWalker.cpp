@@ -26,17 +26,23 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionIterator.hpp"
+#include "HeapMemoryPoolIterator.hpp"
 #include "HeapRegionManager.hpp"
+#include "MemoryPool.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectIterator.hpp"
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
+#include "ParallelHeapWalkTask.hpp"
 #include "SlotObject.hpp"
 #include "SublistIterator.hpp"
 #include "SublistSlotIterator.hpp"
 #include "Task.hpp"
 
+/* Size of the sections a region is cut into for a parallel walk */
+#define HEAP_WALKER_SECTION_SIZE ((uintptr_t)256 * 1024)
+
 /**
  * Auxilary structure too pass both function and userData as one param to heap walker
  */
@@ -165,9 +171,10 @@ MM_HeapWalker::allObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlotFunc f
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/* If J9_MU_WALK_NEW_AND_REMEMBERED_ONLY is specified, and rsOverflow has
-	 * occurred, any object in old space might be remembered, so we must walk them all
+	 * occurred or the remembered set is a card table, any object in old space
+	 * might be remembered, so we must walk them all
 	 */
-	if (env->getExtensions()->isRememberedSetInOverflowState()) {
+	if (env->getExtensions()->isRememberedSetInOverflowState() || env->getExtensions()->scavengerCardMarking) {
 		modifiedWalkFlags &= ~J9_MU_WALK_NEW_AND_REMEMBERED_ONLY;
 	}
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -216,3 +223,156 @@ MM_HeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc fun
 		}
 	}
 }
+
+/**
+ * Find the section covering an address.
+ * @return the section, or NULL if the address is not in a section
+ */
+static MM_ParallelHeapWalkSection *
+findSection(MM_ParallelHeapWalkSection *sections, uintptr_t sectionCount, void *address)
+{
+	/* Find the last section with a low address at or below the address */
+	uintptr_t low = 0;
+	uintptr_t high = sectionCount;
+	while (low < high) {
+		uintptr_t middle = low + ((high - low) / 2);
+		if (sections[middle].low <= address) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	MM_ParallelHeapWalkSection *section = NULL;
+	if (0 < low) {
+		section = &sections[low - 1];
+		void *sectionTop = (void *)((uintptr_t)section->low + HEAP_WALKER_SECTION_SIZE);
+		void *regionTop = section->region->getHighAddress();
+		if ((address >= sectionTop) || (address >= regionTop)) {
+			section = NULL;
+		}
+	}
+	return section;
+}
+
+/**
+ * Walk all objects in the heap with the dispatcher's GC threads.
+ * Objects can only be found by walking forward from the start of a region, or from a free list entry
+ * (which is a hole), so each region is cut into fixed size sections and each section is walked from
+ * the lowest free list entry in it to the first free list entry of a later section. Sections without
+ * a free list entry are walked by the section before them.
+ */
+bool
+MM_HeapWalker::parallelObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerParallelObjectFunc function, MM_HeapWalkerMergeFunc merge, void *userData, uintptr_t threadDataSize, uintptr_t walkFlags, uintptr_t threadCount)
+{
+	uintptr_t typeFlags = 0;
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+	if (walkFlags & J9_MU_WALK_NEW_AND_REMEMBERED_ONLY) {
+		typeFlags |= MEMORY_TYPE_NEW;
+	}
+
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	MM_HeapRegionDescriptor *region = NULL;
+
+	/* Count the sections, so the table can be allocated in one piece */
+	uintptr_t sectionCount = 0;
+	GC_HeapRegionIterator countIterator(regionManager);
+	while (NULL != (region = countIterator.nextRegion())) {
+		if (typeFlags == (region->getTypeFlags() & typeFlags)) {
+			uintptr_t regionSize = (uintptr_t)region->getHighAddress() - (uintptr_t)region->getLowAddress();
+			sectionCount += (regionSize + HEAP_WALKER_SECTION_SIZE - 1) / HEAP_WALKER_SECTION_SIZE;
+		}
+	}
+
+	uintptr_t threadCountMaximum = extensions->dispatcher->threadCountMaximum();
+	if ((0 == threadCount) || (threadCount > threadCountMaximum)) {
+		threadCount = threadCountMaximum;
+	}
+
+	MM_ParallelHeapWalkSection *sections = NULL;
+	if (0 != sectionCount) {
+		sections = (MM_ParallelHeapWalkSection *)env->getForge()->allocate(sectionCount * sizeof(MM_ParallelHeapWalkSection), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == sections) {
+			return false;
+		}
+	}
+	uint8_t *threadData = NULL;
+	if (0 != threadDataSize) {
+		threadData = (uint8_t *)env->getForge()->allocate(threadCountMaximum * threadDataSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == threadData) {
+			if (NULL != sections) {
+				env->getForge()->free(sections);
+			}
+			return false;
+		}
+		memset(threadData, 0, threadCountMaximum * threadDataSize);
+	}
+
+	/* Lay out the sections in address order. Only the first section of a region is known to start on an object. */
+	uintptr_t sectionIndex = 0;
+	GC_HeapRegionIterator regionIterator(regionManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (typeFlags == (region->getTypeFlags() & typeFlags)) {
+			for (uint8_t *low = (uint8_t *)region->getLowAddress(); low < (uint8_t *)region->getHighAddress(); low += HEAP_WALKER_SECTION_SIZE) {
+				MM_ParallelHeapWalkSection *section = &sections[sectionIndex];
+				section->region = region;
+				section->low = low;
+				section->base = (low == region->getLowAddress()) ? low : NULL;
+				section->top = NULL;
+				sectionIndex += 1;
+			}
+		}
+	}
+
+	/* Start each section on the lowest free list entry in it. Entries are visited in no particular order. */
+	MM_HeapMemoryPoolIterator poolIterator(env, extensions->heap);
+	MM_MemoryPool *memoryPool = NULL;
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		void *freeEntry = memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			MM_ParallelHeapWalkSection *section = findSection(sections, sectionCount, freeEntry);
+			if ((NULL != section) && ((NULL == section->base) || (freeEntry < section->base))) {
+				section->base = freeEntry;
+			}
+			freeEntry = memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+	}
+
+	/* Each section is walked up to the start of the next section of its region that has one */
+	void *nextBase = NULL;
+	MM_HeapRegionDescriptor *nextRegion = NULL;
+	for (uintptr_t index = sectionCount; index > 0; index--) {
+		MM_ParallelHeapWalkSection *section = &sections[index - 1];
+		if (section->region != nextRegion) {
+			nextRegion = section->region;
+			nextBase = nextRegion->getHighAddress();
+		}
+		section->top = nextBase;
+		if (NULL != section->base) {
+			nextBase = section->base;
+		}
+	}
+
+	MM_ParallelHeapWalkTask walkTask(env, extensions->dispatcher, sections, sectionCount, function, userData, threadData, threadDataSize, threadCount);
+	extensions->dispatcher->run(env, &walkTask);
+
+	if ((NULL != merge) && (NULL != threadData)) {
+		OMR_VMThread *omrVMThread = env->getOmrVMThread();
+		/* the dispatcher activates no more than the recommended threadCount */
+		uintptr_t walkThreadCount = walkTask.getThreadCount();
+		for (uintptr_t slaveID = 0; slaveID < walkThreadCount; slaveID++) {
+			merge(omrVMThread, userData, threadData + (slaveID * threadDataSize));
+		}
+	}
+
+	if (NULL != threadData) {
+		env->getForge()->free(threadData);
+	}
+	if (NULL != sections) {
+		env->getForge()->free(sections);
+	}
+	return true;
+}
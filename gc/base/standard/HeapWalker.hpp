@@ -32,6 +32,8 @@ class MM_MemorySubSpace;
 
 typedef void (*MM_HeapWalkerObjectFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t, void *);
 typedef void (*MM_HeapWalkerSlotFunc)(OMR_VM *, omrobjectptr_t *, void *, uint32_t);
+typedef void (*MM_HeapWalkerParallelObjectFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t, void *, void *);
+typedef void (*MM_HeapWalkerMergeFunc)(OMR_VMThread *, void *, void *);
 
 class MM_HeapWalker : public MM_BaseVirtual
 {
@@ -46,6 +48,20 @@ public:
 	virtual void allObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlotFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk all objects in the heap with the dispatcher's GC threads.
+	 * The regions are cut into sections that start on free list entries, which are walked concurrently.
+	 * function is called for each object with userData, which is shared, and the data of the calling
+	 * thread, which is zeroed before the walk. Once the walk is complete merge is called on the calling
+	 * thread for the data of each thread that took part. The caller must have exclusive access to the heap.
+	 * @param function called for each object as function(omrVMThread, region, object, userData, threadData)
+	 * @param merge called for each thread's data as merge(omrVMThread, userData, threadData), may be NULL
+	 * @param threadDataSize size of the data of each thread, may be 0
+	 * @param threadCount maximum number of threads to walk with, or 0 to use all of the GC threads
+	 * @return true if the walk was done, false if the memory to partition the heap could not be allocated
+	 */
+	virtual bool parallelObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerParallelObjectFunc function, MM_HeapWalkerMergeFunc merge, void *userData, uintptr_t threadDataSize, uintptr_t walkFlags, uintptr_t threadCount);
+
 	static MM_HeapWalker *newInstance(MM_EnvironmentBase *env); 	
 	virtual void kill(MM_EnvironmentBase *env);
 	
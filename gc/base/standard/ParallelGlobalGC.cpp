@@ -26,6 +26,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationFailureStats.hpp"
+#include "BackgroundMarkMapClearer.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -51,6 +52,7 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "ParallelCompactTask.hpp"
 #endif /* OMR_GC_MODRON_COMPACTION */
+#include "ParallelRememberedSetRebuildTask.hpp"
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -142,6 +144,14 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	/* The mark map is in use between collections while concurrent mark or concurrent sweep is running */
+	if (_extensions->backgroundMarkMapClear && !_extensions->isConcurrentMarkEnabled() && !_extensions->isConcurrentSweepEnabled()) {
+		_markMapClearer = MM_BackgroundMarkMapClearer::newInstance(env);
+		if (NULL == _markMapClearer) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -174,6 +184,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 	
 	_cli->parallelGlobalGC_destroyHeapWalker(env);
 
+	if(NULL != _markMapClearer) {
+		_markMapClearer->kill(env);
+		_markMapClearer = NULL;
+	}
+
 	if(NULL != _markingScheme) {
 		_markingScheme->kill(env);
 		_markingScheme = NULL;
@@ -258,6 +273,11 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 
 	/* ----- end of setupForCollect ------*/
 	
+	bool rebuildRememberedSet = false;
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE)
+	rebuildRememberedSet = (NULL != _extensions->scavenger) && _extensions->scavenger->isRememberedSetCardTable();
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE) */
+
 	/* Run a garbage collect */
 
 	/* Mark */	
@@ -281,7 +301,8 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 			_collectionStatistics._tenureFragmentation |= MACRO_FRAGMENTATION;
 		}
 
-		masterThreadCompact(env, allocDescription, rebuildMarkBits);
+		/* the scavenger's card table remembered set is rebuilt from the mark map, so it needs the moved objects marked */
+		masterThreadCompact(env, allocDescription, rebuildMarkBits || rebuildRememberedSet);
 		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
 	} else {
 		/* If a compaction was prevented, report the reason */
@@ -301,6 +322,14 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	}
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */	
 
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE)
+	if (rebuildRememberedSet) {
+		/* Remembered objects may have died or moved, so rebuild the cards from the live objects in parallel */
+		MM_ParallelRememberedSetRebuildTask rememberedSetRebuildTask(env, _dispatcher, _extensions->scavenger, _markingScheme->getMarkMap());
+		_dispatcher->run(env, &rememberedSetRebuildTask);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE) */
+
 	bool didCompact = false;
 #if defined(OMR_GC_MODRON_COMPACTION)
 	didCompact = _compactThisCycle;
@@ -642,6 +671,7 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	sweepStats->_endTime = omrtime_hires_clock();
+	_extensions->latencyStats.record(GC_LATENCY_SWEEP, omrtime_hires_delta(sweepStats->_startTime, sweepStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 	reportSweepEnd(env);
 }
 
@@ -689,7 +719,16 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	if (initMarkMap) {
+		/* a full mark traces every live object, so its work is estimated from the heap occupancy */
+		MM_Heap *heap = _extensions->heap;
+		uint64_t heapOccupancy = heap->getActiveMemorySize() - heap->getApproximateActiveFreeMemorySize();
+		_extensions->threadUseStats.runTask(env, _dispatcher, &markTask, GC_THREADS_MARK, heapOccupancy);
+	} else {
+		/* completing a concurrent mark only scans what is left in the work packets */
+		uint64_t slotsToScan = (_markingScheme->getWorkPackets()->getNonEmptyPacketCount() + 1) * MM_WorkPackets::getSlotsInPacket();
+		_extensions->threadUseStats.runTask(env, _dispatcher, &markTask, GC_THREADS_FINAL_MARK, slotsToScan);
+	}
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -697,6 +736,7 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 	postMark(env);
 	_markingScheme->masterCleanupAfterGC(env);
 	markStats->_endTime = omrtime_hires_clock();
+	_extensions->latencyStats.record(GC_LATENCY_MARK, omrtime_hires_delta(markStats->_startTime, markStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 	reportMarkEnd(env);
 }
 
@@ -735,6 +775,7 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+	_extensions->latencyStats.record(GC_LATENCY_COMPACT, omrtime_hires_delta(compactStats->_startTime, compactStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 	reportCompactEnd(env);
 	
 	/* Remember the gc count of the last compaction */ 
@@ -787,6 +828,8 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 
 	GC_OMRVMInterface::flushCachesForGC(env);
 	
+	/* keep what was cleared in the background, the mark only clears the rest */
+	stopBackgroundMarkMapClear(env, true);
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 	
 	if (_extensions->processLargeAllocateStats) {
@@ -844,6 +887,22 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	_extensions->lastGCFreeBytes = _extensions->heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
 #endif
+
+	/* Sweep no longer needs the mark map, so clear it in the background ready for the next mark */
+	if ((NULL != _markMapClearer) && _sweepScheme->isSweepCompleted(env)) {
+		_markMapClearer->startClear(env, _markingScheme->getMarkMap());
+	}
+}
+
+void
+MM_ParallelGlobalGC::stopBackgroundMarkMapClear(MM_EnvironmentBase *env, bool retainProgress)
+{
+	if (NULL != _markMapClearer) {
+		_markMapClearer->stopClear(env, retainProgress);
+		if (!retainProgress) {
+			_markingScheme->getMarkMap()->setCleanHeapTop(NULL);
+		}
+	}
 }
 
 void
@@ -951,6 +1010,8 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 {
 	GC_OMRVMInterface::flushCachesForGC(env);
 
+	stopBackgroundMarkMapClear(env, true);
+
 	_markingScheme->masterSetupForWalk(env);
 	
 	/* Run a parallel mark */
@@ -967,6 +1028,9 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 bool
 MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
+	/* the committed ranges being cleared in the background are about to change */
+	stopBackgroundMarkMapClear(env, false);
+
 	bool result = _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto markingScheme_failed_heapAddRange;
@@ -984,6 +1048,16 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* Only the global collector sees old space ranges, so it maintains the scavenger card table remembered set */
+	if (NULL != _extensions->scavenger) {
+		result = _extensions->scavenger->rememberedSetHeapAddRange(env, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto scavenger_failed_heapAddRange;
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	result = _cli->parallelGlobalGC_heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto parallelGlobalGC_failed_heapAddRange;
@@ -994,6 +1068,12 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 
 parallelGlobalGC_failed_heapAddRange:
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->scavenger) {
+		_extensions->scavenger->rememberedSetHeapRemoveRange(env, size, lowAddress, highAddress, NULL, NULL);
+	}
+scavenger_failed_heapAddRange:
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
@@ -1013,8 +1093,16 @@ end:
 bool
 MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
+	/* the committed ranges being cleared in the background are about to change */
+	stopBackgroundMarkMapClear(env, false);
+
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->scavenger) {
+		result = result && _extensions->scavenger->rememberedSetHeapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	result = result && _cli->parallelGlobalGC_heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1031,6 +1119,16 @@ MM_ParallelGlobalGC::heapReconfigured(MM_EnvironmentBase *env)
 	
 }
 
+/**
+ * Stop the background mark map clear before the mark map is taken over by another collector.
+ * @see MM_GlobalCollector::abortCollection()
+ */
+void
+MM_ParallelGlobalGC::abortCollection(MM_EnvironmentBase *env, CollectionAbortReason reason)
+{
+	stopBackgroundMarkMapClear(env, false);
+}
+
 bool
 MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
@@ -1039,12 +1137,19 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
-	return true;
+	bool result = true;
+	if (NULL != _markMapClearer) {
+		result = _markMapClearer->startup();
+	}
+	return result;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _markMapClearer) {
+		_markMapClearer->shutdown();
+	}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
@@ -1327,6 +1432,9 @@ MM_ParallelGlobalGC::reportGCIncrementEnd(MM_EnvironmentBase *env)
 	}
 
 	stats->_endTime = omrtime_hires_clock();
+	uint64_t pauseMicros = omrtime_hires_delta(stats->_startTime, stats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_extensions->latencyStats.record(GC_LATENCY_PAUSE, pauseMicros);
+	_extensions->heap->getResizeStats()->updateGlobalPauseHistory(pauseMicros);
 
 	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_END(
 		_extensions->privateHookInterface,
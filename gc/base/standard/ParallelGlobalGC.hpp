@@ -35,6 +35,7 @@
 #include "ParallelSweepScheme.hpp"
 
 
+class MM_BackgroundMarkMapClearer;
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
 class MM_Dispatcher;
@@ -63,6 +64,7 @@ private:
 protected:
 	MM_MarkingScheme *_markingScheme;
 	MM_ParallelSweepScheme *_sweepScheme;
+	MM_BackgroundMarkMapClearer *_markMapClearer; /**< Clears the mark map between collections, if -Xgc:backgroundMarkMapClear is set (NULL otherwise) */
 	MM_Dispatcher *_dispatcher;
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
@@ -182,6 +184,12 @@ private:
 	 * redistribute free memory in tenure after global collection (move free memory from LOA to SOA)
 	 */
 	void tenureMemoryPoolPostCollect(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the background mark map clear, if one is in progress, before the mark map or the committed heap is changed.
+	 * @param retainProgress if true, the range cleared so far is skipped by the next mark map initialization
+	 */
+	void stopBackgroundMarkMapClear(MM_EnvironmentBase *env, bool retainProgress);
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -265,6 +273,8 @@ public:
 
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
+	virtual void abortCollection(MM_EnvironmentBase *env, CollectionAbortReason reason);
+
 	void workThreadGarbageCollect(MM_EnvironmentBase *env);
 
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
@@ -315,6 +325,7 @@ public:
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
+		, _markMapClearer(NULL)
 		, _dispatcher(_extensions->dispatcher)
 		, _cycleState()
 		, _collectionStatistics()
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "ParallelHeapWalkTask.hpp"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+
+void
+MM_ParallelHeapWalkTask::run(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	void *threadData = (NULL == _threadData) ? NULL : (void *)(_threadData + (env->getSlaveID() * _threadDataSize));
+
+	for (uintptr_t index = 0; index < _sectionCount; index++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_ParallelHeapWalkSection *section = &_sections[index];
+			if (NULL != section->base) {
+				omrobjectptr_t object = NULL;
+				GC_ObjectHeapIteratorAddressOrderedList liveObjectIterator(extensions, (omrobjectptr_t)section->base, (omrobjectptr_t)section->top, false);
+				while (NULL != (object = liveObjectIterator.nextObject())) {
+					_function(omrVMThread, section->region, object, _userData, threadData);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(PARALLELHEAPWALKTASK_HPP_)
+#define PARALLELHEAPWALKTASK_HPP_
+
+#include "omrmodroncore.h"
+
+#include "HeapWalker.hpp"
+#include "ParallelTask.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
+
+/**
+ * A range of a heap region that is walked as one work unit.
+ * Every section starts on an object or hole, so it can be walked without walking the sections before it.
+ * @ingroup GC_Modron_Standard
+ */
+struct MM_ParallelHeapWalkSection {
+	MM_HeapRegionDescriptor *region; /**< region the section belongs to */
+	void *low; /**< lowest address the section covers */
+	void *base; /**< first object or hole in the section, or NULL if it is walked as part of an earlier section */
+	void *top; /**< address at which the walk of this section stops */
+};
+
+/**
+ * Task that walks the sections of the heap prepared by MM_HeapWalker::parallelObjectsDo(), calling the user
+ * function for each object with the data of the thread that found it.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelHeapWalkTask : public MM_ParallelTask
+{
+private:
+	MM_ParallelHeapWalkSection *_sections; /**< sections to walk, in address order */
+	uintptr_t _sectionCount; /**< number of entries in _sections */
+	MM_HeapWalkerParallelObjectFunc _function; /**< function called for each object */
+	void *_userData; /**< data shared by all of the threads */
+	uint8_t *_threadData; /**< per-thread data, indexed by slave ID */
+	uintptr_t _threadDataSize; /**< size of the data of each thread */
+
+public:
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_PARALLEL_HEAP_WALK; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelHeapWalkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_ParallelHeapWalkSection *sections, uintptr_t sectionCount,
+			MM_HeapWalkerParallelObjectFunc function, void *userData, uint8_t *threadData, uintptr_t threadDataSize, uintptr_t walkThreadCount) :
+		MM_ParallelTask(env, dispatcher),
+		_sections(sections),
+		_sectionCount(sectionCount),
+		_function(function),
+		_userData(userData),
+		_threadData(threadData),
+		_threadDataSize(threadDataSize)
+	{
+		_typeId = __FUNCTION__;
+		setRecommendedThreadCount(walkThreadCount);
+	}
+};
+
+#endif /* PARALLELHEAPWALKTASK_HPP_ */
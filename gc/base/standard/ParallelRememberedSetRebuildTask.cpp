@@ -0,0 +1,36 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "ParallelRememberedSetRebuildTask.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+#include "Scavenger.hpp"
+
+void
+MM_ParallelRememberedSetRebuildTask::run(MM_EnvironmentBase *env)
+{
+	_scavenger->rebuildRememberedSetCards(env, _markMap);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE) */
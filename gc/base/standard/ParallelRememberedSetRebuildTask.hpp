@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(PARALLELREMEMBEREDSETREBUILDTASK_HPP_)
+#define PARALLELREMEMBEREDSETREBUILDTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+class MM_EnvironmentBase;
+class MM_MarkMap;
+class MM_Scavenger;
+
+/**
+ * Task run at the end of a global collection to rebuild the scavenger's card table remembered set
+ * (-Xgc:scavengerCardMarking) from the live objects in the collection's mark map.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelRememberedSetRebuildTask : public MM_ParallelTask
+{
+private:
+	MM_Scavenger *_scavenger;
+	MM_MarkMap *_markMap;
+
+public:
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_REMEMBERED_SET_REBUILD; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelRememberedSetRebuildTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_Scavenger *scavenger, MM_MarkMap *markMap) :
+		MM_ParallelTask(env, dispatcher),
+		_scavenger(scavenger),
+		_markMap(markMap)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE) */
+
+#endif /* PARALLELREMEMBEREDSETREBUILDTASK_HPP_ */
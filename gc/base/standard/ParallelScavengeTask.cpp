@@ -25,6 +25,8 @@ MM_ParallelScavengeTask::run(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	_collector->workThreadGarbageCollect(env);
+	/* thread stats are cleared when the thread starts the scavenge, so they hold this task's stalls */
+	addIdleTicks(env->_scavengerStats.getStallTime());
 }
 
 void
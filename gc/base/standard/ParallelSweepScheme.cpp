@@ -44,6 +44,7 @@
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
 #include "HeapMapWordIterator.hpp"
+#include "HeapMapWordScanner.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
 
@@ -337,14 +338,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapWordScanner::findNonEmptyWord(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -514,11 +508,18 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		/* Check if the map slot is part of a candidate free list entry */
 		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
 		if (0 == heapSlotFreeCount) {
-			darkMatterCandidates += 1;
-			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
-				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
+			/* Skip the whole run of map slots with objects in them, sampling every darkMatterSampleRate'th slot for dark matter */
+			uintptr_t *markMapRunTop = MM_HeapMapWordScanner::findEmptyWord(markMapCurrent + 1, markMapChunkTop);
+			uintptr_t runLength = markMapRunTop - markMapCurrent;
+			uintptr_t sampleIndex = darkMatterSampleRate - 1 - (darkMatterCandidates % darkMatterSampleRate);
+			while (sampleIndex < runLength) {
+				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent + sampleIndex, heapSlotFreeCurrent + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sampleIndex));
 				darkMatterSamples += 1;
+				sampleIndex += darkMatterSampleRate;
 			}
+			darkMatterCandidates += runLength;
+			heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * runLength;
+			markMapCurrent = markMapRunTop;
 		} else {
 			/* There is at least a single free slot in the mark map - check the head and tail */
 			sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
@@ -531,11 +532,11 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 			/* Reset the free entries for the next body */
 			heapSlotFreeHead = NULL;
 			heapSlotFreeCount = 0;
-		}
 
-		/* Proceed to the next map slot */
-		heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT;
-		markMapCurrent += 1;
+			/* Proceed to the next map slot */
+			heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT;
+			markMapCurrent += 1;
+		}
 	}
 
 	/* Process the trailing free entry - The body processing will handle trailing entries that cover a map slot or more */
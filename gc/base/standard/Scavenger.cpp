@@ -54,6 +54,7 @@
 #include "ForwardedHeader.hpp"
 #include "IndexableObjectScanner.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
@@ -75,7 +76,9 @@
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
+#include "ScavengerCardTable.hpp"
 #include "ScavengerRootScanner.hpp"
+#include "ScavengerSlotPrefetchQueue.hpp"
 #include "ScavengerStats.hpp"
 #include "SlotObject.hpp"
 #include "SublistFragment.hpp"
@@ -94,6 +97,9 @@
 #define INITIAL_FREE_HISTORY_WEIGHT ((float)0.8)
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.8)
 
+/* Bytes of old space under each work unit of the card table remembered set scan */
+#define SCAVENGER_CARD_SCAN_UNIT_SIZE ((uintptr_t)2 * 1024 * 1024)
+
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
@@ -268,6 +274,26 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
+	if (_extensions->scavengerCardMarking) {
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+		/* Concurrent collectors rely on the remembered set list, so they keep using it */
+		bool concurrentCollection = IS_CONCURRENT_ENABLED;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		concurrentCollection = concurrentCollection || _extensions->concurrentMark;
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+		if (concurrentCollection) {
+			_extensions->scavengerCardMarking = false;
+		} else {
+			_rememberedSetCardTable = MM_ScavengerCardTable::newInstance(env, _extensions->heap);
+			if (NULL == _rememberedSetCardTable) {
+				return false;
+			}
+		}
+#else /* OMR_GC_HEAP_CARD_TABLE */
+		_extensions->scavengerCardMarking = false;
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+	}
+
 	return true;
 }
 
@@ -277,6 +303,13 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		_rememberedSetCardTable->kill(env);
+		_rememberedSetCardTable = NULL;
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -392,6 +425,9 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 
 	/* Record the tenure mask */
 	_tenureMask = calculateTenureMask();
+
+	/* Snapshot the nursery occupancy before the flip, as the estimate of the scavenge's work */
+	_evacuateOccupancy = _evacuateMemorySubSpace->getActiveMemorySize() - _evacuateMemorySubSpace->getApproximateActiveFreeMemorySize();
 	
 	_activeSubSpace->masterSetupForGC(env);
 
@@ -401,6 +437,12 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
+
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	/* Old space is contiguous; snapshot it before tenure can expand during the scavenge */
+	_rememberedSetScanBase = _extensions->heapBaseForBarrierRange0;
+	_rememberedSetScanTop = (void *)((uintptr_t)_extensions->heapBaseForBarrierRange0 + _extensions->heapSizeForBarrierRange0);
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 }
 
 void
@@ -446,7 +488,7 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
-	_dispatcher->run(env, &scavengeTask);
+	_extensions->threadUseStats.runTask(env, _dispatcher, &scavengeTask, GC_THREADS_SCAVENGE, _evacuateOccupancy);
 
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
@@ -674,6 +716,10 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 	finalGCStats->_scanCacheAllocationDurationDuringSavenger = OMR_MAX(finalGCStats->_scanCacheAllocationDurationDuringSavenger, scavStats->_scanCacheAllocationDurationDuringSavenger);
 
 	finalGCStats->_backout |= scavStats->_backout;
+	finalGCStats->_rememberedSetScanTime = OMR_MAX(finalGCStats->_rememberedSetScanTime, scavStats->_rememberedSetScanTime);
+	finalGCStats->_rememberedSetPruneTime = OMR_MAX(finalGCStats->_rememberedSetPruneTime, scavStats->_rememberedSetPruneTime);
+	finalGCStats->_rememberedObjectsScanned += scavStats->_rememberedObjectsScanned;
+	finalGCStats->_rememberedCardsScanned += scavStats->_rememberedCardsScanned;
 	finalGCStats->_tenureAggregateCount += scavStats->_tenureAggregateCount;
 	finalGCStats->_tenureAggregateBytes += scavStats->_tenureAggregateBytes;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -746,6 +792,7 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_hotFieldChainCopyCount += scavStats->_hotFieldChainCopyCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -1427,6 +1474,67 @@ MM_Scavenger::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr_t objec
 	return _cli->scavenger_getObjectScanner(env, objectptr, (void*) objectScannerState, flags);
 }
 
+/**
+ * Follow the first non-null hot field of a newly copied object and copy its referent immediately behind
+ * it in the same copy cache, repeating down the chain up to scavengerHotFieldCopyDepth objects. Objects
+ * that are dereferenced together then share cache lines in survivor or tenure space instead of being
+ * scattered breadth first. Only the objects are copied here; the slots are updated when the copies are scanned.
+ * Objects without a hot fields descriptor are presumed to have all fields hot, so the first reference is followed.
+ *
+ * On return env->_effectiveCopyScanCache is the cache that received the last object of the chain, or NULL if a copy
+ * failed (the failed attempt may have flushed the cache that received the previous object).
+ */
+MMINLINE void
+MM_Scavenger::copyHotFieldChain(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	for (uintptr_t depth = 0; depth < _extensions->scavengerHotFieldCopyDepth; depth++) {
+		GC_ObjectScannerState objectScannerState;
+		GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+		if ((NULL == objectScanner) || objectScanner->isLeafObject() || objectScanner->isIndexableObject()) {
+			break;
+		}
+
+		uintptr_t hotFieldsDescriptor = objectScanner->getHotFieldsDescriptor();
+		fomrobject_t *startOfObjectAfterHeader = (fomrobject_t *)(objectPtr + 1);
+		GC_SlotObject *slotObject = NULL;
+		omrobjectptr_t hotObjectPtr = NULL;
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			uintptr_t slotIndex = (uintptr_t)(slotObject->readAddressFromSlot() - startOfObjectAfterHeader);
+			if ((0 == hotFieldsDescriptor) || ((slotIndex < (sizeof(hotFieldsDescriptor) * 8)) && (0 != ((hotFieldsDescriptor >> slotIndex) & 1)))) {
+				hotObjectPtr = slotObject->readReferenceFromSlot();
+				if (NULL != hotObjectPtr) {
+					break;
+				}
+			}
+		}
+		if ((NULL == hotObjectPtr) || !isObjectInEvacuateMemory(hotObjectPtr)) {
+			break;
+		}
+
+		MM_ForwardedHeader forwardedHeader(hotObjectPtr);
+		if (NULL != forwardedHeader.getForwardedObject()) {
+			/* already copied, possibly by another thread (a cheap filter, the race is settled by copy() below) */
+			break;
+		}
+		/* copy() only sets the effective copy cache if this thread wins the race to forward the object */
+		MM_CopyScanCacheStandard *previousCopyCache = env->_effectiveCopyScanCache;
+		env->_effectiveCopyScanCache = NULL;
+		omrobjectptr_t copiedObjectPtr = copy(env, &forwardedHeader);
+		if (NULL == copiedObjectPtr) {
+			/* leave the failure to be handled when the slot is scanned */
+			break;
+		}
+		if (NULL == env->_effectiveCopyScanCache) {
+			/* another thread forwarded the object first and may still be copying it, so it cannot be followed */
+			env->_effectiveCopyScanCache = previousCopyCache;
+			break;
+		}
+		env->_scavengerStats._hotFieldChainCopyCount += 1;
+		env->_scavengerStats.countCopyDistance((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)copiedObjectPtr);
+		objectPtr = copiedObjectPtr;
+	}
+}
+
 uintptr_t
 MM_Scavenger::getArraySplitAmount(MM_EnvironmentStandard *env, uintptr_t sizeInElements)
 {
@@ -1552,8 +1660,10 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	bool shouldRemember = false;
 	GC_SlotObject *slotObject = NULL;
 	bool isParentInNewSpace = isObjectInNewSpace(objectPtr);
+	bool copyHotFields = _extensions->scavengerHotFieldCopyOrder && !IS_CONCURRENT_ENABLED;
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+	MM_ScavengerSlotPrefetchQueue prefetchQueue(env->getOmrVM(), _extensions->scavengerPrefetchDistance);
+	while (NULL != (slotObject = prefetchQueue.nextSlot(objectScanner))) {
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
@@ -1561,6 +1671,9 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 				hotFieldStats->setHotnessOfField(slotObject->readAddressFromSlot(), objectScanner->getHotFieldsDescriptor());
 				hotFieldStats->updateStats(isParentInNewSpace, isSlotObjectInNewSpace, slotObject->readReferenceFromSlot());
 			}
+			if (copyHotFields) {
+				copyHotFieldChain(env, slotObject->readReferenceFromSlot());
+			}
 			slotsCopied += 1;
 		}
 		slotsScanned += 1;
@@ -1656,8 +1769,10 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
 	bool isParentInNewSpace = isObjectInNewSpace(objectPtr);
+	bool copyHotFields = _extensions->scavengerHotFieldCopyOrder && !IS_CONCURRENT_ENABLED;
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+	MM_ScavengerSlotPrefetchQueue prefetchQueue(env->getOmrVM(), _extensions->scavengerPrefetchDistance);
+	while (NULL != (slotObject = prefetchQueue.nextSlot(objectScanner))) {
 		/* If the object should be remembered and it is in old space, remember it */
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
@@ -1669,7 +1784,30 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 				hotFieldStats->setHotnessOfField(slotObject->readAddressFromSlot(), objectScanner->getHotFieldsDescriptor());
 				hotFieldStats->updateStats(isParentInNewSpace, isSlotObjectInNewSpace, slotObject->readReferenceFromSlot());
 			}
-			*nextScanCache = aliasToCopyCache(env, slotObject, scanCache, *copyCache);
+			if (copyHotFields) {
+				copyHotFieldChain(env, slotObject->readReferenceFromSlot());
+			}
+			if (NULL != *copyCache) {
+				*nextScanCache = aliasToCopyCache(env, slotObject, scanCache, *copyCache);
+			}
+			if (NULL != *nextScanCache) {
+				/* the suspended scanner has already read past any queued slots so they must be copied now; if that
+				 * copied anything the selected cache may have been flushed, so the alias choice must be made again */
+				MM_CopyScanCacheStandard *queuedCopyCache = NULL;
+				GC_SlotObject *queuedSlotObject = NULL;
+				while (NULL != (queuedSlotObject = prefetchQueue.nextQueuedSlot())) {
+					scanCache->_shouldBeRemembered |= copyAndForward(env, queuedSlotObject);
+					slotsScanned += 1;
+					if (NULL != *copyCache) {
+						slotsCopied += 1;
+						queuedCopyCache = *copyCache;
+						slotObject = queuedSlotObject;
+					}
+				}
+				if (NULL != queuedCopyCache) {
+					*nextScanCache = aliasToCopyCache(env, slotObject, scanCache, queuedCopyCache);
+				}
+			}
 			/* alias and switch to nextScanCache if it was selected */
 			if (NULL != *nextScanCache) {
 				updateCopyScanCounts(env, slotsScanned, slotsCopied);
@@ -2017,7 +2155,10 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 
 	rootScanner.scavengeRememberedSet(env);
 
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t rootsStartTime = omrtime_hires_clock();
 	rootScanner.scanRoots(env);
+	_extensions->latencyStats.record(GC_LATENCY_ROOTS, omrtime_hires_delta(rootsStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 
 	if(completeScan(env)) {
 		if (_rescanThreadsForRememberedObjects) {
@@ -2048,6 +2189,15 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 		}
 	}
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		/* Cards are cleaned and objects forgotten without atomics, so every thread must be done copying
+		 * and remembering objects (and agree on back out) before the card table is pruned
+		 */
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 	if(isBackOutFlagRaised()) {
 		env->_scavengerStats._backout = 1;
 		completeBackOut(env);
@@ -2095,6 +2245,14 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	Assert_MM_true(!isObjectInNewSpace(objectPtr));
 	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		/* The card table never overflows */
+		_rememberedSetCardTable->rememberObject(env, objectPtr);
+		return;
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
 		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
@@ -2283,6 +2441,7 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 		 */
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = rememberedSetOverflow.nextObject())) {
+			env->_scavengerStats._rememberedObjectsScanned += 1;
 			scavengeRememberedObject(env, objectPtr);
 		}
 
@@ -2301,11 +2460,21 @@ MM_Scavenger::flushRememberedSet(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		pruneRememberedSetCards(env);
+	} else
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 	if(isRememberedSetInOverflowState()) {
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
 	}
+
+	env->_scavengerStats._rememberedSetPruneTime += omrtime_hires_clock() - startTime;
 }
 
 void
@@ -2495,24 +2664,138 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 			}
 		}
 
+		env->_scavengerStats._rememberedObjectsScanned += numElements;
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
 	}
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+void
+MM_Scavenger::scavengeRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	MM_HeapMap *rememberedObjectMap = _rememberedSetCardTable->getRememberedObjectMap();
+	MM_HeapMapIterator objectIterator(_extensions);
+	uintptr_t cardsScanned = 0;
+	uintptr_t objectsScanned = 0;
+
+	/* Every thread walks the same old space snapshot, so the work units line up. Objects remembered
+	 * by other threads while the walk is in progress may be scanned as well, which is harmless.
+	 */
+	uint8_t *scanTop = (uint8_t *)_rememberedSetScanTop;
+	for (uint8_t *chunkBase = (uint8_t *)_rememberedSetScanBase; chunkBase < scanTop; chunkBase += SCAVENGER_CARD_SCAN_UNIT_SIZE) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uint8_t *chunkTop = OMR_MIN(chunkBase + SCAVENGER_CARD_SCAN_UNIT_SIZE, scanTop);
+			Card *card = _rememberedSetCardTable->heapAddrToCardAddr(env, chunkBase);
+			Card *topCard = _rememberedSetCardTable->heapAddrToCardAddr(env, chunkTop);
+			while (topCard > (card = _rememberedSetCardTable->nextDirtyCard(card, topCard))) {
+				uintptr_t *cardBase = (uintptr_t *)_rememberedSetCardTable->cardAddrToHeapAddr(env, card);
+				objectIterator.reset(rememberedObjectMap, cardBase, (uintptr_t *)((uintptr_t)cardBase + CARD_SIZE));
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+					objectsScanned += 1;
+					scavengeRememberedObject(env, objectPtr);
+				}
+				cardsScanned += 1;
+				card += 1;
+			}
+		}
+	}
+
+	env->_scavengerStats._rememberedCardsScanned += cardsScanned;
+	env->_scavengerStats._rememberedObjectsScanned += objectsScanned;
+}
+
+void
+MM_Scavenger::pruneRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	MM_HeapMap *rememberedObjectMap = _rememberedSetCardTable->getRememberedObjectMap();
+	MM_HeapMapIterator objectIterator(_extensions);
+
+	/* Old space may have expanded during the scavenge, so prune all of it */
+	uint8_t *pruneTop = (uint8_t *)_extensions->heapBaseForBarrierRange0 + _extensions->heapSizeForBarrierRange0;
+	for (uint8_t *chunkBase = (uint8_t *)_extensions->heapBaseForBarrierRange0; chunkBase < pruneTop; chunkBase += SCAVENGER_CARD_SCAN_UNIT_SIZE) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uint8_t *chunkTop = OMR_MIN(chunkBase + SCAVENGER_CARD_SCAN_UNIT_SIZE, pruneTop);
+			Card *card = _rememberedSetCardTable->heapAddrToCardAddr(env, chunkBase);
+			Card *topCard = _rememberedSetCardTable->heapAddrToCardAddr(env, chunkTop);
+			while (topCard > (card = _rememberedSetCardTable->nextDirtyCard(card, topCard))) {
+				uintptr_t *cardBase = (uintptr_t *)_rememberedSetCardTable->cardAddrToHeapAddr(env, card);
+				bool keepCard = false;
+				objectIterator.reset(rememberedObjectMap, cardBase, (uintptr_t *)((uintptr_t)cardBase + CARD_SIZE));
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					if (processRememberedThreadReference(env, objectPtr)) {
+						/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
+						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+						keepCard = true;
+					} else if (shouldRememberObject(env, objectPtr)) {
+						keepCard = true;
+					} else {
+						/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
+						_extensions->objectModel.clearRemembered(objectPtr);
+						_rememberedSetCardTable->forgetObject(env, objectPtr);
+						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set */
+						TRIGGER_J9HOOK_MM_PRIVATE_OLD_TO_OLD_REFERENCE_CREATED(_extensions->privateHookInterface, env->getOmrVMThread(), objectPtr);
+					}
+				}
+				*card = keepCard ? CARD_DIRTY : CARD_CLEAN;
+				card += 1;
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::rebuildRememberedSetCards(MM_EnvironmentBase *env, MM_MarkMap *markMap)
+{
+	MM_HeapMapIterator markedObjectIterator(_extensions);
+
+	/* Work units are aligned to cards and map words, so each thread owns every card and map bit it clears or sets */
+	uint8_t *rebuildTop = (uint8_t *)_extensions->heapBaseForBarrierRange0 + _extensions->heapSizeForBarrierRange0;
+	for (uint8_t *chunkBase = (uint8_t *)_extensions->heapBaseForBarrierRange0; chunkBase < rebuildTop; chunkBase += SCAVENGER_CARD_SCAN_UNIT_SIZE) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uint8_t *chunkTop = OMR_MIN(chunkBase + SCAVENGER_CARD_SCAN_UNIT_SIZE, rebuildTop);
+			_rememberedSetCardTable->clearRange(env, chunkBase, chunkTop);
+			/* dead objects are not marked, so only the live ones are remembered again */
+			markedObjectIterator.reset(markMap, (uintptr_t *)chunkBase, (uintptr_t *)chunkTop);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					_rememberedSetCardTable->rememberObject(env, objectPtr);
+				}
+			}
+		}
+	}
+}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
 void
 MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		scavengeRememberedSetCards(env);
+	} else
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 	if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
 		scavengeRememberedSetOverflow(env);
 	} else {
 		scavengeRememberedSetList(env);
 	}
+
+	env->_scavengerStats._rememberedSetScanTime += omrtime_hires_clock() - startTime;
 }
 
 void
@@ -3380,6 +3663,42 @@ MM_Scavenger::processRememberedSetInBackout(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::unrememberTenuredObjectsInBackout(MM_EnvironmentStandard *env)
+{
+	GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
+	MM_HeapRegionDescriptor* rootRegion;
+
+	while(NULL != (rootRegion = evacuateRegionIterator.nextRegion())) {
+		/* skip survivor regions */
+		if (isObjectInEvacuateMemory((omrobjectptr_t)rootRegion->getLowAddress())) {
+			/* tell the object iterator to work on the given region */
+			GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
+			omrobjectptr_t objectPtr = NULL;
+			omrobjectptr_t fwdObjectPtr = NULL;
+			while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
+				MM_ForwardedHeader header(objectPtr);
+				fwdObjectPtr = header.getForwardedObject();
+				if (NULL != fwdObjectPtr) {
+					if(_extensions->objectModel.isRemembered(fwdObjectPtr)) {
+						_extensions->objectModel.clearRemembered(fwdObjectPtr);
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+						if (NULL != _rememberedSetCardTable) {
+							_rememberedSetCardTable->forgetObject(env, fwdObjectPtr);
+						}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+					}
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+					evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeaderBeforeMove(fwdObjectPtr));
+#else
+					evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeader(fwdObjectPtr));
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+				}
+			}
+		}
+	}
+}
+
 void
 MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 {
@@ -3423,10 +3742,31 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		 */
 		_extensions->scavengerRsoScanUnsafe = true;
 
-		if(isRememberedSetInOverflowState()) {
-			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
-			MM_HeapRegionDescriptor* rootRegion;
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+		if (NULL != _rememberedSetCardTable) {
+			/* i) Unremember any objects that moved from new space to old */
+			unrememberTenuredObjectsInBackout(env);
+
+			/* 2.c) Walk the evacuate space, fixing up objects and installing reverse forward pointers in survivor space */
+			backoutFixupAndReverseForwardPointersInSurvivor(env);
 
+			/* 3) Walk the remembered object map, which unlike the heap is still walkable */
+#if defined(OMR_SCAVENGER_TRACE_BACKOUT)
+			omrtty_printf("{SCAV: Back out RS cards}\n");
+#endif /* OMR_SCAVENGER_TRACE_BACKOUT */
+			uintptr_t *tenureBase = (uintptr_t *)_extensions->heapBaseForBarrierRange0;
+			uintptr_t *tenureTop = (uintptr_t *)((uintptr_t)_extensions->heapBaseForBarrierRange0 + _extensions->heapSizeForBarrierRange0);
+			MM_HeapMapIterator rememberedObjectIterator(_extensions, _rememberedSetCardTable->getRememberedObjectMap(), tenureBase, tenureTop, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+				backOutObjectScan(env, objectPtr);
+			}
+
+			/* Walk all classes that are flagged as remembered */
+			_cli->scavenger_backOutIndirectObjects(env);
+		} else
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+		if(isRememberedSetInOverflowState()) {
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
 			omrtty_printf("{SCAV: Handle RS overflow}\n");
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
@@ -3439,29 +3779,7 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 #endif
 
 			/* i) Unremember any objects that moved from new space to old */
-			while(NULL != (rootRegion = evacuateRegionIterator.nextRegion())) {
-				/* skip survivor regions */
-				if (isObjectInEvacuateMemory((omrobjectptr_t)rootRegion->getLowAddress())) {
-					/* tell the object iterator to work on the given region */
-					GC_ObjectHeapIteratorAddressOrderedList evacuateHeapIterator(_extensions, rootRegion, false);
-					omrobjectptr_t objectPtr = NULL;
-					omrobjectptr_t fwdObjectPtr = NULL;
-					while((objectPtr = evacuateHeapIterator.nextObjectNoAdvance()) != NULL) {
-						MM_ForwardedHeader header(objectPtr);
-						fwdObjectPtr = header.getForwardedObject();
-						if (NULL != fwdObjectPtr) {
-							if(_extensions->objectModel.isRemembered(fwdObjectPtr)) {
-								_extensions->objectModel.clearRemembered(fwdObjectPtr);
-							}
-#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
-							evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeaderBeforeMove(fwdObjectPtr));
-#else
-							evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeader(fwdObjectPtr));
-#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
-						}
-					}
-				}
-			}
+			unrememberTenuredObjectsInBackout(env);
 
 			/* ii) Walk old space and build up the overflow list */
 			/* the list is built because after reverse fwd ptrs are installed, the heap becomes unwalkable */
@@ -3583,6 +3901,7 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 
 		/* Record the completion time of the scavenge */
 		_extensions->scavengerStats._endTime = omrtime_hires_clock();
+		_extensions->latencyStats.record(GC_LATENCY_SCAVENGE_COPY, omrtime_hires_delta(_extensions->scavengerStats._startTime, _extensions->scavengerStats._endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 
 		reportScavengeEnd(env);
 
@@ -3769,6 +4088,30 @@ MM_Scavenger::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,
 	return true;
 }
 
+bool
+MM_Scavenger::rememberedSetHeapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	bool result = true;
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		result = _rememberedSetCardTable->heapAddRange(env, size, lowAddress, highAddress);
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+	return result;
+}
+
+bool
+MM_Scavenger::rememberedSetHeapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	if (NULL != _rememberedSetCardTable) {
+		result = _rememberedSetCardTable->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+	return result;
+}
+
 /**
  * Re-size all structures which are dependent on the current size of the heap.
  *
@@ -4267,6 +4610,7 @@ MM_Scavenger::reportGCIncrementEnd(MM_EnvironmentStandard *env)
 	}
 
 	stats->_endTime = omrtime_hires_clock();
+	_extensions->latencyStats.record(GC_LATENCY_PAUSE, omrtime_hires_delta(stats->_startTime, stats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
 
 	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_END(
 		_extensions->privateHookInterface,
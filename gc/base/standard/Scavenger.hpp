@@ -43,11 +43,13 @@ class MM_CollectorLanguageInterface;
 class MM_Dispatcher;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_MarkMap;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
 class MM_PhysicalSubArena;
 class MM_RSOverflow;
+class MM_ScavengerCardTable;
 class MM_SublistPool;
 
 struct OMR_VM;
@@ -78,6 +80,7 @@ private:
 
 	void *_evacuateSpaceBase, *_evacuateSpaceTop;	/**< cached base and top heap pointers within evacuate subspace */
 	void *_survivorSpaceBase, *_survivorSpaceTop;	/**< cached base and top heap pointers within survivor subspace */
+	uintptr_t _evacuateOccupancy; /**< bytes in use in the evacuate subspace when the scavenge started, the work the scavenge is expected to do */
 
 	uintptr_t _tenureMask; /**< A bit mask indicating which generations should be tenured on scavenge. */
 	bool _expandFailed;
@@ -116,6 +119,12 @@ private:
 	void *_heapTop;  /**< Cached top pointer of heap */
 	MM_HeapRegionManager *_regionManager;
 
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	MM_ScavengerCardTable *_rememberedSetCardTable; /**< card table based remembered set, or NULL if the remembered set list is in use (-Xgc:scavengerCardMarking) */
+	void *_rememberedSetScanBase; /**< base of the old space covered by the card table scan, cached at the start of each scavenge */
+	void *_rememberedSetScanTop; /**< top of the old space covered by the card table scan, cached at the start of each scavenge */
+#endif /* OMR_GC_HEAP_CARD_TABLE */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	MM_MasterGCThread _masterGCThread; /**< An object which manages the state of the master GC thread */
 	
@@ -201,6 +210,13 @@ public:
 
 	MMINLINE omrobjectptr_t copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
+	/**
+	 * Copy the chain of hot fields hanging off a newly copied object immediately behind it (-Xgc:scavengerHotFieldCopyOrder).
+	 * @param env current thread environment
+	 * @param objectPtr the new location of the object that was just copied
+	 */
+	MMINLINE void copyHotFieldChain(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -221,6 +237,22 @@ public:
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+	void scavengeRememberedSetCards(MM_EnvironmentStandard *env);
+	void pruneRememberedSetCards(MM_EnvironmentStandard *env);
+
+	/**
+	 * Rebuild the card table based remembered set from the remembered bits of the live objects in old space.
+	 * Run by every thread of a global collection task once the collection has freed and moved old objects.
+	 * @param markMap mark map of the global collection, holding the final address of every live object
+	 */
+	void rebuildRememberedSetCards(MM_EnvironmentBase *env, MM_MarkMap *markMap);
+
+	/**
+	 * @return true if the remembered set is a card table, which a global collection must rebuild with rebuildRememberedSetCards()
+	 */
+	MMINLINE bool isRememberedSetCardTable() { return NULL != _rememberedSetCardTable; }
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 
 	/**
 	 * Checks if the  Object should be remembered or not
@@ -238,6 +270,12 @@ public:
 
 	void backoutFixupAndReverseForwardPointersInSurvivor(MM_EnvironmentStandard *env);
 	void processRememberedSetInBackout(MM_EnvironmentStandard *env);
+
+	/**
+	 * Clear the remembered state of every object copied from evacuate space into old space, since
+	 * the copies are discarded by back out.
+	 */
+	void unrememberTenuredObjectsInBackout(MM_EnvironmentStandard *env);
 	void completeBackOut(MM_EnvironmentStandard *env);
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -680,6 +718,17 @@ public:
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
 
+	/**
+	 * Adjust the card table based remembered set, if in use, for a range added to the heap.
+	 * Called by the global collector for every range, since old space ranges are not reported to the scavenger.
+	 */
+	bool rememberedSetHeapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress);
+
+	/**
+	 * Adjust the card table based remembered set, if in use, for a range removed from the heap.
+	 */
+	bool rememberedSetHeapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
 	virtual void collectorExpanded(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, uintptr_t expandSize);
 	virtual bool canCollectorExpand(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, uintptr_t expandSize);
 	virtual uintptr_t getCollectorExpandSize(MM_EnvironmentBase *env);
@@ -701,6 +750,7 @@ public:
 		, _evacuateSpaceTop(NULL)
 		, _survivorSpaceBase(NULL)
 		, _survivorSpaceTop(NULL)
+		, _evacuateOccupancy(0)
 		, _tenureMask(0)
 		, _expandFailed(false)
 		, _failedTenureThresholdReached(false)
@@ -724,6 +774,11 @@ public:
 		, _heapBase(NULL)
 		, _heapTop(NULL)
 		, _regionManager(regionManager)
+#if defined(OMR_GC_HEAP_CARD_TABLE)
+		, _rememberedSetCardTable(NULL)
+		, _rememberedSetScanBase(NULL)
+		, _rememberedSetScanTop(NULL)
+#endif /* OMR_GC_HEAP_CARD_TABLE */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _masterGCThread(env)
 		, _concurrentState(concurrent_state_idle)
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapWordScanner.hpp"
+#include "Math.hpp"
+#include "ScavengerCardTable.hpp"
+
+#include "ModronAssertions.h"
+
+MM_ScavengerCardTable *
+MM_ScavengerCardTable::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	MM_ScavengerCardTable *cardTable = (MM_ScavengerCardTable *)env->getForge()->allocate(sizeof(MM_ScavengerCardTable), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cardTable) {
+		new(cardTable) MM_ScavengerCardTable();
+		if (!cardTable->initialize(env, heap)) {
+			cardTable->kill(env);
+			return NULL;
+		}
+	}
+	return cardTable;
+}
+
+bool
+MM_ScavengerCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	bool initialized = MM_CardTable::initialize(env, heap);
+	if (initialized) {
+		_rememberedObjectMap = MM_MarkMap::newInstance(env, heap->getMaximumPhysicalRange());
+		initialized = (NULL != _rememberedObjectMap);
+	}
+	return initialized;
+}
+
+void
+MM_ScavengerCardTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _rememberedObjectMap) {
+		_rememberedObjectMap->kill(env);
+		_rememberedObjectMap = NULL;
+	}
+	MM_CardTable::tearDown(env);
+}
+
+bool
+MM_ScavengerCardTable::heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	/* Determine the current top of heap */
+	_heapAlloc = env->getExtensions()->heap->getHeapTop();
+
+	bool result = commitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress));
+	if (result) {
+		clearCardsInRange(env, lowAddress, highAddress);
+		result = _rememberedObjectMap->heapAddRange(env, size, lowAddress, highAddress);
+		if (result) {
+			_rememberedObjectMap->setBitsInRange(env, lowAddress, highAddress, true);
+		}
+	}
+	return result;
+}
+
+bool
+MM_ScavengerCardTable::heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+	/* Nothing has been committed if the heap failed to expand before it was ever added to */
+	if (NULL != _heapAlloc) {
+		Card *lowValidCard = NULL;
+		if (NULL != lowValidAddress) {
+			lowValidCard = heapAddrToCardAddr(env, lowValidAddress);
+		}
+		Card *highValidCard = NULL;
+		if (NULL != highValidAddress) {
+			highValidCard = heapAddrToCardAddr(env, highValidAddress);
+		}
+
+		result = decommitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress), lowValidCard, highValidCard);
+		if (result) {
+			result = _rememberedObjectMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+		}
+		_heapAlloc = env->getExtensions()->heap->getHeapTop();
+	}
+	return result;
+}
+
+void
+MM_ScavengerCardTable::clearRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	if (lowAddress < highAddress) {
+		clearCardsInRange(env, lowAddress, highAddress);
+		_rememberedObjectMap->setBitsInRange(env, lowAddress, highAddress, true);
+	}
+}
+
+Card *
+MM_ScavengerCardTable::nextDirtyCard(Card *card, Card *topCard)
+{
+	/* Step a card at a time up to a slot boundary */
+	while ((card < topCard) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+		if (CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+
+#if (0 == CARD_CLEAN)
+	/* The table is expected to be mostly clean, and a slot of clean cards is an empty word, so skip
+	 * whole slots with the vectorized mark map scanner
+	 */
+	uintptr_t *slot = (uintptr_t *)card;
+	uintptr_t *topSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+	if (slot < topSlot) {
+		card = (Card *)MM_HeapMapWordScanner::findNonEmptyWord(slot, topSlot);
+	}
+#endif /* 0 == CARD_CLEAN */
+
+	while ((card < topCard) && (CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	return card;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE) */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(SCAVENGERCARDTABLE_HPP_)
+#define SCAVENGERCARDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE)
+
+#include "CardTable.hpp"
+#include "MarkMap.hpp"
+
+class MM_EnvironmentBase;
+class MM_Heap;
+
+/**
+ * Card table based remembered set for the scavenger (-Xgc:scavengerCardMarking).
+ * A remembered old object has its bit set in the remembered object map and the card holding its
+ * header dirtied. The card table summarizes the map, so a scavenge only walks the map under dirty
+ * cards to find the remembered objects. The remembered bit in the object header stays authoritative;
+ * the map and cards are kept in step with it by the scavenger.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerCardTable : public MM_CardTable
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	MM_MarkMap *_rememberedObjectMap; /**< one bit per remembered old object */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_ScavengerCardTable *newInstance(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Commit and clear the cards and map bits for a range added to the heap.
+	 * @return true if the memory backing the range was committed
+	 */
+	bool heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress);
+
+	/**
+	 * Decommit the cards and map bits for a range removed from the heap.
+	 * @return true if the memory backing the range was decommitted
+	 */
+	bool heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Clean the cards and clear the map bits for a range of the heap.
+	 * @param lowAddress base of the range, aligned to a card
+	 * @param highAddress top of the range (non-inclusive), aligned to a card
+	 */
+	void clearRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Find the first dirty card at or after card.
+	 * @param card the first card to test
+	 * @param topCard the card after the last card to test
+	 * @return the first dirty card, or topCard if there is none
+	 */
+	Card *nextDirtyCard(Card *card, Card *topCard);
+
+	/**
+	 * Add an old object to the remembered set. May be called by several threads at once.
+	 * @param objectPtr old object whose remembered bit has just been set
+	 */
+	MMINLINE void
+	rememberObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		_rememberedObjectMap->atomicSetBit(objectPtr);
+		Card *card = (Card *)((uintptr_t)getCardTableVirtualStart() + ((uintptr_t)objectPtr >> CARD_SIZE_SHIFT));
+		if (CARD_DIRTY != *card) {
+			*card = CARD_DIRTY;
+		}
+	}
+
+	/**
+	 * Remove an old object from the remembered set. The caller must own the card holding the object,
+	 * since other objects on the same map word may be updated without atomics.
+	 * @param objectPtr old object whose remembered bit has just been cleared
+	 */
+	MMINLINE void
+	forgetObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		_rememberedObjectMap->clearBit(objectPtr);
+	}
+
+	MMINLINE MM_MarkMap *getRememberedObjectMap() { return _rememberedObjectMap; }
+
+	MM_ScavengerCardTable()
+		: MM_CardTable()
+		, _rememberedObjectMap(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_HEAP_CARD_TABLE) */
+
+#endif /* SCAVENGERCARDTABLE_HPP_ */
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERSLOTPREFETCHQUEUE_HPP_)
+#define SCAVENGERSLOTPREFETCHQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectScanner.hpp"
+#include "SlotObject.hpp"
+
+/**
+ * Reads the slots of an object a fixed distance ahead of the slot being copied, prefetching the
+ * header of each referent so that the forwarding check in copyAndForward() does not stall on a cache miss.
+ * With a distance of 0 slots are passed straight through from the object scanner.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerSlotPrefetchQueue
+{
+/* Data members */
+public:
+protected:
+private:
+	uintptr_t _distance; /**< number of slots read ahead of the slot being copied */
+	uintptr_t _head; /**< index of the oldest queued slot */
+	uintptr_t _count; /**< number of queued slots */
+	GC_SlotObject _slotObject; /**< slot object returned for queued slots */
+	fomrobject_t *_slots[MAXIMUM_SCAVENGER_PREFETCH_DISTANCE]; /**< ring of slot addresses read from the object scanner */
+
+/* Methods */
+public:
+	/**
+	 * Return the next slot of the object being scanned, reading ahead in the object scanner to keep the queue full.
+	 * @param objectScanner the scanner for the object being scanned
+	 * @return the next slot to copy, or NULL if all slots have been returned
+	 */
+	MMINLINE GC_SlotObject *
+	nextSlot(GC_ObjectScanner *objectScanner)
+	{
+		if (0 == _distance) {
+			return objectScanner->getNextSlot();
+		}
+
+		while (_count < _distance) {
+			GC_SlotObject *slotObject = objectScanner->getNextSlot();
+			if (NULL == slotObject) {
+				break;
+			}
+			MM_AtomicOperations::prefetch(slotObject->readReferenceFromSlot());
+			uintptr_t tail = _head + _count;
+			if (tail >= _distance) {
+				tail -= _distance;
+			}
+			_slots[tail] = slotObject->readAddressFromSlot();
+			_count += 1;
+		}
+
+		return nextQueuedSlot();
+	}
+
+	/**
+	 * Return the oldest slot already read from the object scanner without reading any further. Used to
+	 * drain the queue when scanning of an object is suspended, since the scanner has moved past these slots.
+	 * @return the oldest queued slot, or NULL if the queue is empty
+	 */
+	MMINLINE GC_SlotObject *
+	nextQueuedSlot()
+	{
+		if (0 == _count) {
+			return NULL;
+		}
+		_slotObject.writeAddressToSlot(_slots[_head]);
+		_head += 1;
+		if (_head == _distance) {
+			_head = 0;
+		}
+		_count -= 1;
+		return &_slotObject;
+	}
+
+	/**
+	 * Create a queue for scanning one object.
+	 * @param omrVM the VM
+	 * @param distance the number of slots to read ahead (at most MAXIMUM_SCAVENGER_PREFETCH_DISTANCE)
+	 */
+	MM_ScavengerSlotPrefetchQueue(OMR_VM *omrVM, uintptr_t distance)
+		: _distance(distance)
+		, _head(0)
+		, _count(0)
+		, _slotObject(omrVM, NULL)
+	{
+	}
+};
+
+#endif /* SCAVENGERSLOTPREFETCHQUEUE_HPP_ */
@@ -41,6 +41,11 @@ private:
 protected:
 	virtual MM_WorkPacketOverflow *createOverflowHandler(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 
+	/**
+	 * Packets are shared with mutator threads which do not own a work stealing deque.
+	 */
+	virtual bool supportsWorkStealing() { return false; }
+
 public:
 	static MM_WorkPacketsConcurrent  *newInstance(MM_EnvironmentBase *env);
 
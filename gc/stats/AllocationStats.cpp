@@ -29,7 +29,9 @@ MM_AllocationStats::clear()
 	_tlhAllocatedReused = 0;
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
+	_tlhWastedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhMaxRefreshSize = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -54,6 +56,7 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhAllocatedFresh, stats->_tlhAllocatedFresh);
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
+	MM_AtomicOperations::add(&_tlhWastedBytes, stats->_tlhWastedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
@@ -63,6 +66,14 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_tlhMaxAbandonedListSize, prevMax, stats->_tlhMaxAbandonedListSize);
 	}
+	/* looping to set a maximum value in _tlhMaxRefreshSize */
+	for (
+			uintptr_t prevMax = _tlhMaxRefreshSize;
+			prevMax < stats->_tlhMaxRefreshSize;
+			prevMax = _tlhMaxRefreshSize) {
+		MM_AtomicOperations::lockCompareExchange(
+			&_tlhMaxRefreshSize, prevMax, stats->_tlhMaxRefreshSize);
+	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
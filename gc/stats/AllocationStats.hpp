@@ -36,7 +36,9 @@ public:
 	uintptr_t _tlhAllocatedReused; /**< The amount of memory allocated form reused TLHs. */
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
+	uintptr_t _tlhWastedBytes; /**< The amount of memory from discarded TLHs that was too small to be cached for reuse. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhMaxRefreshSize; /**< The largest refresh size requested. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -83,7 +85,9 @@ public:
 		_tlhAllocatedReused(0),
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
+		_tlhWastedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhMaxRefreshSize(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
 		_arrayletLeafAllocationCount(0),
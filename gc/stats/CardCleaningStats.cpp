@@ -28,6 +28,10 @@ MM_CardCleaningStats::clear()
 {
 	_cardCleaningTime = 0;
 	_cardsCleaned = 0;
+	_cardRuns = 0;
+	for (uintptr_t bucket = 0; bucket < CARD_RUN_HISTOGRAM_BUCKETS; bucket++) {
+		_cardRunHistogram[bucket] = 0;
+	}
 }
 
 void
@@ -35,4 +39,8 @@ MM_CardCleaningStats::merge(MM_CardCleaningStats *statsToMerge)
 {
 	_cardCleaningTime += statsToMerge->_cardCleaningTime;
 	_cardsCleaned += statsToMerge->_cardsCleaned;
+	_cardRuns += statsToMerge->_cardRuns;
+	for (uintptr_t bucket = 0; bucket < CARD_RUN_HISTOGRAM_BUCKETS; bucket++) {
+		_cardRunHistogram[bucket] += statsToMerge->_cardRunHistogram[bucket];
+	}
 }
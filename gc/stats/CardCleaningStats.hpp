@@ -24,12 +24,16 @@
 
 #include "Base.hpp"
 
+#define CARD_RUN_HISTOGRAM_BUCKETS 16
+
 class MM_CardCleaningStats : public MM_Base
 {
 /* Data Members */
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardRuns; /**< The number of runs of adjacent dirty cards cleaned with a single heap scan */
+	uintptr_t _cardRunHistogram[CARD_RUN_HISTOGRAM_BUCKETS]; /**< Run count by length; bucket i counts runs of 2^i to 2^(i+1)-1 cards, the last bucket counts all longer runs */
 	
 /* Function Members */
 public:
@@ -46,6 +50,22 @@ public:
 	 */
 	MMINLINE void addToCardCleaningTime(uint64_t startTime, uint64_t endTime) { _cardCleaningTime += (endTime - startTime);	}
 	
+	/**
+	 * Record a run of adjacent dirty cards which was cleaned with a single scan of the heap.
+	 * @param runLength The number of cards in the run
+	 */
+	MMINLINE void
+	addCardRun(uintptr_t runLength)
+	{
+		uintptr_t bucket = 0;
+		while ((1 < runLength) && (bucket < (CARD_RUN_HISTOGRAM_BUCKETS - 1))) {
+			runLength >>= 1;
+			bucket += 1;
+		}
+		_cardRuns += 1;
+		_cardRunHistogram[bucket] += 1;
+	}
+
 	/**
 	 * Merges the results from the input MM_CardCleaningStats with the statistics contained within the receiver.
 	 * 
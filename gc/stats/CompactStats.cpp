@@ -38,6 +38,8 @@ MM_CompactStats::clear()
 	_fixupObjects = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
+	_planStartTime = 0;
+	_planEndTime = 0;
 	_moveStartTime = 0;
 	_moveEndTime = 0;
 	_fixupStartTime = 0;
@@ -55,6 +57,8 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
+	_planStartTime = (0 == _planStartTime) ? statsToMerge->_planStartTime : OMR_MIN(_planStartTime, statsToMerge->_planStartTime);
+	_planEndTime = OMR_MAX(_planEndTime, statsToMerge->_planEndTime);
 	_moveStartTime = (0 == _moveStartTime) ? statsToMerge->_moveStartTime : OMR_MIN(_moveStartTime, statsToMerge->_moveStartTime);
 	_moveEndTime = OMR_MAX(_moveEndTime, statsToMerge->_moveEndTime);
 	_fixupStartTime = (0 == _fixupStartTime) ? statsToMerge->_fixupStartTime : OMR_MIN(_fixupStartTime, statsToMerge->_fixupStartTime);
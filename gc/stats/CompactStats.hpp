@@ -48,6 +48,8 @@ public:
 	uintptr_t _fixupObjects;
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
+	uint64_t _planStartTime; /**< Start of the sliding compaction plan phase */
+	uint64_t _planEndTime; /**< End of the sliding compaction plan phase */
 	uint64_t _moveStartTime;
 	uint64_t _moveEndTime;
 	uint64_t _fixupStartTime;
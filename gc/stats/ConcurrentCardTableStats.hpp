@@ -24,6 +24,7 @@
 
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
+#include "CardCleaningStats.hpp"
 
 #define HIGH_VALUES (uintptr_t)(-1)
 /**
@@ -45,6 +46,8 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	MM_CardCleaningStats _finalCardCleaningStats; /**< Dirty card runs found by all threads during final card cleaning */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -71,6 +74,7 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+		_finalCardCleaningStats.clear();
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -115,6 +119,25 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
 	
+	MMINLINE MM_CardCleaningStats *getFinalCardCleaningStats() { return &_finalCardCleaningStats; };
+
+	/**
+	 * Merge one thread's final card cleaning statistics. Called by each thread of the final
+	 * clean cards task as it completes so the counters are updated atomically.
+	 * @param[in] statsToMerge The thread local card cleaning statistics
+	 */
+	MMINLINE void
+	mergeFinalCardCleaningStats(MM_CardCleaningStats *statsToMerge)
+	{
+		incrementCount(_finalCardCleaningStats._cardsCleaned, statsToMerge->_cardsCleaned);
+		incrementCount(_finalCardCleaningStats._cardRuns, statsToMerge->_cardRuns);
+		for (uintptr_t bucket = 0; bucket < CARD_RUN_HISTOGRAM_BUCKETS; bucket++) {
+			if (0 != statsToMerge->_cardRunHistogram[bucket]) {
+				incrementCount(_finalCardCleaningStats._cardRunHistogram[bucket], statsToMerge->_cardRunHistogram[bucket]);
+			}
+		}
+	}
+
 	/**
 	 * Create a CardTableStats object.
 	 */   
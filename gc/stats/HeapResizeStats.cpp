@@ -18,31 +18,49 @@
 
 #include "HeapResizeStats.hpp"
 
-uint32_t
-MM_HeapResizeStats::calculateGCPercentage() 
-{
-	uint32_t percentage = 0;
-	uint64_t totalGCTicks = 0;
-	uint64_t totalNonGCTicks = 0;
+#include "Math.hpp"
 
+/* weight of the existing average when a new sample is added to the goal-driven sizing history */
+#define HEAP_RESIZE_HISTORY_WEIGHT 0.7f
+
+bool
+MM_HeapResizeStats::sumRatioTicks(uint64_t *totalGCTicks, uint64_t *totalNonGCTicks)
+{
 	/* Make sure histories has not been cleared in last 3 cycles. This will
 	 * be the case if the first element in the array is zero
 	 */
 	if (_ticksOutsideGC[0] == 0 ) {
-		return 0; 
+		return false;
 	}
-	
+
+	*totalGCTicks = 0;
+	*totalNonGCTicks = 0;
+
 	/* Sum up all ticks */
 	for (int i = 0; i < RATIO_RESIZE_HISTORIES; i++) {
-		totalGCTicks += _ticksInGC[i];
-		totalNonGCTicks += _ticksOutsideGC[i];
+		*totalGCTicks += _ticksInGC[i];
+		*totalNonGCTicks += _ticksOutsideGC[i];
 	}
 
 	/* Ignore oldest history for time outside of gc */
-	totalNonGCTicks -= _ticksOutsideGC[0];
+	*totalNonGCTicks -= _ticksOutsideGC[0];
 
 	/* Add latest history for time outside of gc */
-	totalNonGCTicks += _lastTimeOutsideGC;
+	*totalNonGCTicks += _lastTimeOutsideGC;
+
+	return true;
+}
+
+uint32_t
+MM_HeapResizeStats::calculateGCPercentage() 
+{
+	uint32_t percentage = 0;
+	uint64_t totalGCTicks = 0;
+	uint64_t totalNonGCTicks = 0;
+
+	if (!sumRatioTicks(&totalGCTicks, &totalNonGCTicks)) {
+		return 0; 
+	}
 
 	/* ..and calculate percentage of time being spent in GC without using floats */
 	percentage = (uint32_t)((totalGCTicks * 100) / (totalGCTicks + totalNonGCTicks));
@@ -53,6 +71,19 @@ MM_HeapResizeStats::calculateGCPercentage()
 	return percentage;
 }
 
+float
+MM_HeapResizeStats::calculateExactGCPercentage()
+{
+	uint64_t totalGCTicks = 0;
+	uint64_t totalNonGCTicks = 0;
+
+	if (!sumRatioTicks(&totalGCTicks, &totalNonGCTicks)) {
+		return 0.0f;
+	}
+
+	return ((float)totalGCTicks * 100.0f) / (float)(totalGCTicks + totalNonGCTicks);
+}
+
 void
 MM_HeapResizeStats::updateHeapResizeStats()
 {
@@ -85,3 +116,42 @@ MM_HeapResizeStats::updateHeapResizeStats()
 		updateRatioTicks(timeInGC, timeOutsideGC);
 	}			
 }	
+
+void
+MM_HeapResizeStats::updateScavengeHistory(uintptr_t allocatedBytes, uintptr_t survivedBytes, uint64_t scavengeMillis, uint64_t intervalMillis)
+{
+	/* as with the ratio ticks, never use a 0 time delta */
+	intervalMillis = (0 == intervalMillis) ? 1 : intervalMillis;
+	float allocationRate = (float)allocatedBytes / (float)intervalMillis;
+	float copyRate = (float)survivedBytes / (float)((0 == scavengeMillis) ? 1 : scavengeMillis);
+	float survivalRate = (0 == allocatedBytes) ? 0.0f : ((float)survivedBytes / (float)allocatedBytes);
+	if (survivalRate > 1.0f) {
+		survivalRate = 1.0f;
+	}
+
+	if (_scavengeHistoryValid) {
+		_averageAllocationRate = MM_Math::weightedAverage(_averageAllocationRate, allocationRate, HEAP_RESIZE_HISTORY_WEIGHT);
+		_averageSurvivalRate = MM_Math::weightedAverage(_averageSurvivalRate, survivalRate, HEAP_RESIZE_HISTORY_WEIGHT);
+		_averageScavengeMillis = MM_Math::weightedAverage(_averageScavengeMillis, (float)scavengeMillis, HEAP_RESIZE_HISTORY_WEIGHT);
+		_averageCopyRate = MM_Math::weightedAverage(_averageCopyRate, copyRate, HEAP_RESIZE_HISTORY_WEIGHT);
+	} else {
+		_averageAllocationRate = allocationRate;
+		_averageSurvivalRate = survivalRate;
+		_averageScavengeMillis = (float)scavengeMillis;
+		_averageCopyRate = copyRate;
+		_scavengeHistoryValid = true;
+	}
+}
+
+void
+MM_HeapResizeStats::updateGlobalPauseHistory(uint64_t pauseMicros)
+{
+	float pauseMillis = (float)pauseMicros / 1000.0f;
+
+	if (_globalPauseHistoryValid) {
+		_averageGlobalPauseMillis = MM_Math::weightedAverage(_averageGlobalPauseMillis, pauseMillis, HEAP_RESIZE_HISTORY_WEIGHT);
+	} else {
+		_averageGlobalPauseMillis = pauseMillis;
+		_globalPauseHistoryValid = true;
+	}
+}
@@ -66,6 +66,15 @@ private:
 	uint64_t 				_ticksInGC[RATIO_RESIZE_HISTORIES];
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 
+	/* Weighted averages used by goal-driven heap sizing (-Xgc:heapSizingGCTimeRatio=) */
+	float					_averageAllocationRate; /**< bytes allocated in the nursery per millisecond between scavenges */
+	float					_averageSurvivalRate; /**< fraction of bytes allocated in the nursery that survive a scavenge */
+	float					_averageScavengeMillis; /**< length of a scavenge, in milliseconds */
+	float					_averageCopyRate; /**< bytes a scavenge copies or tenures per millisecond of its pause */
+	float					_averageGlobalPauseMillis; /**< length of a global collection pause, in milliseconds */
+	bool					_scavengeHistoryValid; /**< true once a scavenge has been added to the averages */
+	bool					_globalPauseHistoryValid; /**< true once a global collection pause has been added to the averages */
+
 protected:
 public:
 
@@ -73,13 +82,49 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Sum the gc and non-gc ticks over the ratio resize history.
+	 * @return false if the history has been cleared in the last RATIO_RESIZE_HISTORIES cycles
+	 */
+	bool	sumRatioTicks(uint64_t *totalGCTicks, uint64_t *totalNonGCTicks);
+
 protected:
 public:
 
 	uint32_t	calculateGCPercentage();
 
+	/**
+	 * Percentage of time being spent in gc over the same history as calculateGCPercentage(), without
+	 * truncating it to a whole percent.
+	 * @return the percentage, or 0 if there is not enough history yet
+	 */
+	float	calculateExactGCPercentage();
+
 	void	updateHeapResizeStats();
 
+	/**
+	 * Add a scavenge to the allocation rate, survival rate and scavenge time averages.
+	 * @param allocatedBytes bytes allocated in the nursery since the previous scavenge
+	 * @param survivedBytes bytes copied or tenured by the scavenge
+	 * @param scavengeMillis length of the scavenge, in milliseconds
+	 * @param intervalMillis time since the previous scavenge ended, in milliseconds
+	 */
+	void	updateScavengeHistory(uintptr_t allocatedBytes, uintptr_t survivedBytes, uint64_t scavengeMillis, uint64_t intervalMillis);
+
+	/**
+	 * Add a global collection pause to the global pause average.
+	 * @param pauseMicros length of the pause, in microseconds
+	 */
+	void	updateGlobalPauseHistory(uint64_t pauseMicros);
+
+	MMINLINE bool	isScavengeHistoryValid() { return _scavengeHistoryValid; }
+	MMINLINE float	getAverageAllocationRate() { return _averageAllocationRate; }
+	MMINLINE float	getAverageSurvivalRate() { return _averageSurvivalRate; }
+	MMINLINE float	getAverageScavengeMillis() { return _averageScavengeMillis; }
+	MMINLINE float	getAverageCopyRate() { return _averageCopyRate; }
+	MMINLINE bool	isGlobalPauseHistoryValid() { return _globalPauseHistoryValid; }
+	MMINLINE float	getAverageGlobalPauseMillis() { return _averageGlobalPauseMillis; }
+
 	MMINLINE void 	resetRatioTicks()
 	{
 		for (int i = 0; i < RATIO_RESIZE_HISTORIES; i++)
@@ -186,7 +231,14 @@ public:
 		_lastContractTime(0),
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
-		_globalGCCountAtAF(0)
+		_globalGCCountAtAF(0),
+		_averageAllocationRate(0.0f),
+		_averageSurvivalRate(0.0f),
+		_averageScavengeMillis(0.0f),
+		_averageCopyRate(0.0f),
+		_averageGlobalPauseMillis(0.0f),
+		_scavengeHistoryValid(false),
+		_globalPauseHistoryValid(false)
 	{
 		resetRatioTicks();
 	}
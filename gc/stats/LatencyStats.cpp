@@ -0,0 +1,49 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats_Core
+ */
+
+#include "LatencyStats.hpp"
+
+const char *
+MM_LatencyStats::getTypeName(MM_GCLatencyType type)
+{
+	switch (type) {
+	case GC_LATENCY_PAUSE:
+		return "pause";
+	case GC_LATENCY_ROOTS:
+		return "roots";
+	case GC_LATENCY_MARK:
+		return "mark";
+	case GC_LATENCY_SWEEP:
+		return "sweep";
+	case GC_LATENCY_COMPACT:
+		return "compact";
+	case GC_LATENCY_CARD_CLEAN:
+		return "card-clean";
+	case GC_LATENCY_SCAVENGE_COPY:
+		return "scavenge-copy";
+	case GC_LATENCY_ALLOCATION_FAILURE:
+		return "allocation-failure";
+	default:
+		return "unknown";
+	}
+}
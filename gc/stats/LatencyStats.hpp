@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(LATENCYSTATS_HPP_)
+#define LATENCYSTATS_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "PauseHistogram.hpp"
+
+/**
+ * The latencies measured by MM_LatencyStats.
+ */
+typedef enum {
+	GC_LATENCY_PAUSE = 0, /**< a stop-the-world increment of any collector */
+	GC_LATENCY_ROOTS, /**< root scanning by one GC thread */
+	GC_LATENCY_MARK, /**< the mark phase of a global collection */
+	GC_LATENCY_SWEEP, /**< the sweep phase of a global collection */
+	GC_LATENCY_COMPACT, /**< the compact phase of a global collection */
+	GC_LATENCY_CARD_CLEAN, /**< final card cleaning of a concurrent collection */
+	GC_LATENCY_SCAVENGE_COPY, /**< copying live objects out of evacuate space in a scavenge */
+	GC_LATENCY_ALLOCATION_FAILURE, /**< from an allocation failure being reported to the allocating thread resuming */
+	GC_LATENCY_TYPE_COUNT
+} MM_GCLatencyType;
+
+/**
+ * Distributions of pause and phase times over the life of the process, one histogram for each MM_GCLatencyType.
+ * Times are recorded without a lock, so the GC threads may all record their own phase times at once.
+ * @ingroup GC_Stats
+ */
+class MM_LatencyStats
+{
+public:
+	MM_PauseHistogram _histograms[GC_LATENCY_TYPE_COUNT]; /**< the distribution of each latency */
+
+	MMINLINE void clear()
+	{
+		for (uintptr_t type = 0; type < GC_LATENCY_TYPE_COUNT; type++) {
+			_histograms[type].clear();
+		}
+	}
+
+	/**
+	 * Record a latency.
+	 * @param type the latency measured
+	 * @param micros the time measured, in microseconds
+	 */
+	MMINLINE void record(MM_GCLatencyType type, uint64_t micros)
+	{
+		_histograms[type].addPause(micros);
+	}
+
+	MMINLINE MM_PauseHistogram *getHistogram(MM_GCLatencyType type)
+	{
+		return &_histograms[type];
+	}
+
+	/**
+	 * @return the name of a latency as it appears in verbose output
+	 */
+	static const char *getTypeName(MM_GCLatencyType type);
+
+	MM_LatencyStats() {}
+};
+
+#endif /* LATENCYSTATS_HPP_ */
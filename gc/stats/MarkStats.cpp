@@ -27,6 +27,7 @@ void
 MM_MarkStats::clear()
 {
 	_scanTime = 0;
+	_markMapClearTime = 0;
 	
 	_objectsMarked = 0;
 	_objectsScanned = 0;
@@ -42,6 +43,7 @@ void
 MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 {
 	_scanTime += statsToMerge->_scanTime;
+	_markMapClearTime += statsToMerge->_markMapClearTime;
 
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
@@ -37,6 +37,7 @@ class MM_MarkStats : public MM_Base
 /* data members */
 private:
 	uint64_t _scanTime; /**< The amount of time spent scanning by the owning thread (or globally) during marking, in hi-res timer resolution */
+	uint64_t _markMapClearTime; /**< The amount of time spent clearing the mark map by the owning thread (or globally) at the start of marking, in hi-res timer resolution */
 
 protected:
 public:
@@ -97,9 +98,24 @@ public:
 	 */
 	MMINLINE uint64_t getScanTime() { return _scanTime; }
 
+	/**
+	 * Add the specified interval to the amount of time attributed to clearing the mark map.
+	 * @param startTime The time clearing began, measured by omrtime_hires_clock()
+	 * @param endTime The time clearing ended, measured by omrtime_hires_clock()
+	 */
+	MMINLINE void addToMarkMapClearTime(uint64_t startTime, uint64_t endTime) { _markMapClearTime += (endTime - startTime); }
+
+	/**
+	 * Get the amount of time the receiver's thread spent clearing the mark map, in hi-res timer resolution.
+	 * For the global stats structure, this is the sum of time spent by all threads.
+	 * @return the time spent clearing the mark map
+	 */
+	MMINLINE uint64_t getMarkMapClearTime() { return _markMapClearTime; }
+
 	MM_MarkStats() :
 		MM_Base()
 		,_scanTime(0)
+		,_markMapClearTime(0)
 		,_gcCount(UDATA_MAX)
 		,_objectsMarked(0)
 		,_objectsScanned(0)
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats_Core
+ */
+
+#include "PauseHistogram.hpp"
+
+void
+MM_PauseHistogram::clear()
+{
+	for (uintptr_t bucket = 0; bucket < PAUSE_HISTOGRAM_BUCKETS; bucket++) {
+		_counts[bucket] = 0;
+	}
+	_pauseCount = 0;
+	_totalMicros = 0;
+	_maximumMicros = 0;
+}
+
+uint64_t
+MM_PauseHistogram::getPercentileMicros(double percentile)
+{
+	/* count the buckets rather than use _pauseCount, which may not yet include a pause being added */
+	uintptr_t total = 0;
+	for (uintptr_t bucket = 0; bucket < PAUSE_HISTOGRAM_BUCKETS; bucket++) {
+		total += _counts[bucket];
+	}
+	if (0 == total) {
+		return 0;
+	}
+
+	if (percentile < 0.0) {
+		percentile = 0.0;
+	} else if (percentile > 100.0) {
+		percentile = 100.0;
+	}
+	/* the rank of the pause at the percentile, rounded up, and at least the first */
+	double exactRank = (percentile * (double)total) / 100.0;
+	uintptr_t rank = (uintptr_t)exactRank;
+	if (((double)rank < exactRank) || (0 == rank)) {
+		rank += 1;
+	}
+
+	uint64_t maximum = _maximumMicros;
+	uintptr_t seen = 0;
+	for (uintptr_t bucket = 0; bucket < PAUSE_HISTOGRAM_BUCKETS; bucket++) {
+		seen += _counts[bucket];
+		if (seen >= rank) {
+			/* the largest pause time counted in the bucket */
+			uint64_t highest = getBucketLimit(bucket) - 1;
+			if ((bucket == (PAUSE_HISTOGRAM_BUCKETS - 1)) || (highest > maximum)) {
+				highest = maximum;
+			}
+			return highest;
+		}
+	}
+	return maximum;
+}
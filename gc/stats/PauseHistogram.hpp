@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(PAUSEHISTOGRAM_HPP_)
+#define PAUSEHISTOGRAM_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "Math.hpp"
+
+/* each power of two range of pause times is split into 2^PAUSE_HISTOGRAM_SUB_BUCKET_BITS buckets */
+#define PAUSE_HISTOGRAM_SUB_BUCKET_BITS 4
+#define PAUSE_HISTOGRAM_SUB_BUCKETS ((uintptr_t)1 << PAUSE_HISTOGRAM_SUB_BUCKET_BITS)
+/* pauses of 2^PAUSE_HISTOGRAM_MAXIMUM_BITS microseconds (about 71 minutes) or more are counted in the last bucket */
+#define PAUSE_HISTOGRAM_MAXIMUM_BITS 32
+#define PAUSE_HISTOGRAM_BUCKETS ((PAUSE_HISTOGRAM_MAXIMUM_BITS - PAUSE_HISTOGRAM_SUB_BUCKET_BITS + 1) * PAUSE_HISTOGRAM_SUB_BUCKETS)
+
+/**
+ * Distribution of pause times over the life of the process, in microseconds.
+ *
+ * Buckets are log-linear (as in an HDR histogram): pauses shorter than 2 * PAUSE_HISTOGRAM_SUB_BUCKETS
+ * microseconds are counted exactly, and each longer power of two range is split into PAUSE_HISTOGRAM_SUB_BUCKETS
+ * equal buckets, so any recorded value is known to within 1 / PAUSE_HISTOGRAM_SUB_BUCKETS of itself.
+ *
+ * Pauses may be added by several threads at once without a lock. Queries made while pauses are being added see
+ * each bucket consistently, but may not see the count, total and maximum of the same set of pauses.
+ * @ingroup GC_Stats
+ */
+class MM_PauseHistogram
+{
+public:
+	volatile uintptr_t _counts[PAUSE_HISTOGRAM_BUCKETS]; /**< Number of pauses in each bucket */
+	volatile uintptr_t _pauseCount; /**< Total number of pauses */
+	volatile uint64_t _totalMicros; /**< Sum of all pause times, in microseconds */
+	volatile uint64_t _maximumMicros; /**< Longest pause time, in microseconds */
+
+	void clear();
+
+	/**
+	 * @return the bucket a pause is counted in
+	 */
+	MMINLINE static uintptr_t getBucket(uint64_t micros)
+	{
+		if (micros < (2 * PAUSE_HISTOGRAM_SUB_BUCKETS)) {
+			return (uintptr_t)micros;
+		}
+		if (micros >= ((uint64_t)1 << PAUSE_HISTOGRAM_MAXIMUM_BITS)) {
+			return PAUSE_HISTOGRAM_BUCKETS - 1;
+		}
+		uintptr_t highestBit = MM_Math::floorLog2((uintptr_t)micros);
+		uintptr_t shift = highestBit - PAUSE_HISTOGRAM_SUB_BUCKET_BITS;
+		return (shift * PAUSE_HISTOGRAM_SUB_BUCKETS) + (uintptr_t)(micros >> shift);
+	}
+
+	/**
+	 * @return the smallest pause time counted in the bucket, in microseconds
+	 */
+	MMINLINE static uint64_t getBucketBase(uintptr_t bucket)
+	{
+		if (bucket < (2 * PAUSE_HISTOGRAM_SUB_BUCKETS)) {
+			return bucket;
+		}
+		uintptr_t shift = (bucket / PAUSE_HISTOGRAM_SUB_BUCKETS) - 1;
+		return (uint64_t)((bucket % PAUSE_HISTOGRAM_SUB_BUCKETS) + PAUSE_HISTOGRAM_SUB_BUCKETS) << shift;
+	}
+
+	/**
+	 * @return the exclusive upper bound of the bucket, in microseconds (the last bucket is unbounded)
+	 */
+	MMINLINE static uint64_t getBucketLimit(uintptr_t bucket)
+	{
+		return getBucketBase(bucket + 1);
+	}
+
+	/**
+	 * Count a pause. May be called by several threads at once.
+	 * @param micros the length of the pause, in microseconds
+	 */
+	MMINLINE void addPause(uint64_t micros)
+	{
+		MM_AtomicOperations::add(&_counts[getBucket(micros)], 1);
+		MM_AtomicOperations::add(&_pauseCount, 1);
+		MM_AtomicOperations::addU64(&_totalMicros, micros);
+		uint64_t maximum = _maximumMicros;
+		while (micros > maximum) {
+			uint64_t previous = MM_AtomicOperations::lockCompareExchangeU64(&_maximumMicros, maximum, micros);
+			if (previous == maximum) {
+				break;
+			}
+			maximum = previous;
+		}
+	}
+
+	/**
+	 * @return the mean pause time in microseconds, or 0 if there have been no pauses
+	 */
+	MMINLINE uint64_t getMeanMicros()
+	{
+		uintptr_t count = _pauseCount;
+		return (0 == count) ? 0 : (_totalMicros / count);
+	}
+
+	/**
+	 * Find the pause time that the given percentage of pauses were no longer than. The answer is the upper bound of
+	 * the bucket the percentile falls in, so it may overstate the percentile by up to the width of that bucket, but
+	 * is never more than the longest pause.
+	 * @param percentile the percentage of pauses, from 0 to 100
+	 * @return the pause time in microseconds, or 0 if there have been no pauses
+	 */
+	uint64_t getPercentileMicros(double percentile);
+
+	MM_PauseHistogram()
+	{
+		clear();
+	}
+};
+
+#endif /* PAUSEHISTOGRAM_HPP_ */
@@ -34,6 +34,10 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_scanCacheAllocationFromHeap(0)
 	,_scanCacheAllocationDurationDuringSavenger(0)
 	,_backout(0)
+	,_rememberedSetScanTime(0)
+	,_rememberedSetPruneTime(0)
+	,_rememberedObjectsScanned(0)
+	,_rememberedCardsScanned(0)
 	,_failedTenureCount(0)
 	,_failedTenureBytes(0)
 	,_failedTenureLargest(0)
@@ -80,6 +84,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
+	,_hotFieldChainCopyCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
@@ -121,6 +126,10 @@ MM_ScavengerStats::clear()
 	_scanCacheAllocationFromHeap = 0;
 	_scanCacheAllocationDurationDuringSavenger = 0;
 	_backout = 0;
+	_rememberedSetScanTime = 0;
+	_rememberedSetPruneTime = 0;
+	_rememberedObjectsScanned = 0;
+	_rememberedCardsScanned = 0;
 	_flipCount = 0;
 	_flipBytes = 0;
 	_tenureAggregateCount = 0;
@@ -171,6 +180,7 @@ MM_ScavengerStats::clear()
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 	_leafObjectCount = 0;
+	_hotFieldChainCopyCount = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
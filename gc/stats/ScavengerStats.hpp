@@ -57,6 +57,10 @@ public:
 	uintptr_t _scanCacheAllocationFromHeap;
 	uint64_t  _scanCacheAllocationDurationDuringSavenger;
 	uintptr_t _backout;
+	uint64_t _rememberedSetScanTime; /**< Time spent scanning the remembered set for nursery references, in hi-res ticks (slowest thread) */
+	uint64_t _rememberedSetPruneTime; /**< Time spent pruning the remembered set, in hi-res ticks (slowest thread) */
+	uintptr_t _rememberedObjectsScanned; /**< The number of remembered objects scanned for nursery references */
+	uintptr_t _rememberedCardsScanned; /**< The number of dirty cards scanned, when the remembered set is a card table */
 	uintptr_t _flipCount;
 	uintptr_t _flipBytes;
 	uintptr_t _tenureAggregateCount;
@@ -125,6 +129,7 @@ public:
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
 	uint64_t _leafObjectCount;
+	uint64_t _hotFieldChainCopyCount; /**< The number of objects copied depth first behind their parent by -Xgc:scavengerHotFieldCopyOrder */
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_sum;
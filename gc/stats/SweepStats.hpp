@@ -40,6 +40,12 @@ public:
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t concurrentSweepRegions; /**< Number of small regions the previous collection left to be swept after it */
+	uintptr_t concurrentSweepBackgroundRegions; /**< Number of those regions swept by the background sweeper */
+	uintptr_t concurrentSweepUnsweptRegions; /**< Number of those regions still unswept when this collection started, and swept by it */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uint64_t idleTime;
 	uint64_t mergeTime;
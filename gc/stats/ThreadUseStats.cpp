@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats_Core
+ */
+
+#include "omrport.h"
+
+#include "ThreadUseStats.hpp"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Task.hpp"
+
+uintptr_t
+MM_ThreadUseStats::recommendThreadCount(MM_GCThreadTaskType type, uint64_t estimatedWork, uintptr_t minimumWorkMicros)
+{
+	MM_TaskThreadUse *lastUse = &_tasks[type];
+	double throughput = lastUse->getThroughput();
+	if (0.0 == throughput) {
+		return UDATA_MAX;
+	}
+
+	/* A thread must be given at least the minimum work, and no less than the threads spent idle last time, since
+	 * that is what each thread cost when the work was split that way
+	 */
+	double idleMicrosPerThread = (double)lastUse->_idleMicros / (double)lastUse->_threadCount;
+	double workMicrosPerThread = OMR_MAX((double)minimumWorkMicros, idleMicrosPerThread);
+	double singleThreadMicros = (double)estimatedWork / throughput;
+
+	double threads = singleThreadMicros / workMicrosPerThread;
+	if (threads < 1.0) {
+		return 1;
+	}
+	if (threads >= (double)(UDATA_MAX - 1)) {
+		return UDATA_MAX - 1;
+	}
+	return (uintptr_t)threads;
+}
+
+void
+MM_ThreadUseStats::record(MM_GCThreadTaskType type, uint64_t estimatedWork, uintptr_t threadCount, uintptr_t threadCountMaximum, uint64_t elapsedMicros, uint64_t idleMicros, uint64_t endTime)
+{
+	MM_TaskThreadUse *use = &_tasks[type];
+	use->_estimatedWork = estimatedWork;
+	use->_threadCount = threadCount;
+	use->_threadCountMaximum = threadCountMaximum;
+	use->_elapsedMicros = elapsedMicros;
+	use->_idleMicros = idleMicros;
+	use->_endTime = endTime;
+}
+
+void
+MM_ThreadUseStats::runTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_Task *task, MM_GCThreadTaskType type, uint64_t estimatedWork)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (extensions->adaptiveGCThreading) {
+		task->setRecommendedThreadCount(recommendThreadCount(type, estimatedWork, extensions->adaptiveGCThreadingMinimumWork));
+	}
+
+	uint64_t startTime = omrtime_hires_clock();
+	dispatcher->run(env, task);
+	uint64_t endTime = omrtime_hires_clock();
+
+	record(type, estimatedWork, task->getThreadCount(), dispatcher->threadCount(),
+		omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		omrtime_hires_delta(0, task->getIdleTicks(), OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		endTime);
+}
+
+const char *
+MM_ThreadUseStats::getTypeName(MM_GCThreadTaskType type)
+{
+	switch (type) {
+	case GC_THREADS_SCAVENGE:
+		return "scavenge";
+	case GC_THREADS_MARK:
+		return "mark";
+	case GC_THREADS_FINAL_MARK:
+		return "final-mark";
+	default:
+		return "unknown";
+	}
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(THREADUSESTATS_HPP_)
+#define THREADUSESTATS_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+class MM_Task;
+
+/**
+ * The parallel tasks whose thread count is chosen from the work they are expected to do.
+ */
+typedef enum {
+	GC_THREADS_SCAVENGE = 0, /**< a scavenge, with work estimated from the nursery occupancy */
+	GC_THREADS_MARK, /**< the mark phase of a global collection, with work estimated from the heap occupancy */
+	GC_THREADS_FINAL_MARK, /**< completing a concurrent mark, with work estimated from the work packets left to scan */
+	GC_THREADS_TASK_TYPE_COUNT
+} MM_GCThreadTaskType;
+
+/**
+ * How a parallel task used its threads the last time it was dispatched.
+ * @ingroup GC_Stats
+ */
+class MM_TaskThreadUse
+{
+public:
+	uint64_t _estimatedWork; /**< work the task was expected to do, in the units of its estimate */
+	uintptr_t _threadCount; /**< threads the task was dispatched with */
+	uintptr_t _threadCountMaximum; /**< threads the dispatcher had available */
+	uint64_t _elapsedMicros; /**< time from dispatching the task to its completion */
+	uint64_t _idleMicros; /**< time the threads spent stalled waiting for work or for each other, summed over the threads */
+	uint64_t _endTime; /**< hi-res time the task completed, or 0 if it has not been dispatched */
+
+	/**
+	 * @return units of estimated work one thread completed per microsecond it was not stalled, or 0 if not measured
+	 */
+	MMINLINE double getThroughput()
+	{
+		uint64_t threadMicros = _elapsedMicros * _threadCount;
+		if ((0 == _estimatedWork) || (threadMicros <= _idleMicros)) {
+			return 0.0;
+		}
+		return (double)_estimatedWork / (double)(threadMicros - _idleMicros);
+	}
+
+	MM_TaskThreadUse() :
+		_estimatedWork(0)
+		,_threadCount(0)
+		,_threadCountMaximum(0)
+		,_elapsedMicros(0)
+		,_idleMicros(0)
+		,_endTime(0)
+	{}
+};
+
+/**
+ * Thread use of each kind of parallel task, used to choose how many threads to dispatch a task with.
+ * A thread is only worth waking if its share of the work takes longer than the thread costs, so a task with
+ * little work, such as a scavenge of a nearly empty nursery, runs on fewer threads than are available.
+ * @ingroup GC_Stats
+ */
+class MM_ThreadUseStats
+{
+public:
+	MM_TaskThreadUse _tasks[GC_THREADS_TASK_TYPE_COUNT]; /**< the last dispatch of each task */
+
+	/**
+	 * Choose the number of threads to dispatch a task with, from the work it is expected to do and the
+	 * throughput per thread measured the last time it ran.
+	 * @param type the task
+	 * @param estimatedWork the work the task is expected to do, in the same units as when it was last recorded
+	 * @param minimumWorkMicros the least time worth giving a thread
+	 * @return the recommended thread count, at least 1, or UDATA_MAX if the task has not been measured
+	 */
+	uintptr_t recommendThreadCount(MM_GCThreadTaskType type, uint64_t estimatedWork, uintptr_t minimumWorkMicros);
+
+	/**
+	 * Record how a task used its threads.
+	 * @param type the task
+	 * @param estimatedWork the work the task was expected to do
+	 * @param threadCount threads the task was dispatched with
+	 * @param threadCountMaximum threads the dispatcher had available
+	 * @param elapsedMicros time from dispatching the task to its completion
+	 * @param idleMicros time the threads spent stalled, summed over the threads
+	 * @param endTime hi-res time the task completed
+	 */
+	void record(MM_GCThreadTaskType type, uint64_t estimatedWork, uintptr_t threadCount, uintptr_t threadCountMaximum, uint64_t elapsedMicros, uint64_t idleMicros, uint64_t endTime);
+
+	/**
+	 * Dispatch a task on the number of threads recommended for its estimated work (when adaptive GC threading
+	 * is enabled) and record how it used them.
+	 * @param env master thread environment
+	 * @param dispatcher the dispatcher to run the task on
+	 * @param task the task, which must account its threads' stalls with addIdleTicks()
+	 * @param type the task
+	 * @param estimatedWork the work the task is expected to do
+	 */
+	void runTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_Task *task, MM_GCThreadTaskType type, uint64_t estimatedWork);
+
+	MMINLINE MM_TaskThreadUse *getTaskThreadUse(MM_GCThreadTaskType type)
+	{
+		return &_tasks[type];
+	}
+
+	/**
+	 * @return the name of a task as it appears in verbose output
+	 */
+	static const char *getTypeName(MM_GCThreadTaskType type);
+
+	MM_ThreadUseStats() {}
+};
+
+#endif /* THREADUSESTATS_HPP_ */
@@ -31,6 +31,8 @@
 #include "modronopt.h"
 #include "AtomicOperations.hpp"
 
+#define OMR_WORKPACKET_NUMA_NODE_BINS 8 /**< Number of NUMA nodes tracked individually by the packet list statistics (higher nodes share the last bin) */
+
 /**
  * Storage for statistics relevant to a copy forward collector.
  * @ingroup GC_Stats
@@ -39,6 +41,11 @@ class MM_WorkPacketStats
 {
 public:
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
+	uintptr_t workPacketsStolen; /**< The number of input packets taken from another thread's work stealing deque */
+	uintptr_t workPacketStealAttempts; /**< The number of attempts to steal an input packet from another thread's work stealing deque */
+	uintptr_t numaNodePushCount[OMR_WORKPACKET_NUMA_NODE_BINS]; /**< The number of packets pushed on the packet lists of each NUMA node */
+	uintptr_t numaNodePopCount[OMR_WORKPACKET_NUMA_NODE_BINS]; /**< The number of packets popped by threads of each NUMA node */
+	uintptr_t numaNodeCrossNodePopCount[OMR_WORKPACKET_NUMA_NODE_BINS]; /**< The number of packets popped by threads of each NUMA node from the packet lists of another node */
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
@@ -61,6 +68,13 @@ public:
 		_stwWorkStackOverflowCount = 0;
 		_stwWorkStackOverflowOccured = false;
 		_stwWorkpacketCountAtOverflow = 0;
+		workPacketsStolen = 0;
+		workPacketStealAttempts = 0;
+		for (uintptr_t i = 0; i < OMR_WORKPACKET_NUMA_NODE_BINS; i++) {
+			numaNodePushCount[i] = 0;
+			numaNodePopCount[i] = 0;
+			numaNodeCrossNodePopCount[i] = 0;
+		}
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_workStallCount = 0;
 		_completeStallCount = 0;
@@ -77,6 +91,13 @@ public:
 		_stwWorkStackOverflowCount += statsToMerge->_stwWorkStackOverflowCount;
 		_stwWorkStackOverflowOccured = (_stwWorkStackOverflowOccured || statsToMerge->_stwWorkStackOverflowOccured);
 		_stwWorkpacketCountAtOverflow = OMR_MAX(_stwWorkpacketCountAtOverflow, statsToMerge->_stwWorkpacketCountAtOverflow);
+		workPacketsStolen += statsToMerge->workPacketsStolen;
+		workPacketStealAttempts += statsToMerge->workPacketStealAttempts;
+		for (uintptr_t i = 0; i < OMR_WORKPACKET_NUMA_NODE_BINS; i++) {
+			numaNodePushCount[i] += statsToMerge->numaNodePushCount[i];
+			numaNodePopCount[i] += statsToMerge->numaNodePopCount[i];
+			numaNodeCrossNodePopCount[i] += statsToMerge->numaNodeCrossNodePopCount[i];
+		}
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
@@ -128,6 +149,31 @@ public:
 	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	/**
+	 * Record a packet pushed on a packet list of the specified NUMA node.
+	 * @param nodeIndex index of the node (0 based)
+	 */
+	MMINLINE void
+	recordNUMANodePush(uintptr_t nodeIndex)
+	{
+		numaNodePushCount[OMR_MIN(nodeIndex, OMR_WORKPACKET_NUMA_NODE_BINS - 1)] += 1;
+	}
+
+	/**
+	 * Record a packet popped by a thread of the specified NUMA node.
+	 * @param nodeIndex index of the node (0 based) of the popping thread
+	 * @param crossNode true if the packet was taken from the packet list of another node
+	 */
+	MMINLINE void
+	recordNUMANodePop(uintptr_t nodeIndex, bool crossNode)
+	{
+		uintptr_t bin = OMR_MIN(nodeIndex, OMR_WORKPACKET_NUMA_NODE_BINS - 1);
+		numaNodePopCount[bin] += 1;
+		if (crossNode) {
+			numaNodeCrossNodePopCount[bin] += 1;
+		}
+	}
+
 	MMINLINE bool getSTWWorkStackOverflowOccured()	{ return _stwWorkStackOverflowOccured; };
 	MMINLINE void setSTWWorkStackOverflowOccured(bool overflow)	{ _stwWorkStackOverflowOccured = overflow; };
 	MMINLINE uintptr_t getSTWWorkStackOverflowCount()	{ return _stwWorkStackOverflowCount; };
@@ -140,6 +186,8 @@ public:
 
 	MM_WorkPacketStats() :
 		_gcCount(UDATA_MAX)
+		,workPacketsStolen(0)
+		,workPacketStealAttempts(0)
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
@@ -150,7 +198,13 @@ public:
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
-	{}
+	{
+		for (uintptr_t i = 0; i < OMR_WORKPACKET_NUMA_NODE_BINS; i++) {
+			numaNodePushCount[i] = 0;
+			numaNodePopCount[i] = 0;
+			numaNodeCrossNodePopCount[i] = 0;
+		}
+	}
 
 protected:
 private:
@@ -0,0 +1,320 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "VerboseBinaryBuffer.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseBuffer.hpp"
+
+#include "ModronAssertions.h"
+
+#include <string.h>
+
+/**
+ * Instantiate a new binary buffer object
+ * @param size Initial size of the buffer of encoded lines
+ */
+MM_VerboseBinaryBuffer *
+MM_VerboseBinaryBuffer::newInstance(MM_EnvironmentBase *env, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	MM_VerboseBinaryBuffer *binaryBuffer = (MM_VerboseBinaryBuffer *)extensions->getForge()->allocate(sizeof(MM_VerboseBinaryBuffer), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != binaryBuffer) {
+		new(binaryBuffer) MM_VerboseBinaryBuffer(env);
+		if (!binaryBuffer->initialize(env, size)) {
+			binaryBuffer->kill(env);
+			binaryBuffer = NULL;
+		}
+	}
+	return binaryBuffer;
+}
+
+bool
+MM_VerboseBinaryBuffer::initialize(MM_EnvironmentBase *env, uintptr_t size)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (!ensureCapacity(env, &_buffer, &_bufferAlloc, &_bufferTop, size)) {
+		return false;
+	}
+	if (!ensureCapacity(env, &_definitions, &_definitionsAlloc, &_definitionsTop, size)) {
+		return false;
+	}
+
+	uintptr_t tableSize = sizeof(FormatEntry) * VERBOSE_BINARY_FORMAT_TABLE_SIZE;
+	_formats = (FormatEntry *)extensions->getForge()->allocate(tableSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _formats) {
+		return false;
+	}
+	memset(_formats, 0, tableSize);
+
+	_scratch = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	return (NULL != _scratch);
+}
+
+void
+MM_VerboseBinaryBuffer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getExtensions()->getForge()->free(this);
+}
+
+void
+MM_VerboseBinaryBuffer::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _formats) {
+		for (uintptr_t index = 0; index < VERBOSE_BINARY_FORMAT_TABLE_SIZE; index++) {
+			extensions->getForge()->free(_formats[index].text);
+			extensions->getForge()->free(_formats[index].argTypes);
+		}
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+	if (NULL != _scratch) {
+		_scratch->kill(env);
+		_scratch = NULL;
+	}
+	extensions->getForge()->free(_buffer);
+	_buffer = NULL;
+	extensions->getForge()->free(_definitions);
+	_definitions = NULL;
+}
+
+bool
+MM_VerboseBinaryBuffer::ensureCapacity(MM_EnvironmentBase *env, uint8_t **base, uint8_t **alloc, uint8_t **top, uintptr_t spaceNeeded)
+{
+	if ((uintptr_t)(*top - *alloc) < spaceNeeded) {
+		/* Not enough space in the current array - try to alloc a larger one and use that */
+		uintptr_t currentSize = *alloc - *base;
+		uintptr_t newSize = (currentSize + spaceNeeded) + ((currentSize + spaceNeeded) / 2);
+		uint8_t *newBase = (uint8_t *)env->getExtensions()->getForge()->allocate(newSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == newBase) {
+			return false;
+		}
+		if (NULL != *base) {
+			memcpy(newBase, *base, currentSize);
+			env->getExtensions()->getForge()->free(*base);
+		}
+		*base = newBase;
+		*alloc = newBase + currentSize;
+		*top = newBase + newSize;
+	}
+	return true;
+}
+
+bool
+MM_VerboseBinaryBuffer::addDefinition(MM_EnvironmentBase *env, uint8_t **base, uint8_t **alloc, uint8_t **top, uintptr_t id, const char *text)
+{
+	uintptr_t length = strlen(text);
+	if (!ensureCapacity(env, base, alloc, top, 1 + (2 * VERBOSE_BINARY_MAX_VARINT_SIZE) + length)) {
+		return false;
+	}
+	uint8_t *cursor = *alloc;
+	*cursor++ = VERBOSE_BINARY_RECORD_DEFINE;
+	cursor = MM_VerboseBinaryFormat::encodeVarint(cursor, id);
+	cursor = MM_VerboseBinaryFormat::encodeVarint(cursor, length);
+	memcpy(cursor, text, length);
+	*alloc = cursor + length;
+	return true;
+}
+
+MM_VerboseBinaryBuffer::FormatEntry *
+MM_VerboseBinaryBuffer::findFormat(MM_EnvironmentBase *env, const char *format)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t mask = VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1;
+	uintptr_t index = (((uintptr_t)format >> 3) ^ ((uintptr_t)format >> 13)) & mask;
+
+	while (NULL != _formats[index].format) {
+		FormatEntry *entry = &_formats[index];
+		if (format == entry->format) {
+			if (entry->encodable && (0 == strcmp(entry->text, format))) {
+				return entry;
+			}
+			/* the format can not be encoded, or is in a buffer that has been reused for different text */
+			return NULL;
+		}
+		index = (index + 1) & mask;
+	}
+
+	if (_formatCount >= ((VERBOSE_BINARY_FORMAT_TABLE_SIZE / 4) * 3)) {
+		/* keep the probe sequences short */
+		return NULL;
+	}
+
+	uintptr_t argCount = 0;
+	bool encodable = true;
+	const char *start = NULL;
+	const char *end = format;
+	VerboseBinaryArgType argType = VERBOSE_BINARY_ARG_NONE;
+	while (VERBOSE_BINARY_ARG_NONE != (argType = MM_VerboseBinaryFormat::nextConversion(end, &start, &end))) {
+		if (VERBOSE_BINARY_ARG_UNSUPPORTED == argType) {
+			encodable = false;
+		}
+		argCount += 1;
+	}
+
+	uintptr_t textSize = strlen(format) + 1;
+	char *text = (char *)extensions->getForge()->allocate(textSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	uint8_t *argTypes = (uint8_t *)extensions->getForge()->allocate(argCount + 1, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == text) || (NULL == argTypes)) {
+		extensions->getForge()->free(text);
+		extensions->getForge()->free(argTypes);
+		return NULL;
+	}
+	memcpy(text, format, textSize);
+	argCount = 0;
+	end = text;
+	while (VERBOSE_BINARY_ARG_NONE != (argType = MM_VerboseBinaryFormat::nextConversion(end, &start, &end))) {
+		argTypes[argCount++] = (uint8_t)argType;
+	}
+
+	FormatEntry *entry = &_formats[index];
+	entry->format = format;
+	entry->text = text;
+	entry->argTypes = argTypes;
+	entry->argCount = argCount;
+	entry->id = _formatCount;
+	_formatCount += 1;
+
+	/* the definition goes to the file being written, and to any opened later */
+	entry->encodable = encodable
+		&& addDefinition(env, &_definitions, &_definitionsAlloc, &_definitionsTop, entry->id, text)
+		&& addDefinition(env, &_buffer, &_bufferAlloc, &_bufferTop, entry->id, text);
+
+	return entry->encodable ? entry : NULL;
+}
+
+void
+MM_VerboseBinaryBuffer::addFormattedLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	_scratch->reset();
+	for (uintptr_t i = 0; i < indent; ++i) {
+		_scratch->add(env, VERBOSE_INDENT_SPACER);
+	}
+	_scratch->vprintf(env, format, args);
+	_scratch->add(env, "\n");
+
+	uintptr_t length = _scratch->currentSize();
+	if (ensureCapacity(env, &_buffer, &_bufferAlloc, &_bufferTop, 1 + VERBOSE_BINARY_MAX_VARINT_SIZE + length)) {
+		uint8_t *cursor = _bufferAlloc;
+		*cursor++ = VERBOSE_BINARY_RECORD_RAW;
+		cursor = MM_VerboseBinaryFormat::encodeVarint(cursor, length);
+		memcpy(cursor, _scratch->contents(), length);
+		_bufferAlloc = cursor + length;
+	}
+}
+
+void
+MM_VerboseBinaryBuffer::addLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	FormatEntry *entry = findFormat(env, format);
+	if (NULL == entry) {
+		addFormattedLine(env, indent, format, args);
+		return;
+	}
+
+	/* a line that can not be completed is dropped rather than left half encoded */
+	uintptr_t lineOffset = currentSize();
+	bool success = ensureCapacity(env, &_buffer, &_bufferAlloc, &_bufferTop, 1 + (2 * VERBOSE_BINARY_MAX_VARINT_SIZE));
+	if (success) {
+		*_bufferAlloc++ = VERBOSE_BINARY_RECORD_LINE;
+		_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, indent);
+		_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, entry->id);
+	}
+
+	for (uintptr_t argIndex = 0; success && (argIndex < entry->argCount); argIndex++) {
+		success = ensureCapacity(env, &_buffer, &_bufferAlloc, &_bufferTop, VERBOSE_BINARY_MAX_VARINT_SIZE);
+		if (!success) {
+			break;
+		}
+		switch (entry->argTypes[argIndex]) {
+		case VERBOSE_BINARY_ARG_INT:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, MM_VerboseBinaryFormat::zigzagEncode(va_arg(args, int)));
+			break;
+		case VERBOSE_BINARY_ARG_UINT:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, va_arg(args, unsigned int));
+			break;
+		case VERBOSE_BINARY_ARG_LONG:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, MM_VerboseBinaryFormat::zigzagEncode(va_arg(args, long)));
+			break;
+		case VERBOSE_BINARY_ARG_ULONG:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, va_arg(args, unsigned long));
+			break;
+		case VERBOSE_BINARY_ARG_LONGLONG:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, MM_VerboseBinaryFormat::zigzagEncode(va_arg(args, long long)));
+			break;
+		case VERBOSE_BINARY_ARG_ULONGLONG:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, va_arg(args, unsigned long long));
+			break;
+		case VERBOSE_BINARY_ARG_SSIZE:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, MM_VerboseBinaryFormat::zigzagEncode(va_arg(args, intptr_t)));
+			break;
+		case VERBOSE_BINARY_ARG_SIZE:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, va_arg(args, size_t));
+			break;
+		case VERBOSE_BINARY_ARG_POINTER:
+			_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, (uintptr_t)va_arg(args, void *));
+			break;
+		case VERBOSE_BINARY_ARG_DOUBLE:
+		{
+			double value = va_arg(args, double);
+			uint64_t bits = 0;
+			memcpy(&bits, &value, sizeof(bits));
+			for (uintptr_t byte = 0; byte < sizeof(bits); byte++) {
+				*_bufferAlloc++ = (uint8_t)(bits >> (8 * byte));
+			}
+			break;
+		}
+		case VERBOSE_BINARY_ARG_STRING:
+		{
+			const char *string = va_arg(args, const char *);
+			uintptr_t length = (NULL == string) ? 0 : strlen(string);
+			success = ensureCapacity(env, &_buffer, &_bufferAlloc, &_bufferTop, VERBOSE_BINARY_MAX_VARINT_SIZE + length);
+			if (success) {
+				_bufferAlloc = MM_VerboseBinaryFormat::encodeVarint(_bufferAlloc, (NULL == string) ? 0 : (length + 1));
+				if (0 != length) {
+					memcpy(_bufferAlloc, string, length);
+					_bufferAlloc += length;
+				}
+			}
+			break;
+		}
+		default:
+			Assert_MM_unreachable();
+			break;
+		}
+	}
+
+	if (!success) {
+		_bufferAlloc = _buffer + lineOffset;
+	}
+}
+
+void
+MM_VerboseBinaryBuffer::endRecord(MM_EnvironmentBase *env)
+{
+	if (ensureCapacity(env, &_buffer, &_bufferAlloc, &_bufferTop, 1)) {
+		*_bufferAlloc++ = VERBOSE_BINARY_RECORD_END_RECORD;
+	}
+}
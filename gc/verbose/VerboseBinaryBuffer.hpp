@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSE_BINARY_BUFFER_HPP_)
+#define VERBOSE_BINARY_BUFFER_HPP_
+
+#include "omrcfg.h"
+#include "omrstdarg.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+
+class MM_VerboseBuffer;
+
+/* number of distinct format strings that can be encoded; lines using any others are written formatted */
+#define VERBOSE_BINARY_FORMAT_TABLE_SIZE 1024
+
+/**
+ * Verbose binary buffer
+ *
+ * Encodes lines of verbose output in the binary verbose format (see VerboseBinaryFormat.hpp), holding them
+ * until they are flushed to the binary writers. Format strings are identified by address; the text of each is
+ * kept when it is defined, so a format whose address is reused for different text is written formatted.
+ * The definitions of every format string encoded so far are also kept, for writers to repeat at the start of
+ * each file they open.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseBinaryBuffer : public MM_Base
+{
+/*
+ * Member data
+ */
+private:
+	struct FormatEntry {
+		const char *format; /**< the format string passed by the caller, or NULL if the entry is free */
+		char *text; /**< the text of the format string when it was defined */
+		uint8_t *argTypes; /**< the VerboseBinaryArgType of each argument, in order */
+		uintptr_t argCount; /**< the number of entries in argTypes */
+		uintptr_t id; /**< the id of the format in the encoded output */
+		bool encodable; /**< false if the format has a conversion that can not be encoded */
+	};
+
+	uint8_t *_buffer; /**< Pointer to the base of the encoded lines */
+	uint8_t *_bufferAlloc; /**< Pointer to the next byte of the encoded lines */
+	uint8_t *_bufferTop; /**< Pointer to the top of the encoded lines (non-inclusive) */
+	uint8_t *_definitions; /**< Pointer to the base of the definitions of every format encoded */
+	uint8_t *_definitionsAlloc; /**< Pointer to the next byte of the definitions */
+	uint8_t *_definitionsTop; /**< Pointer to the top of the definitions (non-inclusive) */
+	FormatEntry *_formats; /**< Hash table of the format strings seen, by address */
+	uintptr_t _formatCount; /**< Number of entries in use in _formats */
+	MM_VerboseBuffer *_scratch; /**< Lines that can not be encoded are formatted here */
+protected:
+public:
+
+/*
+ * Member functions
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t size);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Ensure that there are at least spaceNeeded bytes left in a growable byte array.
+	 * @return true on success, false if the array could not be expanded
+	 */
+	bool ensureCapacity(MM_EnvironmentBase *env, uint8_t **base, uint8_t **alloc, uint8_t **top, uintptr_t spaceNeeded);
+
+	/**
+	 * Find the entry for a format string, defining it if it has not been seen before.
+	 * @return the entry, or NULL if lines using the format must be written formatted
+	 */
+	FormatEntry *findFormat(MM_EnvironmentBase *env, const char *format);
+
+	/**
+	 * Append a DEFINE record to a growable byte array.
+	 * @return true on success, false if the array could not be expanded
+	 */
+	bool addDefinition(MM_EnvironmentBase *env, uint8_t **base, uint8_t **alloc, uint8_t **top, uintptr_t id, const char *text);
+
+	/**
+	 * Format a line as the text writers would and append it as a RAW record.
+	 */
+	void addFormattedLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+protected:
+
+public:
+	static MM_VerboseBinaryBuffer *newInstance(MM_EnvironmentBase *env, uintptr_t size);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Encode a line of output.
+	 * @param env[in] the current thread
+	 * @param indent[in] the indent level of the line
+	 * @param format[in] a format string; see omrstr_printf
+	 * @param args[in] a va_list describing the arguments to format
+	 */
+	void addLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Mark the end of a group of lines flushed together.
+	 */
+	void endRecord(MM_EnvironmentBase *env);
+
+	MMINLINE void reset() { _bufferAlloc = _buffer; }
+
+	MMINLINE uint8_t *contents() { return _buffer; }
+	MMINLINE uintptr_t currentSize() { return _bufferAlloc - _buffer; }
+
+	MMINLINE uint8_t *definitions() { return _definitions; }
+	MMINLINE uintptr_t definitionsSize() { return _definitionsAlloc - _definitions; }
+
+	MM_VerboseBinaryBuffer(MM_EnvironmentBase *env) :
+		MM_Base(),
+		_buffer(NULL),
+		_bufferAlloc(NULL),
+		_bufferTop(NULL),
+		_definitions(NULL),
+		_definitionsAlloc(NULL),
+		_definitionsTop(NULL),
+		_formats(NULL),
+		_formatCount(0),
+		_scratch(NULL)
+	{}
+};
+
+#endif /* VERBOSE_BINARY_BUFFER_HPP_ */
@@ -0,0 +1,504 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "VerboseBinaryDecoder.hpp"
+
+#include "omrstdarg.h"
+
+#include <string.h>
+
+/* size of the buffer the file is read through */
+#define VERBOSE_BINARY_DECODER_READ_SIZE (64 * 1024)
+
+/* the longest single conversion in a format string, e.g. "%-020.10llu" */
+#define VERBOSE_BINARY_DECODER_MAX_CONVERSION 32
+
+/* the largest format id accepted, to bound the format table of a corrupt file */
+#define VERBOSE_BINARY_DECODER_MAX_FORMAT_ID (1024 * 1024)
+
+MM_VerboseBinaryDecoder::DecodeResult
+MM_VerboseBinaryDecoder::decode(const char *filename, MM_VerboseBinaryDecoderVisitor *visitor)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (NULL == _input) {
+		_input = (uint8_t *)omrmem_allocate_memory(VERBOSE_BINARY_DECODER_READ_SIZE, OMRMEM_CATEGORY_MM);
+		if (NULL == _input) {
+			return DECODE_ERROR_MEMORY;
+		}
+	}
+
+	_fileDescriptor = omrfile_open(filename, EsOpenRead, 0);
+	if (-1 == _fileDescriptor) {
+		return DECODE_ERROR_OPEN;
+	}
+
+	_inputCursor = 0;
+	_inputTop = 0;
+	_outputSize = 0;
+	_error = DECODE_OK;
+
+	DecodeResult result = decodeRecords(visitor);
+
+	omrfile_close(_fileDescriptor);
+	_fileDescriptor = -1;
+
+	/* format ids are only meaningful within a file */
+	for (uintptr_t id = 0; id < _formatsSize; id++) {
+		omrmem_free_memory(_formats[id]);
+		_formats[id] = NULL;
+	}
+
+	return result;
+}
+
+MM_VerboseBinaryDecoder::DecodeResult
+MM_VerboseBinaryDecoder::decodeRecords(MM_VerboseBinaryDecoderVisitor *visitor)
+{
+	uint8_t magic[VERBOSE_BINARY_MAGIC_LENGTH + 1];
+	if (!readBytes(magic, sizeof(magic))) {
+		return (DECODE_ERROR_TRUNCATED == _error) ? DECODE_ERROR_FORMAT : _error;
+	}
+	if ((0 != memcmp(magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH)) || (VERBOSE_BINARY_VERSION != magic[VERBOSE_BINARY_MAGIC_LENGTH])) {
+		return DECODE_ERROR_FORMAT;
+	}
+
+	uint8_t type = 0;
+	while (readByte(&type, true)) {
+		uintptr_t length = 0;
+		uint64_t id = 0;
+
+		switch (type) {
+		case VERBOSE_BINARY_RECORD_HEADER:
+			if (!readText(&length, false, NULL)) {
+				return _error;
+			}
+			if (!visitor->header(_string, length)) {
+				return DECODE_STOPPED;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_DEFINE:
+			if (!readVarint(&id) || !readText(&length, false, NULL) || !defineFormat(id, _string, length)) {
+				return _error;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_LINE:
+			if (!decodeLine()) {
+				return _error;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_RAW:
+			if (!readText(&length, false, NULL) || !appendText(_string, length)) {
+				return _error;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_END_RECORD:
+			if (0 != _outputSize) {
+				if (!visitor->record(_output, _outputSize)) {
+					return DECODE_STOPPED;
+				}
+				_outputSize = 0;
+			}
+			break;
+		case VERBOSE_BINARY_RECORD_FOOTER:
+			if (!readText(&length, false, NULL)) {
+				return _error;
+			}
+			/* the text writers end the file with a newline after the footer */
+			_string[length] = '\n';
+			_string[length + 1] = '\0';
+			if ((0 != _outputSize) && !visitor->record(_output, _outputSize)) {
+				return DECODE_STOPPED;
+			}
+			_outputSize = 0;
+			if (!visitor->footer(_string, length + 1)) {
+				return DECODE_STOPPED;
+			}
+			break;
+		default:
+			return DECODE_ERROR_FORMAT;
+		}
+	}
+
+	if (DECODE_OK != _error) {
+		return _error;
+	}
+
+	/* lines that were not ended, e.g. if the process ended part way through writing a record */
+	if ((0 != _outputSize) && !visitor->record(_output, _outputSize)) {
+		return DECODE_STOPPED;
+	}
+	_outputSize = 0;
+
+	return DECODE_OK;
+}
+
+bool
+MM_VerboseBinaryDecoder::readByte(uint8_t *value, bool endAllowed)
+{
+	if (_inputCursor == _inputTop) {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		/* omrfile_read returns -1 both at the end of the file and on error */
+		intptr_t bytesRead = omrfile_read(_fileDescriptor, _input, VERBOSE_BINARY_DECODER_READ_SIZE);
+		if (0 >= bytesRead) {
+			if (!endAllowed) {
+				_error = DECODE_ERROR_TRUNCATED;
+			}
+			return false;
+		}
+		_inputCursor = 0;
+		_inputTop = (uintptr_t)bytesRead;
+	}
+	*value = _input[_inputCursor];
+	_inputCursor += 1;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::readVarint(uint64_t *value)
+{
+	uint64_t result = 0;
+	for (uintptr_t shift = 0; shift < (7 * VERBOSE_BINARY_MAX_VARINT_SIZE); shift += 7) {
+		uint8_t byte = 0;
+		if (!readByte(&byte, false)) {
+			return false;
+		}
+		result |= (uint64_t)(byte & 0x7F) << shift;
+		if (0 == (byte & 0x80)) {
+			*value = result;
+			return true;
+		}
+	}
+	_error = DECODE_ERROR_FORMAT;
+	return false;
+}
+
+bool
+MM_VerboseBinaryDecoder::readBytes(void *buffer, uintptr_t length)
+{
+	uint8_t *cursor = (uint8_t *)buffer;
+	while (0 != length) {
+		if (_inputCursor == _inputTop) {
+			if (!readByte(cursor, false)) {
+				return false;
+			}
+			cursor += 1;
+			length -= 1;
+		} else {
+			uintptr_t available = _inputTop - _inputCursor;
+			uintptr_t toCopy = (available < length) ? available : length;
+			memcpy(cursor, _input + _inputCursor, toCopy);
+			_inputCursor += toCopy;
+			cursor += toCopy;
+			length -= toCopy;
+		}
+	}
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::readText(uintptr_t *length, bool nullAllowed, bool *isNull)
+{
+	uint64_t encodedLength = 0;
+	if (!readVarint(&encodedLength)) {
+		return false;
+	}
+	if (nullAllowed) {
+		*isNull = (0 == encodedLength);
+		if (*isNull) {
+			*length = 0;
+			return true;
+		}
+		encodedLength -= 1;
+	}
+	if (encodedLength > (UDATA_MAX / 2)) {
+		_error = DECODE_ERROR_FORMAT;
+		return false;
+	}
+
+	/* leave room for a newline and a NUL after the text */
+	if (!ensureCapacity(&_string, &_stringCapacity, (uintptr_t)encodedLength + 2) || !readBytes(_string, (uintptr_t)encodedLength)) {
+		return false;
+	}
+	_string[encodedLength] = '\0';
+	*length = (uintptr_t)encodedLength;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::defineFormat(uint64_t id, const char *text, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (VERBOSE_BINARY_DECODER_MAX_FORMAT_ID <= id) {
+		_error = DECODE_ERROR_FORMAT;
+		return false;
+	}
+
+	if (id >= _formatsSize) {
+		uintptr_t newSize = OMR_MAX((uintptr_t)id + 1, 2 * _formatsSize);
+		char **newFormats = (char **)omrmem_reallocate_memory(_formats, newSize * sizeof(char *), OMRMEM_CATEGORY_MM);
+		if (NULL == newFormats) {
+			_error = DECODE_ERROR_MEMORY;
+			return false;
+		}
+		memset(newFormats + _formatsSize, 0, (newSize - _formatsSize) * sizeof(char *));
+		_formats = newFormats;
+		_formatsSize = newSize;
+	}
+
+	/* a file repeats the definitions of the formats used before it was opened, so an id may be defined again */
+	char *format = (char *)omrmem_allocate_memory(length + 1, OMRMEM_CATEGORY_MM);
+	if (NULL == format) {
+		_error = DECODE_ERROR_MEMORY;
+		return false;
+	}
+	memcpy(format, text, length + 1);
+	omrmem_free_memory(_formats[id]);
+	_formats[id] = format;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::decodeLine()
+{
+	uint64_t indent = 0;
+	uint64_t id = 0;
+	if (!readVarint(&indent) || !readVarint(&id)) {
+		return false;
+	}
+	if ((id >= _formatsSize) || (NULL == _formats[id])) {
+		_error = DECODE_ERROR_FORMAT;
+		return false;
+	}
+
+	for (uint64_t i = 0; i < indent; i++) {
+		if (!appendText(VERBOSE_INDENT_SPACER, strlen(VERBOSE_INDENT_SPACER))) {
+			return false;
+		}
+	}
+
+	const char *literal = _formats[id];
+	const char *start = NULL;
+	const char *end = NULL;
+	VerboseBinaryArgType argType = VERBOSE_BINARY_ARG_NONE;
+	while (VERBOSE_BINARY_ARG_NONE != (argType = MM_VerboseBinaryFormat::nextConversion(literal, &start, &end))) {
+		if (!appendLiteral(literal, start)) {
+			return false;
+		}
+
+		char conversion[VERBOSE_BINARY_DECODER_MAX_CONVERSION];
+		uintptr_t conversionLength = end - start;
+		if (conversionLength >= sizeof(conversion)) {
+			_error = DECODE_ERROR_FORMAT;
+			return false;
+		}
+		memcpy(conversion, start, conversionLength);
+		conversion[conversionLength] = '\0';
+
+		uint64_t value = 0;
+		bool success = true;
+		switch (argType) {
+		case VERBOSE_BINARY_ARG_INT:
+			success = readVarint(&value) && appendFormatted(conversion, (int)MM_VerboseBinaryFormat::zigzagDecode(value));
+			break;
+		case VERBOSE_BINARY_ARG_UINT:
+			success = readVarint(&value) && appendFormatted(conversion, (unsigned int)value);
+			break;
+		case VERBOSE_BINARY_ARG_LONG:
+			success = readVarint(&value) && appendFormatted(conversion, (long)MM_VerboseBinaryFormat::zigzagDecode(value));
+			break;
+		case VERBOSE_BINARY_ARG_ULONG:
+			success = readVarint(&value) && appendFormatted(conversion, (unsigned long)value);
+			break;
+		case VERBOSE_BINARY_ARG_LONGLONG:
+			success = readVarint(&value) && appendFormatted(conversion, (long long)MM_VerboseBinaryFormat::zigzagDecode(value));
+			break;
+		case VERBOSE_BINARY_ARG_ULONGLONG:
+			success = readVarint(&value) && appendFormatted(conversion, (unsigned long long)value);
+			break;
+		case VERBOSE_BINARY_ARG_SSIZE:
+			success = readVarint(&value) && appendFormatted(conversion, (intptr_t)MM_VerboseBinaryFormat::zigzagDecode(value));
+			break;
+		case VERBOSE_BINARY_ARG_SIZE:
+			success = readVarint(&value) && appendFormatted(conversion, (size_t)value);
+			break;
+		case VERBOSE_BINARY_ARG_POINTER:
+			success = readVarint(&value) && appendFormatted(conversion, (void *)(uintptr_t)value);
+			break;
+		case VERBOSE_BINARY_ARG_DOUBLE:
+		{
+			uint8_t bytes[sizeof(uint64_t)];
+			success = readBytes(bytes, sizeof(bytes));
+			if (success) {
+				for (uintptr_t byte = 0; byte < sizeof(bytes); byte++) {
+					value |= (uint64_t)bytes[byte] << (8 * byte);
+				}
+				double doubleValue = 0.0;
+				memcpy(&doubleValue, &value, sizeof(doubleValue));
+				success = appendFormatted(conversion, doubleValue);
+			}
+			break;
+		}
+		case VERBOSE_BINARY_ARG_STRING:
+		{
+			uintptr_t length = 0;
+			bool isNull = false;
+			success = readText(&length, true, &isNull) && appendFormatted(conversion, isNull ? NULL : _string);
+			break;
+		}
+		default:
+			/* the encoder does not define formats with conversions it can not encode */
+			_error = DECODE_ERROR_FORMAT;
+			success = false;
+			break;
+		}
+		if (!success) {
+			return false;
+		}
+		literal = end;
+	}
+
+	return appendLiteral(literal, literal + strlen(literal)) && appendText("\n", 1);
+}
+
+bool
+MM_VerboseBinaryDecoder::ensureCapacity(char **buffer, uintptr_t *capacity, uintptr_t size)
+{
+	if (size > *capacity) {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		uintptr_t newCapacity = OMR_MAX(size, 2 * *capacity);
+		char *newBuffer = (char *)omrmem_reallocate_memory(*buffer, newCapacity, OMRMEM_CATEGORY_MM);
+		if (NULL == newBuffer) {
+			_error = DECODE_ERROR_MEMORY;
+			return false;
+		}
+		*buffer = newBuffer;
+		*capacity = newCapacity;
+	}
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::appendText(const char *text, uintptr_t length)
+{
+	if (!ensureCapacity(&_output, &_outputCapacity, _outputSize + length + 1)) {
+		return false;
+	}
+	memcpy(_output + _outputSize, text, length);
+	_outputSize += length;
+	_output[_outputSize] = '\0';
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::appendLiteral(const char *text, const char *end)
+{
+	const char *cursor = text;
+	while (cursor < end) {
+		const char *percent = (const char *)memchr(cursor, '%', end - cursor);
+		if (NULL == percent) {
+			return appendText(cursor, end - cursor);
+		}
+		/* "%%" is the only conversion between two that consume arguments */
+		if (!appendText(cursor, percent - cursor + 1)) {
+			return false;
+		}
+		cursor = percent + 2;
+	}
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::appendFormatted(const char *conversion, ...)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	va_list args;
+	va_list sizeArgs;
+
+	va_start(args, conversion);
+	COPY_VA_LIST(sizeArgs, args);
+	uintptr_t size = omrstr_vprintf(NULL, 0, conversion, sizeArgs);
+	END_VA_LIST_COPY(sizeArgs);
+
+	bool result = ensureCapacity(&_output, &_outputCapacity, _outputSize + size);
+	if (result) {
+		_outputSize += omrstr_vprintf(_output + _outputSize, size, conversion, args);
+	}
+	va_end(args);
+	return result;
+}
+
+bool
+MM_VerboseBinaryDecoder::isBinaryFile(OMRPortLibrary *portLibrary, const char *filename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool result = false;
+
+	intptr_t fileDescriptor = omrfile_open(filename, EsOpenRead, 0);
+	if (-1 != fileDescriptor) {
+		char magic[VERBOSE_BINARY_MAGIC_LENGTH];
+		if (VERBOSE_BINARY_MAGIC_LENGTH == omrfile_read(fileDescriptor, magic, VERBOSE_BINARY_MAGIC_LENGTH)) {
+			result = (0 == memcmp(magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH));
+		}
+		omrfile_close(fileDescriptor);
+	}
+	return result;
+}
+
+const char *
+MM_VerboseBinaryDecoder::getResultDescription(DecodeResult result)
+{
+	switch (result) {
+	case DECODE_OK:
+		return "success";
+	case DECODE_STOPPED:
+		return "stopped";
+	case DECODE_ERROR_OPEN:
+		return "the file could not be opened";
+	case DECODE_ERROR_FORMAT:
+		return "the file is not a binary verbose file, or is corrupt";
+	case DECODE_ERROR_TRUNCATED:
+		return "the file is truncated";
+	case DECODE_ERROR_MEMORY:
+		return "out of memory";
+	default:
+		return "unknown error";
+	}
+}
+
+void
+MM_VerboseBinaryDecoder::tearDown()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	for (uintptr_t id = 0; id < _formatsSize; id++) {
+		omrmem_free_memory(_formats[id]);
+	}
+	omrmem_free_memory(_formats);
+	_formats = NULL;
+	_formatsSize = 0;
+	omrmem_free_memory(_input);
+	_input = NULL;
+	omrmem_free_memory(_output);
+	_output = NULL;
+	_outputCapacity = 0;
+	omrmem_free_memory(_string);
+	_string = NULL;
+	_stringCapacity = 0;
+}
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYDECODER_HPP_)
+#define VERBOSEBINARYDECODER_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * Receives the XML text decoded from a binary verbose file. The text passed to the callbacks, in order, is the
+ * XML log the file logging writers would have written.
+ */
+class MM_VerboseBinaryDecoderVisitor
+{
+public:
+	/**
+	 * Called with the XML header of the file.
+	 * @return true to continue decoding, false to stop
+	 */
+	virtual bool header(const char *text, uintptr_t length) { return true; }
+
+	/**
+	 * Called with the lines of each group of lines flushed together, e.g. a complete top-level element.
+	 * The text is NUL terminated, and is only valid until the callback returns.
+	 * @return true to continue decoding, false to stop
+	 */
+	virtual bool record(const char *text, uintptr_t length) = 0;
+
+	/**
+	 * Called with the XML footer of the file, if the file was closed.
+	 * @return true to continue decoding, false to stop
+	 */
+	virtual bool footer(const char *text, uintptr_t length) { return true; }
+};
+
+/**
+ * Streaming decoder for files written in the binary verbose format (see VerboseBinaryFormat.hpp).
+ *
+ * The file is read through a fixed size buffer and each record is handed to a visitor as soon as it is decoded,
+ * so the memory used depends only on the size of the largest record and the number of format strings, not on the
+ * size of the file. Lines are formatted by the port library, exactly as the text writers format them. The decoder
+ * needs only a port library, so it can be used by tools that do not start a VM.
+ */
+class MM_VerboseBinaryDecoder
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef enum DecodeResult {
+		DECODE_OK = 0, /**< the whole file was decoded */
+		DECODE_STOPPED, /**< the visitor asked to stop */
+		DECODE_ERROR_OPEN, /**< the file could not be opened or read */
+		DECODE_ERROR_FORMAT, /**< the file is not in the binary verbose format, or is corrupt */
+		DECODE_ERROR_TRUNCATED, /**< the file ends part way through a record */
+		DECODE_ERROR_MEMORY /**< memory could not be allocated */
+	} DecodeResult;
+
+protected:
+private:
+	OMRPortLibrary *_portLibrary;
+	intptr_t _fileDescriptor; /**< the file being decoded */
+	uint8_t *_input; /**< the read buffer */
+	uintptr_t _inputCursor; /**< index of the next byte to decode in _input */
+	uintptr_t _inputTop; /**< number of bytes read into _input */
+	char **_formats; /**< the format string for each format id defined so far, or NULL */
+	uintptr_t _formatsSize; /**< number of entries in _formats */
+	char *_output; /**< the text of the record being decoded */
+	uintptr_t _outputSize; /**< number of characters in _output, excluding the NUL */
+	uintptr_t _outputCapacity; /**< size of the _output allocation */
+	char *_string; /**< a string argument of the line being decoded */
+	uintptr_t _stringCapacity; /**< size of the _string allocation */
+	DecodeResult _error; /**< the reason the last helper to fail failed */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Decode a file, passing its text to a visitor.
+	 * @param filename[in] the file to decode
+	 * @param visitor[in] receives the decoded text
+	 * @return DECODE_OK if the file was decoded, or the reason it was not
+	 */
+	DecodeResult decode(const char *filename, MM_VerboseBinaryDecoderVisitor *visitor);
+
+	/**
+	 * @return true if the file starts with the magic bytes of the binary verbose format
+	 */
+	static bool isBinaryFile(OMRPortLibrary *portLibrary, const char *filename);
+
+	/**
+	 * @return a description of a DecodeResult, for messages
+	 */
+	static const char *getResultDescription(DecodeResult result);
+
+	/**
+	 * Free the memory held by the decoder.
+	 */
+	void tearDown();
+
+	MM_VerboseBinaryDecoder(OMRPortLibrary *portLibrary)
+		: _portLibrary(portLibrary)
+		, _fileDescriptor(-1)
+		, _input(NULL)
+		, _inputCursor(0)
+		, _inputTop(0)
+		, _formats(NULL)
+		, _formatsSize(0)
+		, _output(NULL)
+		, _outputSize(0)
+		, _outputCapacity(0)
+		, _string(NULL)
+		, _stringCapacity(0)
+		, _error(DECODE_OK)
+	{}
+
+protected:
+private:
+	DecodeResult decodeRecords(MM_VerboseBinaryDecoderVisitor *visitor);
+
+	/**
+	 * Read the next byte of the file.
+	 * @param value[out] the byte
+	 * @param endAllowed[in] true if the file may end before the byte, i.e. between records
+	 * @return true on success, false at the end of the file or on error
+	 */
+	bool readByte(uint8_t *value, bool endAllowed);
+	bool readVarint(uint64_t *value);
+	bool readBytes(void *buffer, uintptr_t length);
+
+	/**
+	 * Read the length and bytes of a text field into _string.
+	 * @param length[out] the length of the text, which is NUL terminated in _string
+	 * @param nullAllowed[in] true if the length is encoded plus one, with zero for a NULL string
+	 * @param isNull[out] set to true if the text is a NULL string
+	 */
+	bool readText(uintptr_t *length, bool nullAllowed, bool *isNull);
+
+	bool defineFormat(uint64_t id, const char *text, uintptr_t length);
+	bool decodeLine();
+
+	bool ensureCapacity(char **buffer, uintptr_t *capacity, uintptr_t size);
+	bool appendText(const char *text, uintptr_t length);
+
+	/**
+	 * Append the literal text of a format string between two conversions, where "%%" is a '%'.
+	 */
+	bool appendLiteral(const char *text, const char *end);
+
+	/**
+	 * Format a single conversion with the port library and append the result.
+	 */
+	bool appendFormatted(const char *conversion, ...);
+};
+
+#endif /* VERBOSEBINARYDECODER_HPP_ */
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include <string.h>
+
+/*
+ * Binary verbose GC format (-Xgc:verboseBinaryFormat).
+ *
+ * Rather than formatting each line of verbose output, the line is recorded as the format string it was
+ * formatted from and the raw values of its arguments. Each format string is written once, the first time it
+ * is used, so a line is usually a few bytes. Decoding formats the lines exactly as the XML writers would have,
+ * so the decoded log is the XML log.
+ *
+ * A file is the magic bytes and format version, followed by tagged records. Numbers are unsigned LEB128
+ * varints; signed integer arguments are zigzag encoded first.
+ *
+ *   HEADER     text length, text            the XML header, written when the file is opened
+ *   DEFINE     id, format length, format    the format string for a format id
+ *   LINE       indent, format id, arguments a line of output
+ *   RAW        text length, text            output that was already formatted, written as is
+ *   END_RECORD                              the end of a group of lines flushed together
+ *   FOOTER     text length, text            the XML footer (without its newline), written when the file is closed
+ *
+ * Each argument is encoded by the conversion that consumes it: integers and pointers as varints, doubles as
+ * their 8 byte IEEE representation (least significant byte first), and strings as a varint of their length
+ * plus one (zero for NULL) followed by their bytes. Every file repeats the definitions of the formats used
+ * before it was opened, so a rotated file can be decoded on its own.
+ */
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_MAGIC_LENGTH 7
+#define VERBOSE_BINARY_VERSION 1
+
+/* the text written before a line for each level of indent */
+#define VERBOSE_INDENT_SPACER "  "
+
+/* the largest encoded size of a 64-bit varint */
+#define VERBOSE_BINARY_MAX_VARINT_SIZE 10
+
+typedef enum {
+	VERBOSE_BINARY_RECORD_HEADER = 1,
+	VERBOSE_BINARY_RECORD_DEFINE = 2,
+	VERBOSE_BINARY_RECORD_LINE = 3,
+	VERBOSE_BINARY_RECORD_RAW = 4,
+	VERBOSE_BINARY_RECORD_END_RECORD = 5,
+	VERBOSE_BINARY_RECORD_FOOTER = 6
+} VerboseBinaryRecordType;
+
+/**
+ * The type of the argument consumed by a printf conversion.
+ */
+typedef enum {
+	VERBOSE_BINARY_ARG_NONE = 0, /**< no further conversions in the format */
+	VERBOSE_BINARY_ARG_INT, /**< int, or a signed conversion of char or short */
+	VERBOSE_BINARY_ARG_UINT, /**< unsigned int, or an unsigned conversion of char or short */
+	VERBOSE_BINARY_ARG_LONG, /**< long */
+	VERBOSE_BINARY_ARG_ULONG, /**< unsigned long */
+	VERBOSE_BINARY_ARG_LONGLONG, /**< long long, or intmax_t */
+	VERBOSE_BINARY_ARG_ULONGLONG, /**< unsigned long long, or uintmax_t */
+	VERBOSE_BINARY_ARG_SSIZE, /**< a signed conversion of size_t or ptrdiff_t */
+	VERBOSE_BINARY_ARG_SIZE, /**< size_t or ptrdiff_t */
+	VERBOSE_BINARY_ARG_POINTER, /**< void * */
+	VERBOSE_BINARY_ARG_DOUBLE, /**< double */
+	VERBOSE_BINARY_ARG_STRING, /**< char * */
+	VERBOSE_BINARY_ARG_UNSUPPORTED /**< a conversion that can not be encoded (e.g. a '*' width) */
+} VerboseBinaryArgType;
+
+/**
+ * Helpers shared by the encoder (MM_VerboseBinaryBuffer) and the decoder (MM_VerboseBinaryDecoder).
+ */
+class MM_VerboseBinaryFormat
+{
+public:
+	/**
+	 * Find the next conversion in a format string that consumes an argument. "%%" is literal text.
+	 * @param[in] format the format string, from the end of the previous conversion
+	 * @param[out] start the '%' of the conversion found
+	 * @param[out] end the character after the conversion found
+	 * @return the type of the argument the conversion consumes, or VERBOSE_BINARY_ARG_NONE if there are no more
+	 */
+	static VerboseBinaryArgType
+	nextConversion(const char *format, const char **start, const char **end)
+	{
+		const char *cursor = format;
+		while ('\0' != *cursor) {
+			if ('%' != *cursor) {
+				cursor += 1;
+				continue;
+			}
+			if ('%' == cursor[1]) {
+				cursor += 2;
+				continue;
+			}
+
+			*start = cursor;
+			cursor += 1;
+			while ((NULL != strchr("-+ #0", *cursor)) && ('\0' != *cursor)) {
+				cursor += 1;
+			}
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				cursor += 1;
+			}
+			if ('.' == *cursor) {
+				cursor += 1;
+				while (('0' <= *cursor) && ('9' >= *cursor)) {
+					cursor += 1;
+				}
+			}
+
+			uintptr_t longs = 0;
+			bool size = false;
+			bool unsupported = false;
+			switch (*cursor) {
+			case 'h':
+				cursor += ('h' == cursor[1]) ? 2 : 1;
+				break;
+			case 'l':
+				longs = ('l' == cursor[1]) ? 2 : 1;
+				cursor += longs;
+				break;
+			case 'j':
+				longs = 2;
+				cursor += 1;
+				break;
+			case 'z':
+			case 't':
+				size = true;
+				cursor += 1;
+				break;
+			case '*':
+			case 'L':
+				unsupported = true;
+				break;
+			default:
+				break;
+			}
+
+			VerboseBinaryArgType type = VERBOSE_BINARY_ARG_UNSUPPORTED;
+			if (!unsupported) {
+				switch (*cursor) {
+				case 'd':
+				case 'i':
+				case 'c':
+					type = size ? VERBOSE_BINARY_ARG_SSIZE : (2 == longs) ? VERBOSE_BINARY_ARG_LONGLONG : (1 == longs) ? VERBOSE_BINARY_ARG_LONG : VERBOSE_BINARY_ARG_INT;
+					break;
+				case 'u':
+				case 'x':
+				case 'X':
+				case 'o':
+					type = size ? VERBOSE_BINARY_ARG_SIZE : (2 == longs) ? VERBOSE_BINARY_ARG_ULONGLONG : (1 == longs) ? VERBOSE_BINARY_ARG_ULONG : VERBOSE_BINARY_ARG_UINT;
+					break;
+				case 'p':
+					type = VERBOSE_BINARY_ARG_POINTER;
+					break;
+				case 's':
+					type = (0 == longs) ? VERBOSE_BINARY_ARG_STRING : VERBOSE_BINARY_ARG_UNSUPPORTED;
+					break;
+				case 'f':
+				case 'F':
+				case 'e':
+				case 'E':
+				case 'g':
+				case 'G':
+					type = VERBOSE_BINARY_ARG_DOUBLE;
+					break;
+				default:
+					break;
+				}
+			}
+			if ('\0' != *cursor) {
+				cursor += 1;
+			}
+			*end = cursor;
+			return type;
+		}
+		*start = cursor;
+		*end = cursor;
+		return VERBOSE_BINARY_ARG_NONE;
+	}
+
+	/**
+	 * Encode an unsigned varint.
+	 * @param[in] cursor where to write, with room for VERBOSE_BINARY_MAX_VARINT_SIZE bytes
+	 * @param[in] value the value to encode
+	 * @return the byte after the encoded value
+	 */
+	static MMINLINE uint8_t *
+	encodeVarint(uint8_t *cursor, uint64_t value)
+	{
+		while (value >= 0x80) {
+			*cursor++ = (uint8_t)(value | 0x80);
+			value >>= 7;
+		}
+		*cursor++ = (uint8_t)value;
+		return cursor;
+	}
+
+	static MMINLINE uint64_t zigzagEncode(int64_t value) { return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63); }
+	static MMINLINE int64_t zigzagDecode(uint64_t value) { return (int64_t)(value >> 1) ^ -(int64_t)(value & 1); }
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
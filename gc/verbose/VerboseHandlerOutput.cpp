@@ -696,6 +696,71 @@ MM_VerboseHandlerOutput::outputMemoryInfo(MM_EnvironmentBase *env, uintptr_t ind
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutput::outputThreadUse(MM_EnvironmentBase *env, uintptr_t indent, uint64_t startTime)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+	for (uintptr_t type = 0; type < GC_THREADS_TASK_TYPE_COUNT; type++) {
+		MM_TaskThreadUse *use = _extensions->threadUseStats.getTaskThreadUse((MM_GCThreadTaskType)type);
+		if ((0 != use->_endTime) && (use->_endTime >= startTime)) {
+			writer->formatAndOutput(env, indent, "<gc-threads task=\"%s\" threads=\"%zu\" maximum=\"%zu\" elapsedms=\"%llu.%03llu\" idlems=\"%llu.%03llu\" />",
+					MM_ThreadUseStats::getTypeName((MM_GCThreadTaskType)type),
+					use->_threadCount, use->_threadCountMaximum,
+					use->_elapsedMicros / 1000, use->_elapsedMicros % 1000,
+					use->_idleMicros / 1000, use->_idleMicros % 1000);
+		}
+	}
+}
+
+void
+MM_VerboseHandlerOutput::outputPauseHistogramBuckets(MM_EnvironmentBase *env, uintptr_t indent, MM_PauseHistogram *histogram)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+	for (uintptr_t bucket = 0; bucket < PAUSE_HISTOGRAM_BUCKETS; bucket++) {
+		if (0 != histogram->_counts[bucket]) {
+			uint64_t limitMicros = MM_PauseHistogram::getBucketLimit(bucket);
+			writer->formatAndOutput(env, indent, "<pause-bucket limitms=\"%llu.%03llu\" count=\"%zu\" />",
+					limitMicros / 1000, limitMicros % 1000, histogram->_counts[bucket]);
+		}
+	}
+}
+
+void
+MM_VerboseHandlerOutput::outputLatencyHistograms(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<latency-histograms>");
+	for (uintptr_t type = 0; type < GC_LATENCY_TYPE_COUNT; type++) {
+		MM_PauseHistogram *histogram = _extensions->getLatencyHistogram((MM_GCLatencyType)type);
+		if (0 == histogram->_pauseCount) {
+			continue;
+		}
+		uint64_t meanMicros = histogram->getMeanMicros();
+		uint64_t maximumMicros = histogram->_maximumMicros;
+		uint64_t p50Micros = histogram->getPercentileMicros(50.0);
+		uint64_t p90Micros = histogram->getPercentileMicros(90.0);
+		uint64_t p99Micros = histogram->getPercentileMicros(99.0);
+		uint64_t p999Micros = histogram->getPercentileMicros(99.9);
+		writer->formatAndOutput(env, 1, "<latency-histogram type=\"%s\" count=\"%zu\" meanms=\"%llu.%03llu\" maxms=\"%llu.%03llu\" p50ms=\"%llu.%03llu\" p90ms=\"%llu.%03llu\" p99ms=\"%llu.%03llu\" p999ms=\"%llu.%03llu\">",
+				MM_LatencyStats::getTypeName((MM_GCLatencyType)type), histogram->_pauseCount,
+				meanMicros / 1000, meanMicros % 1000,
+				maximumMicros / 1000, maximumMicros % 1000,
+				p50Micros / 1000, p50Micros % 1000,
+				p90Micros / 1000, p90Micros % 1000,
+				p99Micros / 1000, p99Micros % 1000,
+				p999Micros / 1000, p999Micros % 1000);
+		outputPauseHistogramBuckets(env, 2, histogram);
+		writer->formatAndOutput(env, 1, "</latency-histogram>");
+	}
+	writer->formatAndOutput(env, 0, "</latency-histograms>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 bool
 MM_VerboseHandlerOutput::hasOutputMemoryInfoInnerStanza()
 {
@@ -727,6 +792,11 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		writer->formatAndOutput(env, 1, "<tlh-stats refreshes=\"%zu\" reused=\"%zu\" requestedBytes=\"%zu\" maxRefreshSize=\"%zu\" discardedBytes=\"%zu\" wastedBytes=\"%zu\" />",
+				systemStats->_tlhRefreshCountFresh, systemStats->_tlhRefreshCountReused, systemStats->_tlhRequestedBytes,
+				systemStats->_tlhMaxRefreshSize, systemStats->_tlhDiscardedBytes, systemStats->_tlhWastedBytes);
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -807,6 +877,7 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	outputThreadUse(env, _manager->getIndentLevel() + 1, stats->_startTime);
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
@@ -29,6 +29,7 @@
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
+class MM_PauseHistogram;
 class MM_VerboseManager;
 
 class MM_VerboseHandlerOutput : public MM_Base
@@ -190,6 +191,22 @@ protected:
 
 	virtual bool hasOutputMemoryInfoInnerStanza();
 
+	/**
+	 * Output the threads each parallel task ran on during an increment, and how long they were idle.
+	 * @param env GC thread used for output.
+	 * @param indent level of indentation for the tasks.
+	 * @param startTime hi-res time the increment started; tasks that completed earlier are not output.
+	 */
+	void outputThreadUse(MM_EnvironmentBase *env, uintptr_t indent, uint64_t startTime);
+
+	/**
+	 * Output the non-empty buckets of a pause time histogram.
+	 * @param env GC thread used for output.
+	 * @param indent level of indentation for the buckets.
+	 * @param histogram the histogram to output.
+	 */
+	void outputPauseHistogramBuckets(MM_EnvironmentBase *env, uintptr_t indent, MM_PauseHistogram *histogram);
+
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
 	/**
@@ -249,6 +266,13 @@ public:
 	 */
 	virtual void disableVerbose();
 
+	/**
+	 * Write a stand-alone stanza with the distribution and percentiles of each pause and phase time recorded
+	 * over the life of the process (see MM_LatencyStats). Called when the verbose streams are closed at shutdown.
+	 * @param env GC thread used for output.
+	 */
+	void outputLatencyHistograms(MM_EnvironmentBase *env);
+
 	/**
 	 *  Get the VerboseManager used to format and print output
 	 *  
@@ -30,6 +30,8 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -129,6 +131,10 @@ MM_VerboseManager::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 void
 MM_VerboseManager::closeStreams(MM_EnvironmentBase *env)
 {
+	if (_hooksAttached) {
+		_verboseHandlerOutput->outputLatencyHistograms(env);
+	}
+
 	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
 	while(NULL != writer) {
 		writer->closeStream(env);
@@ -231,6 +237,17 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	/* There is no asynchronous binary writer. The startup options reject verboseBinaryFormat
+	 * together with asyncLogging, so binary output never silently replaces an async request.
+	 */
+	if (extensions->verboseBinaryFormat) {
+		return VERBOSE_WRITER_FILE_LOGGING_BINARY;
+	}
+
+	if (extensions->asyncLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -311,6 +328,30 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
+	case VERBOSE_WRITER_FILE_LOGGING_BINARY:
+		writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
@@ -31,7 +31,9 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 7
 } WriterType;
 
 /**
@@ -65,6 +67,12 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Output lines encoded in the binary verbose format (see VerboseBinaryFormat.hpp).
+	 * Called instead of outputString() on writers for which isBinary() is true.
+	 */
+	virtual void outputBinary(MM_EnvironmentBase *env, const uint8_t *data, uintptr_t length) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -73,6 +81,8 @@ public:
 
 	MMINLINE WriterType getType(void) { return _type; }
 
+	MMINLINE bool isBinary(void) { return VERBOSE_WRITER_FILE_LOGGING_BINARY == _type; }
+
 	MMINLINE bool isActive(void) { return _isActive; }
 	MMINLINE void isActive(bool isActive) { _isActive = isActive; }
 
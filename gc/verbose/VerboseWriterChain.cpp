@@ -18,6 +18,8 @@
 
 #include "VerboseWriterChain.hpp"
 
+#include "VerboseBinaryBuffer.hpp"
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseBuffer.hpp"
 #include "VerboseWriter.hpp"
 
@@ -28,12 +30,13 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_j9vgc.h"
 
-#define INDENT_SPACER "  "
-
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
+	,_binaryBuffer(NULL)
 	,_writers(NULL)
+	,_hasTextWriters(false)
+	,_hasBinaryWriters(false)
 {}
 
 MM_VerboseWriterChain *
@@ -58,12 +61,22 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
-	for (uintptr_t i = 0; i < indent; ++i) {
-		_buffer->add(env, INDENT_SPACER);
+	if (_hasBinaryWriters) {
+		/* the binary writers are given the arguments rather than the formatted line */
+		va_list binaryArgs;
+		COPY_VA_LIST(binaryArgs, args);
+		_binaryBuffer->addLine(env, indent, format, binaryArgs);
+		END_VA_LIST_COPY(binaryArgs);
+	}
+
+	if (_hasTextWriters || !_hasBinaryWriters) {
+		for (uintptr_t i = 0; i < indent; ++i) {
+			_buffer->add(env, VERBOSE_INDENT_SPACER);
+		}
+
+		_buffer->vprintf(env, format, args);
+		_buffer->add(env, "\n");
 	}
-	
-	_buffer->vprintf(env, format, args);
-	_buffer->add(env, "\n");
 }
 
 void
@@ -79,12 +92,23 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
+	if (_hasBinaryWriters) {
+		_binaryBuffer->endRecord(env);
+	}
+
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->isBinary()) {
+			writer->outputBinary(env, _binaryBuffer->contents(), _binaryBuffer->currentSize());
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	if (NULL != _binaryBuffer) {
+		_binaryBuffer->reset();
+	}
 }
 
 void
@@ -101,6 +125,11 @@ MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 		writer = nextWriter;
 	}
 	_writers = NULL;
+	/* the binary writers use the definitions in the binary buffer until they are killed */
+	if (NULL != _binaryBuffer) {
+		_binaryBuffer->kill(env);
+		_binaryBuffer = NULL;
+	}
 }
 
 void
@@ -118,6 +147,13 @@ MM_VerboseWriterChain::initialize(MM_EnvironmentBase* env)
 	if(NULL == _buffer) {
 		result = false;
 	}
+
+	if (result && env->getExtensions()->verboseBinaryFormat) {
+		_binaryBuffer = MM_VerboseBinaryBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL == _binaryBuffer) {
+			result = false;
+		}
+	}
 	
 	return result;
 }
@@ -127,6 +163,11 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	if (writer->isBinary()) {
+		_hasBinaryWriters = true;
+	} else {
+		_hasTextWriters = true;
+	}
 }
 
 void
@@ -27,6 +27,7 @@
 
 #include "EnvironmentBase.hpp"
 
+class MM_VerboseBinaryBuffer;
 class MM_VerboseBuffer;
 class MM_VerboseWriter;
 
@@ -40,7 +41,10 @@ public:
 protected:
 private:
 	MM_VerboseBuffer *_buffer;
+	MM_VerboseBinaryBuffer *_binaryBuffer; /**< lines encoded for the binary writers, if -Xgc:verboseBinaryFormat */
 	MM_VerboseWriter *_writers;
+	bool _hasTextWriters; /**< true if any writer in the chain takes formatted output */
+	bool _hasBinaryWriters; /**< true if any writer in the chain takes binary output */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
@@ -63,6 +67,12 @@ public:
 	 */
 	MM_VerboseWriter *getFirstWriter() { return _writers; }
 
+	/**
+	 * Fetch the buffer of lines encoded for the binary writers.
+	 * @return the binary buffer, or NULL if the binary format is not enabled
+	 */
+	MM_VerboseBinaryBuffer *getBinaryBuffer() { return _binaryBuffer; }
+
 	/**
 	 * Notify each of the writers in the chain that a GC cycle has ended
 	 * @param env[in] the current thread 
@@ -0,0 +1,455 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+/* Output constants */
+#define VERBOSEGC_DROPPED_RECORDS "<warning details=\"verbose records dropped, asynchronous log buffers full\" count=\"%zu\" />\n\n"
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_drainMonitor(NULL)
+	,_drainThreadState(STATE_ERROR)
+	,_slots(NULL)
+	,_slotCount(0)
+	,_publishIndex(0)
+	,_drainIndex(0)
+	,_slotOpen(false)
+	,_stallWhenFull(false)
+	,_unreportedDrops(0)
+	,_unpublishedCycles(0)
+	,_droppedRecords(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * Allocates the ring of buffers and starts the drain thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	_stallWhenFull = extensions->asyncLoggingStallWhenFull;
+	_slotCount = extensions->asyncLoggingBufferCount;
+	_slots = (RingSlot *)extensions->getForge()->allocate(sizeof(RingSlot) * _slotCount, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _slots) {
+		return false;
+	}
+	memset(_slots, 0, sizeof(RingSlot) * _slotCount);
+	for (uintptr_t index = 0; index < _slotCount; index++) {
+		_slots[index].buffer = MM_VerboseBuffer::newInstance(env, extensions->asyncLoggingBufferSize);
+		if (NULL == _slots[index].buffer) {
+			return false;
+		}
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_drainMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_drainMonitor")) {
+		_drainMonitor = NULL;
+		return false;
+	}
+
+	return startDrainThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the drain thread and frees the ring of buffers.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _drainMonitor) {
+		stopDrainThread(env);
+		omrthread_monitor_destroy(_drainMonitor);
+		_drainMonitor = NULL;
+	}
+
+	if (NULL != _slots) {
+		for (uintptr_t index = 0; index < _slotCount; index++) {
+			if (NULL != _slots[index].buffer) {
+				_slots[index].buffer->kill(env);
+			}
+		}
+		extensions->getForge()->free(_slots);
+		_slots = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, string, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeDroppedRecords(MM_EnvironmentBase *env, uintptr_t droppedRecords)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	char warning[128];
+
+	uintptr_t length = omrstr_printf(warning, sizeof(warning), VERBOSEGC_DROPPED_RECORDS, droppedRecords);
+	writeString(env, warning, length);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	RingSlot *slot = claimSlot(env);
+
+	if ((NULL != slot) && (0 != slot->buffer->currentSize()) && (length >= slot->buffer->freeSpace())) {
+		/* hand over the full buffer rather than grow it */
+		publishSlot(env);
+		slot = claimSlot(env);
+	}
+
+	if ((NULL == slot) || !slot->buffer->add(env, string)) {
+		_unreportedDrops += 1;
+		_droppedRecords += 1;
+	}
+}
+
+/**
+ * Hands the records of the cycle to the drain thread, which cycles the output files if necessary
+ * once it has written them.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	RingSlot *slot = claimSlot(env);
+	if (NULL == slot) {
+		_unpublishedCycles += 1;
+	} else {
+		slot->endsCycle = true;
+		publishSlot(env);
+	}
+}
+
+/**
+ * Closes the agent's output stream, once every record has been written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	waitForDrain(env);
+	if (0 != _unreportedDrops) {
+		writeDroppedRecords(env, _unreportedDrops);
+		_unreportedDrops = 0;
+	}
+	_unpublishedCycles = 0;
+	closeFile(env);
+}
+
+/**
+ * Reconfigures the agent according to the parameters passed, once every record has been written.
+ * The ring and the drain thread are kept.
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	waitForDrain(env);
+	_unreportedDrops = 0;
+	_unpublishedCycles = 0;
+	closeFile(env);
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+MM_VerboseWriterFileLoggingAsynchronous::RingSlot *
+MM_VerboseWriterFileLoggingAsynchronous::claimSlot(MM_EnvironmentBase *env)
+{
+	if (!_slotOpen) {
+		if ((_publishIndex - _drainIndex) >= _slotCount) {
+			if (!_stallWhenFull) {
+				return NULL;
+			}
+			omrthread_monitor_enter(_drainMonitor);
+			while ((_publishIndex - _drainIndex) >= _slotCount) {
+				omrthread_monitor_notify_all(_drainMonitor);
+				omrthread_monitor_wait(_drainMonitor);
+			}
+			omrthread_monitor_exit(_drainMonitor);
+		}
+		/* do not touch the slot until the drain thread is seen to be done with it */
+		MM_AtomicOperations::readBarrier();
+
+		RingSlot *slot = &_slots[_publishIndex % _slotCount];
+		slot->droppedRecords = _unreportedDrops;
+		slot->cyclesEndedBefore = _unpublishedCycles;
+		slot->endsCycle = false;
+		_unreportedDrops = 0;
+		_unpublishedCycles = 0;
+		_slotOpen = true;
+	}
+	return &_slots[_publishIndex % _slotCount];
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::publishSlot(MM_EnvironmentBase *env)
+{
+	if (_slotOpen) {
+		/* the contents of the slot must be visible before the slot is */
+		MM_AtomicOperations::writeBarrier();
+		_publishIndex += 1;
+		_slotOpen = false;
+
+		/* never block the producer to wake the drain thread; it polls if the notification is missed */
+		if (0 == omrthread_monitor_try_enter(_drainMonitor)) {
+			omrthread_monitor_notify_all(_drainMonitor);
+			omrthread_monitor_exit(_drainMonitor);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::waitForDrain(MM_EnvironmentBase *env)
+{
+	publishSlot(env);
+
+	omrthread_monitor_enter(_drainMonitor);
+	while ((_drainIndex != _publishIndex) || (STATE_DRAINING == _drainThreadState)) {
+		omrthread_monitor_notify_all(_drainMonitor);
+		omrthread_monitor_wait(_drainMonitor);
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainSlots(MM_EnvironmentBase *env)
+{
+	while (_drainIndex != _publishIndex) {
+		/* do not read the slot until it is seen to be published */
+		MM_AtomicOperations::readBarrier();
+
+		RingSlot *slot = &_slots[_drainIndex % _slotCount];
+		if (0 != slot->droppedRecords) {
+			writeDroppedRecords(env, slot->droppedRecords);
+		}
+		for (uintptr_t cycle = 0; cycle < slot->cyclesEndedBefore; cycle++) {
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+		if (0 != slot->buffer->currentSize()) {
+			writeString(env, slot->buffer->contents(), slot->buffer->currentSize());
+		}
+		if (slot->endsCycle) {
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+		slot->buffer->reset();
+
+		/* the slot must be released only once it has been written */
+		MM_AtomicOperations::writeBarrier();
+		_drainIndex += 1;
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::drain_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->drainThreadEntryPoint();
+	return 0;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startDrainThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		drain_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _drainThreadState) {
+			omrthread_monitor_wait(_drainMonitor);
+		}
+		success = (STATE_ERROR != _drainThreadState);
+	} else {
+		_drainThreadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_drainMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopDrainThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	if (STATE_ERROR != _drainThreadState) {
+		while (STATE_TERMINATED != _drainThreadState) {
+			if (STATE_DRAINING != _drainThreadState) {
+				_drainThreadState = STATE_TERMINATION_REQUESTED;
+			}
+			omrthread_monitor_notify_all(_drainMonitor);
+			omrthread_monitor_wait(_drainMonitor);
+		}
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_WAITING;
+	omrthread_monitor_notify_all(_drainMonitor);
+	while (STATE_TERMINATION_REQUESTED != _drainThreadState) {
+		if (_drainIndex != _publishIndex) {
+			_drainThreadState = STATE_DRAINING;
+			omrthread_monitor_exit(_drainMonitor);
+			drainSlots(&env);
+			omrthread_monitor_enter(_drainMonitor);
+			_drainThreadState = STATE_WAITING;
+			/* wake a producer waiting for a free slot, or a thread waiting for the ring to drain */
+			omrthread_monitor_notify_all(_drainMonitor);
+		} else {
+			/* the producer does not block to notify us, so poll in case a notification was missed */
+			omrthread_monitor_wait_timed(_drainMonitor, 100, 0);
+		}
+	}
+
+	/* notify the other side that we are done so that they can continue running */
+	_drainThreadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_monitor_exit(_drainMonitor);
+}
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Output agent which directs verbosegc output to file from a dedicated low priority thread (-Xgc:asyncLogging).
+ *
+ * Records are appended to a ring of verbose buffers and a buffer is handed to the drain thread when it is full
+ * or at the end of a cycle, so the thread producing the output never waits on the file system. The ring has a
+ * single producer (the writer chain serializes output) and a single consumer (the drain thread), and is indexed
+ * by two counters that only ever increase, so neither side takes a lock to hand over a buffer.
+ *
+ * When every buffer is waiting to be written, a record is either dropped and counted, or, with
+ * -Xgc:asyncLoggingStallWhenFull, the producer waits for the drain thread to free a buffer. The number of records
+ * dropped since the last one written is reported as a warning in the log, ahead of the records that follow them.
+ * File rotation at the end of a cycle is done by the drain thread once it has written the records of the cycle.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum DrainThreadState
+	{
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_DRAINING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} DrainThreadState;
+
+	/**
+	 * An entry in the ring. Owned by the producer until published, then by the drain thread until drained.
+	 */
+	struct RingSlot {
+		MM_VerboseBuffer *buffer; /**< records to write */
+		uintptr_t droppedRecords; /**< records dropped between the previous published slot and this one */
+		uintptr_t cyclesEndedBefore; /**< cycles that ended while the ring was full, before the records in this slot */
+		bool endsCycle; /**< true if the slot was published at the end of a cycle */
+	};
+
+	OMR_VM *_omrVM; /**< the VM, for the environment of the drain thread */
+	intptr_t _logFileDescriptor; /**< the file being written to, only used by the drain thread while it is running */
+	omrthread_monitor_t _drainMonitor; /**< protects _drainThreadState, and is used to wait for the ring to drain */
+	volatile DrainThreadState _drainThreadState; /**< the state of the drain thread */
+	RingSlot *_slots; /**< the ring */
+	uintptr_t _slotCount; /**< number of entries in _slots */
+	volatile uintptr_t _publishIndex; /**< count of slots published by the producer; the producer fills slot (_publishIndex % _slotCount) */
+	volatile uintptr_t _drainIndex; /**< count of slots written by the drain thread */
+	bool _slotOpen; /**< true if the producer has claimed the slot at _publishIndex and not yet published it */
+	bool _stallWhenFull; /**< if true, wait for the drain thread when the ring is full rather than drop records */
+	uintptr_t _unreportedDrops; /**< records dropped since the last slot was claimed (producer only) */
+	uintptr_t _unpublishedCycles; /**< cycles that ended while the ring was full (producer only) */
+	volatile uintptr_t _droppedRecords; /**< total number of records dropped */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * @return the number of records dropped because the ring was full
+	 */
+	MMINLINE uintptr_t getDroppedRecordCount() { return _droppedRecords; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Write a string to the log file, opening it if necessary.
+	 */
+	void writeString(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+
+	/**
+	 * Write a warning giving the number of records dropped at this point in the log.
+	 */
+	void writeDroppedRecords(MM_EnvironmentBase *env, uintptr_t droppedRecords);
+
+	/**
+	 * Claim the next slot for the producer to fill, waiting for one to be drained if the ring is full and
+	 * _stallWhenFull is set.
+	 * @return the claimed slot, or NULL if the ring is full
+	 */
+	RingSlot *claimSlot(MM_EnvironmentBase *env);
+
+	/**
+	 * Hand the claimed slot, if any, to the drain thread.
+	 */
+	void publishSlot(MM_EnvironmentBase *env);
+
+	/**
+	 * Publish the claimed slot and wait until the drain thread has written every published slot and is idle,
+	 * after which the caller may use the log file.
+	 */
+	void waitForDrain(MM_EnvironmentBase *env);
+
+	/**
+	 * Write and release every published slot. Called by the drain thread.
+	 */
+	void drainSlots(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the drain thread, waiting until it reports success.
+	 * @return true on success, false on failure
+	 */
+	bool startDrainThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Shut down the drain thread, waiting until it exits.
+	 */
+	void stopDrainThread(MM_EnvironmentBase *env);
+
+	/**
+	 * This is the method called by the forked thread. It returns when the thread is asked to terminate.
+	 */
+	void drainThreadEntryPoint();
+
+	/**
+	 * This is a helper function, used as a parameter to omrthread_create
+	 */
+	static int J9THREAD_PROC drain_thread_proc(void *info);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "VerboseBinaryBuffer.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+
+#include <string.h>
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_logFileStream(NULL)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and writes the file header, the XML header, and the definitions of the
+ * formats encoded so far.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	uint8_t formatVersion = VERBOSE_BINARY_VERSION;
+	omrfilestream_write(_logFileStream, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH);
+	omrfilestream_write(_logFileStream, &formatVersion, sizeof(formatVersion));
+
+	uintptr_t headerSize = omrstr_printf(NULL, 0, getHeader(env), version);
+	char *header = (char *)extensions->getForge()->allocate(headerSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != header) {
+		omrstr_printf(header, headerSize, getHeader(env), version);
+		writeTextRecord(env, VERBOSE_BINARY_RECORD_HEADER, header, strlen(header));
+		extensions->getForge()->free(header);
+	}
+
+	/* a rotated file must be readable on its own, so repeat the formats defined in earlier files */
+	MM_VerboseBinaryBuffer *binaryBuffer = _manager->getWriterChain()->getBinaryBuffer();
+	omrfilestream_write(_logFileStream, binaryBuffer->definitions(), binaryBuffer->definitionsSize());
+
+	return true;
+}
+
+/**
+ * Writes the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		writeTextRecord(env, VERBOSE_BINARY_RECORD_FOOTER, getFooter(env), strlen(getFooter(env)));
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeTextRecord(MM_EnvironmentBase *env, VerboseBinaryRecordType type, const char *text, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	uint8_t prefix[1 + VERBOSE_BINARY_MAX_VARINT_SIZE];
+	prefix[0] = (uint8_t)type;
+	uint8_t *cursor = MM_VerboseBinaryFormat::encodeVarint(prefix + 1, length);
+	omrfilestream_write(_logFileStream, prefix, cursor - prefix);
+	omrfilestream_write(_logFileStream, text, length);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL == _logFileStream) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if(NULL != _logFileStream){
+		writeTextRecord(env, VERBOSE_BINARY_RECORD_RAW, string, strlen(string));
+	} else {
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, strlen(string), J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputBinary(MM_EnvironmentBase *env, const uint8_t *data, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL == _logFileStream) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if(NULL != _logFileStream){
+		omrfilestream_write(_logFileStream, data, length);
+	}
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file in the binary verbose format (-Xgc:verboseBinaryFormat).
+ * See VerboseBinaryFormat.hpp for the layout of the file.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	OMRFileStream *_logFileStream; /**< the filestream being written to */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void outputBinary(MM_EnvironmentBase *env, const uint8_t *data, uintptr_t length);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Write a record made up of a tag and the length and bytes of some text.
+	 */
+	void writeTextRecord(MM_EnvironmentBase *env, VerboseBinaryRecordType type, const char *text, uintptr_t length);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -28,6 +28,10 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseBuffer.hpp"
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentCardTable.hpp"
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
 static void verboseHandlerGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
@@ -278,12 +282,35 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	MM_MarkStats *markStats = &extensions->globalGCStats.markStats;
 	uint64_t duration = 0;
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, markStats->_startTime, markStats->_endTime);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	/* summed over all GC threads */
+	uint64_t clearMicros = omrtime_hires_delta(0, markStats->getMarkMapClearTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "mark", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (extensions->backgroundMarkMapClear) {
+		writer->formatAndOutput(env, 1, "<markmap-clear timems=\"%llu.%03llu\" />", clearMicros / 1000, clearMicros % 1000);
+	}
+
+	if (extensions->workStealingPackets) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<packet-steal attempts=\"%zu\" stolen=\"%zu\" />",
+				workPacketStats->workPacketStealAttempts, workPacketStats->workPacketsStolen);
+	}
+
+	if (extensions->numaAwarePacketLists) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		uintptr_t nodeCount = OMR_MIN(extensions->_numaManager.getAffinityLeaderCount(), OMR_WORKPACKET_NUMA_NODE_BINS);
+		if (1 < nodeCount) {
+			for (uintptr_t node = 0; node < nodeCount; node++) {
+				writer->formatAndOutput(env, 1, "<packet-numa node=\"%zu\" pushes=\"%zu\" pops=\"%zu\" crossnodepops=\"%zu\" />",
+						node, workPacketStats->numaNodePushCount[node], workPacketStats->numaNodePopCount[node], workPacketStats->numaNodeCrossNodePopCount[node]);
+			}
+		}
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -309,7 +336,19 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->isSegregatedHeap() && extensions->segregatedConcurrentSweep) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		/* the concurrent sweep left by the previous collection, and who swept its regions before this one started */
+		writer->formatAndOutput(env, 1, "<concurrent-sweep regions=\"%zu\" background=\"%zu\" unswept=\"%zu\" />",
+				sweepStats->concurrentSweepRegions, sweepStats->concurrentSweepBackgroundRegions, sweepStats->concurrentSweepUnsweptRegions);
+		writer->formatAndOutput(env, 0, "</gc-op>");
+	} else
+#endif /* OMR_GC_SEGREGATED_HEAP */
+	{
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	}
 
 	handleSweepEndInternal(env, eventData);
 	exitAtomicReportingBlock();
@@ -359,6 +398,14 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		uint64_t planMicros = 0;
+		uint64_t moveMicros = 0;
+		uint64_t fixupMicros = 0;
+		getTimeDeltaInMicroSeconds(&planMicros, compactStats->_planStartTime, compactStats->_planEndTime);
+		getTimeDeltaInMicroSeconds(&moveMicros, compactStats->_moveStartTime, compactStats->_moveEndTime);
+		getTimeDeltaInMicroSeconds(&fixupMicros, compactStats->_fixupStartTime, compactStats->_fixupEndTime);
+		writer->formatAndOutput(env, 1, "<compact-phases planms=\"%llu.%03llu\" movems=\"%llu.%03llu\" fixupms=\"%llu.%03llu\" />",
+				planMicros / 1000, planMicros % 1000, moveMicros / 1000, moveMicros % 1000, fixupMicros / 1000, fixupMicros % 1000);
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -415,6 +462,32 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
 
+	/* copy distance bin n counts copies where (slot address XOR referent address) is at most 2^n: bins up to 6 approximate a shared 64 byte cache line and bins up to 12 a shared 4K page */
+	uint64_t copyCount = 0;
+	uint64_t sameCacheLineCount = 0;
+	uint64_t samePageCount = 0;
+	for (uintptr_t bin = 0; bin < OMR_SCAVENGER_DISTANCE_BINS; bin++) {
+		copyCount += scavengerStats->_copy_distance_counts[bin];
+		if (bin <= 6) {
+			sameCacheLineCount += scavengerStats->_copy_distance_counts[bin];
+		}
+		if (bin <= 12) {
+			samePageCount += scavengerStats->_copy_distance_counts[bin];
+		}
+	}
+	if ((_extensions->scavengerHotFieldCopyOrder || (0 != _extensions->scavengerPrefetchDistance)) && (0 != copyCount)) {
+		writer->formatAndOutput(env, 1, "<copy-locality copies=\"%llu\" samecacheline=\"%llu\" samepage=\"%llu\" hotfieldchain=\"%llu\" />",
+				copyCount, sameCacheLineCount, samePageCount, scavengerStats->_hotFieldChainCopyCount);
+	}
+
+	if (_extensions->scavengerCardMarking) {
+		uint64_t rememberedSetScanMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t rememberedSetPruneMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetPruneTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<remembered-set-scan type=\"cards\" objects=\"%zu\" cards=\"%zu\" scanms=\"%llu.%03llu\" prunems=\"%llu.%03llu\" />",
+				scavengerStats->_rememberedObjectsScanned, scavengerStats->_rememberedCardsScanned,
+				rememberedSetScanMicros / 1000, rememberedSetScanMicros % 1000, rememberedSetPruneMicros / 1000, rememberedSetPruneMicros % 1000);
+	}
+
 	handleScavengeEndInternal(env, eventData);
 	
 	if(0 != scavengerStats->_tenureExpandedCount) {
@@ -521,6 +594,21 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
 			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
 
+	MM_CardCleaningStats *runStats = ((MM_ConcurrentCardTable *)env->getExtensions()->cardTable)->getCardTableStats()->getFinalCardCleaningStats();
+	if (0 != runStats->_cardRuns) {
+		char histogram[CARD_RUN_HISTOGRAM_BUCKETS * 48];
+		uintptr_t length = 0;
+		histogram[0] = '\0';
+		for (uintptr_t bucket = 0; bucket < CARD_RUN_HISTOGRAM_BUCKETS; bucket++) {
+			if (0 != runStats->_cardRunHistogram[bucket]) {
+				length += omrstr_printf(histogram + length, sizeof(histogram) - length, "%s%zu:%zu",
+						(0 == length) ? "" : " ", (uintptr_t)1 << bucket, runStats->_cardRunHistogram[bucket]);
+			}
+		}
+		writer->formatAndOutput(env, 1, "<card-runs runs=\"%zu\" cards=\"%zu\" histogram=\"%s\" />",
+				runStats->_cardRuns, runStats->_cardsCleaned, histogram);
+	}
+
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -170,6 +170,23 @@ public:
 #endif /* !defined(ATOMIC_SUPPORT_STUB) */
 	}
 
+	/**
+	 * If the CPU supports it, emit a hint to bring the cache line containing the given address
+	 * into the data cache.  The address need not be valid; the hint never faults.
+	 * @param address the address to prefetch
+	 */
+	VMINLINE static void
+	prefetch(const void *address)
+	{
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#elif defined(__GNUC__)
+		__builtin_prefetch(address);
+#endif /* defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)) */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+	}
+
 	/**
 	 * Creates a memory barrier.
 	 * On a given processor, any load or store instructions ahead
@@ -203,6 +203,9 @@
 #define OMRPORT_VMEM_PAGE_FLAG_SUPERPAGE_ANY	0x8
 
 #define OMRPORT_VMEM_PAGE_FLAG_TYPE_MASK 		0xF
+
+/* Not a page type: set alongside the type when the OS has been advised to back the pages with transparent huge pages */
+#define OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE	0x10
 /** @} */
 
 /**
@@ -337,6 +340,11 @@ typedef struct J9PortVmemParams {
 	 *  		- enabled for Linux only,
 	 *  		- If not set, search memory in linear scan method
 	 *  		- If set, scan memory in a quick way, using memory information in file /proc/self/maps. (still use linear search if failed)
+	 * \arg OMRPORT_VMEM_ADVISE_HUGEPAGE
+	 *  		- enabled for Linux only, ignored on all other platforms
+	 *  		- advise the OS to back memory reserved with the default page size with transparent huge pages, including
+	 *  		  when a large page request falls back to the default page size
+	 *  		- the identifier page flags include OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE if the advice was accepted
 	 */
 	uintptr_t options;
 
@@ -366,6 +374,7 @@ typedef enum J9VMemMemoryQuery {
 #define OMRPORT_VMEM_STRICT_PAGE_SIZE	8
 #define OMRPORT_VMEM_ZOS_USE2TO32G_AREA 16
 #define OMRPORT_VMEM_ALLOC_QUICK 		32
+#define OMRPORT_VMEM_ADVISE_HUGEPAGE 	64
 
 /**
  * @name Virtual Memory Address
@@ -529,6 +538,24 @@ typedef struct J9MemoryInfo {
 
 #define OMRPORT_MEMINFO_NOT_AVAILABLE ((uint64_t) -1)
 
+/**
+ * Stores the resource limits imposed on the process by the Linux control group (cgroup) it runs in.
+ * @see omrsysinfo_get_cgroup_limits
+ *
+ * A limit which is not set, or which could not be read, is OMRPORT_CGROUP_NOT_LIMITED.
+ */
+typedef struct J9SysinfoCgroupLimits {
+	uint32_t version;			/* cgroup version providing the limits (1 or 2), 0 if no cgroup was found. */
+	uint64_t cpuQuota;			/* CPU time the group may use in each period (in microseconds). */
+	uint64_t cpuPeriod;			/* Length of the CPU quota period (in microseconds). */
+	uint64_t cpuShares;			/* Relative CPU weight of the group: cpu.shares (version 1) or cpu.weight (version 2). */
+	uint64_t cpusetCount;		/* Number of CPUs in the group's cpuset. */
+	uint64_t cpuLimit;			/* CPUs the group may use: the lesser of the quota rounded up and the cpuset. */
+	uint64_t memoryLimit;		/* Memory the group may use (in bytes). */
+} J9SysinfoCgroupLimits;
+
+#define OMRPORT_CGROUP_NOT_LIMITED ((uint64_t) -1)
+
 /**
  * Stores usage information on a per-processor basis. These parameters are the ones that generic
  * whereas, operating system specific parameters are not saved here. If one of these parameters is
@@ -633,6 +660,7 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_NOSUBALLOC32BITMEM  "NOSUBALLOC32BITMEM"
 #define OMRPORT_CTLDATA_VMEM_ADVISE_OS_ONFREE  "VMEM_ADVISE_OS_ONFREE"
 #define OMRPORT_CTLDATA_VECTOR_REGS_SUPPORT_ON  "VECTOR_REGS_SUPPORT_ON"
+#define OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT  "SYSINFO_CGROUP_ROOT"
 
 #define OMRPORT_FILE_READ_LOCK  1
 #define OMRPORT_FILE_WRITE_LOCK  2
@@ -1381,6 +1409,8 @@ typedef struct OMRPortLibrary {
 	void (*sysinfo_set_number_entitled_CPUs)(struct OMRPortLibrary *portLibrary, uintptr_t number) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_get_open_file_count "omrsysinfo_get_open_file_count"*/
 	int32_t (*sysinfo_get_open_file_count)(struct OMRPortLibrary *portLibrary, uint64_t *count) ;
+	/** see @ref omrsysinfo.c::omrsysinfo_get_cgroup_limits "omrsysinfo_get_cgroup_limits"*/
+	int32_t (*sysinfo_get_cgroup_limits)(struct OMRPortLibrary *portLibrary, struct J9SysinfoCgroupLimits *limits) ;
 	/** see @ref omrport.c::omrport_init_library "omrport_init_library"*/
 	int32_t (*port_init_library)(struct OMRPortLibrary *portLibrary, uintptr_t size) ;
 	/** see @ref omrport.c::omrport_startup_library "omrport_startup_library"*/
@@ -1817,6 +1847,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsysinfo_get_cwd(param1,param2) privateOmrPortLibrary->sysinfo_get_cwd(privateOmrPortLibrary, (param1), (param2))
 #define omrsysinfo_get_tmp(param1,param2,param3) privateOmrPortLibrary->sysinfo_get_tmp(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrsysinfo_get_open_file_count(param1) privateOmrPortLibrary->sysinfo_get_open_file_count(privateOmrPortLibrary, (param1))
+#define omrsysinfo_get_cgroup_limits(param1) privateOmrPortLibrary->sysinfo_get_cgroup_limits(privateOmrPortLibrary, (param1))
 #define omrintrospect_startup() privateOmrPortLibrary->introspect_startup(privateOmrPortLibrary)
 #define omrintrospect_shutdown() privateOmrPortLibrary->introspect_shutdown(privateOmrPortLibrary)
 #define omrintrospect_set_suspend_signal_offset(param1) privateOmrPortLibrary->introspect_set_suspend_signal_offset(privateOmrPortLibrary, param1)
@@ -186,6 +186,13 @@ typedef struct J9ThreadMonitorTracing {
 #define J9_ABSTRACT_MONITOR_FIELDS_7
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) && defined(OMR_THR_THREE_TIER_LOCKING) */
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX)
+#define J9_ABSTRACT_MONITOR_FIELDS_8 \
+	volatile uint32_t futexSequence;
+#else /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+#define J9_ABSTRACT_MONITOR_FIELDS_8
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+
 #define J9_ABSTRACT_MONITOR_FIELDS \
 	J9_ABSTRACT_MONITOR_FIELDS_1 \
 	J9_ABSTRACT_MONITOR_FIELDS_2 \
@@ -193,7 +200,8 @@ typedef struct J9ThreadMonitorTracing {
 	J9_ABSTRACT_MONITOR_FIELDS_4 \
 	J9_ABSTRACT_MONITOR_FIELDS_5 \
 	J9_ABSTRACT_MONITOR_FIELDS_6 \
-	J9_ABSTRACT_MONITOR_FIELDS_7
+	J9_ABSTRACT_MONITOR_FIELDS_7 \
+	J9_ABSTRACT_MONITOR_FIELDS_8
 
 
 /*
@@ -44,6 +44,9 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* Flags for omrthread_rwmutex_init */
+#define J9THREAD_RWMUTEX_FLAG_READ_BIASED  0x1
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		1000 * 1000 * 1000
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -321,6 +324,106 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 BOOLEAN
 omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex);
 
+/* ---------------- omrthreadpool.c ---------------- */
+
+#define J9THREAD_POOL_OK	0
+#define J9THREAD_POOL_FAIL	1
+
+/**
+* @struct
+*/
+struct J9ThreadPool;
+
+/**
+*@typedef
+*/
+typedef struct J9ThreadPool *omrthread_pool_t;
+
+typedef void (*omrthread_pool_task_t)(void *userData);
+
+/**
+ * Counts tasks which have been submitted but have not yet run.
+ * Initialize with omrthread_pool_join_init and wait with omrthread_pool_join.
+ */
+typedef struct J9ThreadPoolJoin {
+	volatile uintptr_t pending;
+} J9ThreadPoolJoin;
+
+typedef struct J9ThreadPoolStats {
+	uint64_t tasksExecuted; /* tasks run by workers and by joining threads */
+	uint64_t steals; /* tasks taken from another worker's deque */
+	uint64_t idleTime; /* time workers spent waiting for work, in high resolution clock ticks */
+	uintptr_t workerCount;
+	uintptr_t peakWorkerCount;
+} J9ThreadPoolStats;
+
+/**
+* @brief
+* @param handle
+* @param name
+* @param minWorkers
+* @param maxWorkers
+* @param idleTimeoutMillis
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_create(omrthread_pool_t *handle, const char *name, uintptr_t minWorkers, uintptr_t maxWorkers, int64_t idleTimeoutMillis);
+
+/**
+* @brief
+* @param pool
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_destroy(omrthread_pool_t pool);
+
+/**
+* @brief
+* @param pool
+* @param function
+* @param userData
+* @param join
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_submit(omrthread_pool_t pool, omrthread_pool_task_t function, void *userData, J9ThreadPoolJoin *join);
+
+/**
+* @brief
+* @param join
+* @return void
+*/
+void
+omrthread_pool_join_init(J9ThreadPoolJoin *join);
+
+/**
+* @brief
+* @param pool
+* @param join
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_join(omrthread_pool_t pool, J9ThreadPoolJoin *join);
+
+/**
+* @brief
+* @param pool
+* @param numaNodes
+* @param nodeCount
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_set_numa_affinity(omrthread_pool_t pool, const uintptr_t *numaNodes, uintptr_t nodeCount);
+
+/**
+* @brief
+* @param pool
+* @param stats
+* @return void
+*/
+void
+omrthread_pool_get_stats(omrthread_pool_t pool, J9ThreadPoolStats *stats);
+
 /* ---------------- omrthreadpriority.c ---------------- */
 
 /**
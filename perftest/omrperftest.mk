@@ -42,4 +42,13 @@ omr_perfgctest:
 	./omrgctest -configListFile=perftest/gctest/configuration/perfConfigListFile.txt -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+# Run the GC benchmark workloads once for each GC thread count, appending a line of JSON per workload to GC_BENCHMARK_RESULTS
+GC_BENCHMARK_RESULTS ?= gcBenchmarkResults.json
+GC_BENCHMARK_THREADS ?= 1
+
+omr_gcbenchmark:
+	for threads in $(GC_BENCHMARK_THREADS); do \
+		OMR_GC_OPTIONS="-Xgcthreads$$threads" ./omrgctest -configListFile=fvtest/gctest/configuration/gcBenchmarkListFile.txt -benchmarkResults=$(GC_BENCHMARK_RESULTS) || exit 1; \
+	done
+
+.PHONY: all test omr_perfgctest omr_gcbenchmark 
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/*
+ * Decodes verbose GC files written with -Xgc:verboseBinaryFormat.
+ *
+ *   omrverbosegcdecode -xml <file>...    write the XML log to stdout
+ *   omrverbosegcdecode -stats <file>...  summarize the pause times and mark/sweep times of the files
+ *
+ * The files are streamed through MM_VerboseBinaryDecoder a record at a time, so they are never held in memory;
+ * the statistics keep only the times they summarize.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <numeric>
+#include <stdio.h>
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryDecoder.hpp"
+
+/**
+ * Writes the decoded XML to stdout.
+ */
+class XMLWriter : public MM_VerboseBinaryDecoderVisitor
+{
+public:
+	OMRPortLibrary *portLibrary;
+
+	bool write(const char *text, uintptr_t length)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		return 0 == omrfile_write_text(OMRPORT_TTY_OUT, text, length);
+	}
+
+	virtual bool header(const char *text, uintptr_t length) { return write(text, length); }
+	virtual bool record(const char *text, uintptr_t length) { return write(text, length); }
+	virtual bool footer(const char *text, uintptr_t length) { return write(text, length); }
+
+	XMLWriter(OMRPortLibrary *portLib)
+		: portLibrary(portLib)
+	{}
+};
+
+/**
+ * Collects the times to summarize from each record as it is decoded.
+ *
+ * A record is not always a complete element (e.g. a gc-start is ended in a later record), so rather than parse
+ * records as XML, the start tags of the elements with the times are found in the text and their attributes read.
+ */
+class StatisticsCollector : public MM_VerboseBinaryDecoderVisitor
+{
+public:
+	std::vector<double> pauseValues;
+	std::vector<double> markValues;
+	std::vector<double> sweepValues;
+
+	/**
+	 * Find the value of an attribute of a start tag.
+	 * @param tag[in] the '<' of the tag
+	 * @param tagEnd[in] the '>' of the tag
+	 * @param name[in] the attribute, with a leading space and a trailing '="', e.g. " timems=\""
+	 * @return the value, which ends at the next '"', or NULL if the tag does not have the attribute
+	 */
+	const char *findAttribute(const char *tag, const char *tagEnd, const char *name)
+	{
+		size_t nameLength = strlen(name);
+		for (const char *cursor = tag; (cursor + nameLength) <= tagEnd; cursor++) {
+			if (0 == strncmp(cursor, name, nameLength)) {
+				return cursor + nameLength;
+			}
+		}
+		return NULL;
+	}
+
+	void collect(const char *tag, const char *tagEnd, const char *name, std::vector<double> &values)
+	{
+		const char *value = findAttribute(tag, tagEnd, name);
+		if (NULL != value) {
+			values.push_back(atof(value));
+		}
+	}
+
+	virtual bool record(const char *text, uintptr_t length)
+	{
+		const char *tag = text;
+		while (NULL != (tag = strchr(tag, '<'))) {
+			const char *tagEnd = strchr(tag, '>');
+			if (NULL == tagEnd) {
+				break;
+			}
+			if (0 == strncmp(tag, "<exclusive-end ", strlen("<exclusive-end "))) {
+				collect(tag, tagEnd, " durationms=\"", pauseValues);
+			} else if (0 == strncmp(tag, "<gc-op ", strlen("<gc-op "))) {
+				const char *type = findAttribute(tag, tagEnd, " type=\"");
+				if (NULL != type) {
+					if (0 == strncmp(type, "mark\"", strlen("mark\""))) {
+						collect(tag, tagEnd, " timems=\"", markValues);
+					} else if (0 == strncmp(type, "sweep\"", strlen("sweep\""))) {
+						collect(tag, tagEnd, " timems=\"", sweepValues);
+					}
+				}
+			}
+			tag = tagEnd + 1;
+		}
+		return true;
+	}
+};
+
+/**
+ * @return the nearest-rank percentile of sorted values
+ */
+double
+getPercentile(std::vector<double> &sortedValues, double percentile)
+{
+	if (sortedValues.empty()) {
+		return 0;
+	}
+	size_t rank = (size_t)((percentile / 100.0) * sortedValues.size() + 0.999999);
+	if (0 == rank) {
+		rank = 1;
+	}
+	return sortedValues[std::min(rank, sortedValues.size()) - 1];
+}
+
+double
+getAvg(std::vector<double> &v)
+{
+	if (v.empty()) {
+		return 0;
+	}
+	double sum = std::accumulate(v.begin(), v.end(), 0.0);
+	return sum / v.size();
+}
+
+double
+getMax(std::vector<double> &v)
+{
+	return v.empty() ? 0 : *std::max_element(v.begin(), v.end());
+}
+
+void
+printStatistics(StatisticsCollector *stats, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	std::sort(stats->pauseValues.begin(), stats->pauseValues.end());
+
+	omrtty_printf("\n            Count          p50            p90            p99            Max\n");
+	omrtty_printf("--------------------------------------------------------------------------------\n");
+	omrtty_printf("Pause   : %-14zu %f       %f       %f       %f\n",
+			stats->pauseValues.size(),
+			getPercentile(stats->pauseValues, 50), getPercentile(stats->pauseValues, 90),
+			getPercentile(stats->pauseValues, 99), getMax(stats->pauseValues));
+
+	omrtty_printf("\n            Count          Average        Max\n");
+	omrtty_printf("--------------------------------------------------------------------------------\n");
+	omrtty_printf("Mark    : %-14zu %f       %f\n", stats->markValues.size(), getAvg(stats->markValues), getMax(stats->markValues));
+	omrtty_printf("Sweep   : %-14zu %f       %f\n\n", stats->sweepValues.size(), getAvg(stats->sweepValues), getMax(stats->sweepValues));
+}
+
+int
+main(int argc, char **argv)
+{
+	intptr_t rc = 0;
+	OMRPortLibrary portLibrary;
+
+	if ((3 > argc) || ((0 != strcmp(argv[1], "-xml")) && (0 != strcmp(argv[1], "-stats")))) {
+		fprintf(stderr, "Usage: %s -xml|-stats <verbose GC file>...\n", argv[0]);
+		fprintf(stderr, "  -xml    write the decoded XML log to stdout\n");
+		fprintf(stderr, "  -stats  summarize the pause times (exclusive-end) and mark and sweep times (gc-op)\n");
+		return -1;
+	}
+	bool xml = (0 == strcmp(argv[1], "-xml"));
+
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	XMLWriter writer(&portLibrary);
+	StatisticsCollector stats;
+	MM_VerboseBinaryDecoder decoder(&portLibrary);
+	int result = 0;
+
+	/* the files of a rotated log are decoded in the order given, and their statistics combined */
+	for (int i = 2; i < argc; i++) {
+		MM_VerboseBinaryDecoderVisitor *visitor = xml ? (MM_VerboseBinaryDecoderVisitor *)&writer : (MM_VerboseBinaryDecoderVisitor *)&stats;
+		MM_VerboseBinaryDecoder::DecodeResult decodeResult = decoder.decode(argv[i], visitor);
+		if (MM_VerboseBinaryDecoder::DECODE_OK != decodeResult) {
+			fprintf(stderr, "Failed to decode %s: %s\n", argv[i], MM_VerboseBinaryDecoder::getResultDescription(decodeResult));
+			result = -1;
+		}
+	}
+	decoder.tearDown();
+
+	if (!xml) {
+		printStatistics(&stats, &portLibrary);
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return result;
+}
@@ -30,6 +30,10 @@ uintptr_t
 syslogOpen(struct OMRPortLibrary *portLibrary, uintptr_t flags);
 uintptr_t
 syslogClose(struct OMRPortLibrary *portLibrary);
+#if defined(LINUX)
+int32_t
+setCgroupRoot(struct OMRPortLibrary *portLibrary, const char *root);
+#endif /* defined(LINUX) */
 
 #if defined(OMR_RAS_TDF_TRACE)
 #define _UTE_STATIC_
@@ -100,6 +104,13 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 		return 0;
 	}
 
+#if defined(LINUX)
+	if (!strcmp(OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT, key)) {
+		/* value is the directory to read the cgroup files below, or NULL for the real ones */
+		return setCgroupRoot(portLibrary, (const char *)value);
+	}
+#endif /* defined(LINUX) */
+
 #if defined (WIN32) && !defined(J9HAMMER)
 	if (!strcmp("SIG_INTERNAL_HANDLER", key)) {
 		/* used by optimized code to implement fast signal handling on Windows */
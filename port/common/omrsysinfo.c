@@ -141,7 +141,8 @@ omrsysinfo_get_executable_name(struct OMRPortLibrary *portLibrary, const char *a
  * 	- OMRPORT_CPU_ONLINE: Number of online CPU's on this machine
  * 	- OMRPORT_CPU_BOUND: Number of physical CPU's bound to this process
  * 	- OMRPORT_CPU_ENTITLED: Number of CPU's the user has specified should be used by the process
- * 	- OMRPORT_CPU_TARGET: Number of CPU's that should be used by the process. This is OMR_MIN(BOUND, ENTITLED).
+ * 	- OMRPORT_CPU_TARGET: Number of CPU's that should be used by the process. This is OMR_MIN(BOUND, ENTITLED),
+ * 	  further limited on Linux by the CPU quota of the process's cgroup (see omrsysinfo_get_cgroup_limits).
  *
  * @param[in] portLibrary The port library.
  * @param[in] type Flag to indicate the information type (see function description).
@@ -738,3 +739,26 @@ omrsysinfo_get_open_file_count(struct OMRPortLibrary *portLibrary, uint64_t *cou
 	return OMRPORT_ERROR_SYSINFO_GET_OPEN_FILES_NOT_SUPPORTED;
 }
 
+/**
+ * Determine the CPU and memory limits imposed on the process by its Linux control group.
+ * Both cgroup version 1 and version 2 hierarchies are understood. Limits set on an ancestor
+ * group apply to the process too, so the CPU quota and memory limit are the tightest found
+ * between the process's group and the root of the hierarchy.
+ *
+ * The cgroup files are looked up below the root set with the OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT
+ * omrport_control key, if any, so that a copy of the /proc and /sys/fs/cgroup files can be inspected
+ * in place of the real ones.
+ *
+ * @param[in] portLibrary instance of port library
+ * @param[out] limits The limits found. Limits which are not set are OMRPORT_CGROUP_NOT_LIMITED and
+ * limits->version is 0 if the process is not in a cgroup.
+ *
+ * @return 0 on success, OMRPORT_ERROR_SYSINFO_NULL_OBJECT_RECEIVED if limits is NULL, or
+ * OMRPORT_ERROR_SYSINFO_NOT_SUPPORTED on platforms without cgroups.
+ */
+int32_t
+omrsysinfo_get_cgroup_limits(struct OMRPortLibrary *portLibrary, struct J9SysinfoCgroupLimits *limits)
+{
+	return OMRPORT_ERROR_SYSINFO_NOT_SUPPORTED;
+}
+
@@ -59,6 +59,10 @@
 #define MAP_FAILED -1
 #endif
 
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
 #define INVALID_KEY -1
 
 #if 0
@@ -68,6 +72,9 @@
 #define VMEM_MEMINFO_SIZE_MAX	2048
 #define VMEM_PROC_MEMINFO_FNAME	"/proc/meminfo"
 #define VMEM_PROC_MAPS_FNAME	"/proc/self/maps"
+#define VMEM_SYS_HUGEPAGES_DIR	"/sys/kernel/mm/hugepages"
+#define VMEM_SYS_THP_ENABLED_FNAME	"/sys/kernel/mm/transparent_hugepage/enabled"
+#define VMEM_SYS_THP_SIZE_FNAME	"/sys/kernel/mm/transparent_hugepage/hpage_pmd_size"
 
 typedef struct vmem_hugepage_info_t {
 	uintptr_t	enabled; /*!< boolean enabling j9 large page support */
@@ -90,11 +97,15 @@ uintptr_t addressRange_Width(AddressRange *range);
 ADDRESS findAvailableMemoryBlockNoMalloc(struct OMRPortLibrary *portLibrary, ADDRESS start, ADDRESS end, uintptr_t byteAmount, BOOLEAN reverse);
 
 static void *getMemoryInRangeForLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, key_t addressKey, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t pageSize, uintptr_t mode);
-static void *getMemoryInRangeForDefaultPages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode);
+static void *getMemoryInRangeUsingMmap(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t pageSize, uintptr_t mode);
 static void *allocateMemoryForLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *currentAddress, key_t addressKey, OMRMemCategory *category, uintptr_t byteAmount, uintptr_t pageSize, uintptr_t mode);
 static BOOLEAN isStrictAndOutOfRange(void *memoryPointer, void *startAddress, void *endAddress, uintptr_t vmemOptions);
 static BOOLEAN rangeIsValid(struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
 static void *reserveLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t pageSize, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode);
+static void *reserveMemoryWithPageSize(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, struct J9PortVmemParams *params, uintptr_t pageSize);
+static BOOLEAN isLargePageSize(struct OMRPortLibrary *portLibrary, uintptr_t pageSize);
+static BOOLEAN isHugetlbMapping(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier);
+static void adviseTransparentHugePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount, uintptr_t vmemOptions);
 
 void *default_pageSize_reserve_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category);
 #if defined(OMR_PORT_NUMA_SUPPORT)
@@ -102,6 +113,10 @@ static void port_numa_interleave_memory(struct OMRPortLibrary *portLibrary, void
 #endif /* OMR_PORT_NUMA_SUPPORT */
 void update_vmemIdentifier(J9PortVmemIdentifier *identifier, void *address, void *handle, uintptr_t byteAmount, uintptr_t mode, uintptr_t pageSize, uintptr_t pageFlags, uintptr_t allocator, OMRMemCategory *category);
 static uintptr_t get_hugepages_info(struct OMRPortLibrary *portLibrary, vmem_hugepage_info_t *page_info);
+static BOOLEAN read_sysfs_file(struct OMRPortLibrary *portLibrary, const char *path, char *buffer, uintptr_t bufferSize);
+static uintptr_t read_sysfs_value(struct OMRPortLibrary *portLibrary, const char *path);
+static void add_hugetlb_page_sizes(struct OMRPortLibrary *portLibrary, uintptr_t firstIndex);
+static uintptr_t get_transparent_hugepage_size(struct OMRPortLibrary *portLibrary);
 int get_protectionBits(uintptr_t mode);
 
 #if defined(OMR_PORT_NUMA_SUPPORT)
@@ -512,6 +527,11 @@ omrvmem_startup(struct OMRPortLibrary *portLibrary)
 		PPG_vmem_pageFlags[1] = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
 	}
 
+	/* Then any other hugetlb page sizes that have a pool, these can only be used through mmap */
+	add_hugetlb_page_sizes(portLibrary, vmem_page_info.enabled ? 2 : 1);
+
+	PPG_vmem_transparentHugePageSize = get_transparent_hugepage_size(portLibrary);
+
 #if defined(OMR_PORT_NUMA_SUPPORT)
 	if (0 == initializeNumaGlobals(portLibrary)) {
 		PPG_numa_platform_supports_numa = 1;
@@ -550,7 +570,7 @@ omrvmem_commit_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr
 				Trc_PRT_vmem_omrvmem_commit_memory_mprotect_failure(errno);
 				portLibrary->error_set_last_error(portLibrary,  errno, OMRPORT_ERROR_VMEM_OPFAILED);
 			}
-		} else if (PPG_vmem_pageSize[1] == identifier->pageSize) {
+		} else if (isLargePageSize(portLibrary, identifier->pageSize)) {
 			rc = address;
 		}
 	} else {
@@ -579,10 +599,10 @@ omrvmem_decommit_memory(struct OMRPortLibrary *portLibrary, void *address, uintp
 			ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(byteAmount, identifier->pageSize);
 
 			if (byteAmount > 0) {
-				if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP) {
+				if ((identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP) && !isHugetlbMapping(portLibrary, identifier)) {
 					result  = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
 				} else {
-					/* need to determine what to use in the case of shmat/shmget, till then return success */
+					/* need to determine what to use in the case of shmat/shmget and hugetlb mappings, till then return success */
 					result = 0;
 				}
 
@@ -695,21 +715,12 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 		update_vmemIdentifier(identifier, NULL, NULL, 0, 0, 0, 0, 0, NULL);
 		Trc_PRT_vmem_omrvmem_reserve_memory_invalid_input();
 	} else if (PPG_vmem_pageSize[0] == params->pageSize) {
-		uintptr_t alignmentInBytes = OMR_MAX(params->pageSize, params->alignmentInBytes);
-		uintptr_t minimumGranule = OMR_MIN(params->pageSize, params->alignmentInBytes);
-
-		/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
-		if ((0 == minimumGranule) || (0 == (alignmentInBytes % minimumGranule))) {
-			memoryPointer = getMemoryInRangeForDefaultPages(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, params->mode);
-		}
-	} else if (PPG_vmem_pageSize[1] == params->pageSize) {
-		uintptr_t largePageAlignmentInBytes = OMR_MAX(params->pageSize, params->alignmentInBytes);
-		uintptr_t largePageMinimumGranule = OMR_MIN(params->pageSize, params->alignmentInBytes);
-
-		/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
-		if ((0 == largePageMinimumGranule) || (0 == (largePageAlignmentInBytes % largePageMinimumGranule))) {
-			memoryPointer = reserveLargePages(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, params->pageSize, largePageAlignmentInBytes, params->options, params->mode);
+		memoryPointer = reserveMemoryWithPageSize(portLibrary, identifier, category, params, params->pageSize);
+		if (NULL != memoryPointer) {
+			adviseTransparentHugePages(portLibrary, identifier, memoryPointer, params->byteAmount, params->options);
 		}
+	} else if (isLargePageSize(portLibrary, params->pageSize)) {
+		memoryPointer = reserveMemoryWithPageSize(portLibrary, identifier, category, params, params->pageSize);
 		if (NULL == memoryPointer) {
 			/* If strict page size flag is not set try again with default page size */
 			if (0 == (OMRPORT_VMEM_STRICT_PAGE_SIZE & params->options)) {
@@ -717,13 +728,10 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 				printf("\t\t\t NULL == memoryPointer, reverting to default pages\n");
 				fflush(stdout);
 #endif
-				uintptr_t defaultPageSize = PPG_vmem_pageSize[0];
-				uintptr_t alignmentInBytes = OMR_MAX(defaultPageSize, params->alignmentInBytes);
-				uintptr_t minimumGranule = OMR_MIN(defaultPageSize, params->alignmentInBytes);
-
-				/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
-				if ((0 == minimumGranule) || (0 == (alignmentInBytes % minimumGranule))) {
-					memoryPointer = getMemoryInRangeForDefaultPages(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, params->mode);
+				Trc_PRT_vmem_omrvmem_reserve_memory_large_pages_fallback(params->pageSize, params->byteAmount);
+				memoryPointer = reserveMemoryWithPageSize(portLibrary, identifier, category, params, PPG_vmem_pageSize[0]);
+				if (NULL != memoryPointer) {
+					adviseTransparentHugePages(portLibrary, identifier, memoryPointer, params->byteAmount, params->options);
 				}
 			} else {
 				update_vmemIdentifier(identifier, NULL, NULL, 0, 0, 0, 0, 0, NULL);
@@ -749,6 +757,92 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 	return memoryPointer;
 }
 
+/**
+ * @internal
+ * Reserve memory backed by pages of pageSize, which is either the default page size or one of the
+ * supported large page sizes. Large pages are mapped with mmap(MAP_HUGETLB) from the pool of their
+ * size; if that fails, the default large page size is retried with shmget(SHM_HUGETLB).
+ * The alignment is the lowest common multiple of pageSize and the requested alignment.
+ *
+ * @return pointer to the reserved memory on success, NULL on failure
+ */
+static void *
+reserveMemoryWithPageSize(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, struct J9PortVmemParams *params, uintptr_t pageSize)
+{
+	void *memoryPointer = NULL;
+	uintptr_t alignmentInBytes = OMR_MAX(pageSize, params->alignmentInBytes);
+	uintptr_t minimumGranule = OMR_MIN(pageSize, params->alignmentInBytes);
+
+	/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
+	if ((0 == minimumGranule) || (0 == (alignmentInBytes % minimumGranule))) {
+		if (PPG_vmem_pageSize[0] == pageSize) {
+			memoryPointer = getMemoryInRangeUsingMmap(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, pageSize, params->mode);
+		} else {
+#if defined(MAP_HUGETLB)
+			memoryPointer = getMemoryInRangeUsingMmap(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, pageSize, params->mode);
+#endif /* defined(MAP_HUGETLB) */
+			if ((NULL == memoryPointer) && (PPG_vmem_pageSize[1] == pageSize)) {
+				memoryPointer = reserveLargePages(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, pageSize, alignmentInBytes, params->options, params->mode);
+			}
+		}
+	}
+
+	return memoryPointer;
+}
+
+/**
+ * @internal
+ * Returns TRUE if pageSize is one of the supported large page sizes.
+ */
+static BOOLEAN
+isLargePageSize(struct OMRPortLibrary *portLibrary, uintptr_t pageSize)
+{
+	uintptr_t pageIndex = 0;
+
+	for (pageIndex = 1; 0 != PPG_vmem_pageSize[pageIndex]; pageIndex++) {
+		if (PPG_vmem_pageSize[pageIndex] == pageSize) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * @internal
+ * Returns TRUE if identifier describes memory mapped with mmap(MAP_HUGETLB).
+ */
+static BOOLEAN
+isHugetlbMapping(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier)
+{
+	return (OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator) && (PPG_vmem_pageSize[0] != identifier->pageSize);
+}
+
+/**
+ * @internal
+ * Advise the kernel to back default page memory with transparent huge pages if the caller asked for it
+ * with OMRPORT_VMEM_ADVISE_HUGEPAGE and the range spans at least one of them. Sets
+ * OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE in the identifier page flags if the advice was accepted.
+ */
+static void
+adviseTransparentHugePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount, uintptr_t vmemOptions)
+{
+#if defined(MADV_HUGEPAGE)
+	uintptr_t transparentHugePageSize = PPG_vmem_transparentHugePageSize;
+
+	if (J9_ARE_ANY_BITS_SET(vmemOptions, OMRPORT_VMEM_ADVISE_HUGEPAGE)
+		&& (0 != transparentHugePageSize)
+		&& (byteAmount >= transparentHugePageSize)
+	) {
+		if (0 == madvise(address, (size_t)byteAmount, MADV_HUGEPAGE)) {
+			identifier->pageFlags |= OMRPORT_VMEM_PAGE_FLAG_TRANSPARENT_HUGE;
+			Trc_PRT_vmem_omrvmem_advise_hugepage(address, byteAmount, transparentHugePageSize);
+		} else {
+			Trc_PRT_vmem_omrvmem_advise_hugepage_failed(address, byteAmount, errno);
+		}
+	}
+#endif /* defined(MADV_HUGEPAGE) */
+}
+
 static void *
 reserveLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t pageSize, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode)
 {
@@ -894,6 +988,124 @@ get_hugepages_info(struct OMRPortLibrary *portLibrary, vmem_hugepage_info_t *pag
 
 	return 1;
 }
+
+/**
+ * @internal
+ * Read a small file from sysfs into buffer, which is NUL terminated.
+ *
+ * @return TRUE on success, FALSE if the file could not be read
+ */
+static BOOLEAN
+read_sysfs_file(struct OMRPortLibrary *portLibrary, const char *path, char *buffer, uintptr_t bufferSize)
+{
+	BOOLEAN rc = FALSE;
+	intptr_t fd = omrfile_open(portLibrary, path, EsOpenRead, 0);
+
+	if (fd >= 0) {
+		intptr_t bytesRead = omrfile_read(portLibrary, fd, buffer, bufferSize - 1);
+		if (bytesRead > 0) {
+			buffer[bytesRead] = '\0';
+			rc = TRUE;
+		}
+		omrfile_close(portLibrary, fd);
+	}
+	return rc;
+}
+
+/**
+ * @internal
+ * Read a single unsigned value from sysfs.
+ *
+ * @return the value, or 0 if the file could not be read
+ */
+static uintptr_t
+read_sysfs_value(struct OMRPortLibrary *portLibrary, const char *path)
+{
+	char buffer[64];
+	uintptr_t value = 0;
+
+	if (read_sysfs_file(portLibrary, path, buffer, sizeof(buffer))) {
+		value = (uintptr_t)strtoull(buffer, NULL, 10);
+	}
+	return value;
+}
+
+/**
+ * @internal
+ * Append the hugetlb page sizes found in /sys/kernel/mm/hugepages to the supported page sizes in
+ * ascending order, skipping the default huge page size already in the table and any size with no pages
+ * configured in its pool (either preallocated or as overcommit).
+ *
+ * @param[in] firstIndex the first entry of the table that may be reordered
+ */
+static void
+add_hugetlb_page_sizes(struct OMRPortLibrary *portLibrary, uintptr_t firstIndex)
+{
+	DIR *hugepagesDir = opendir(VMEM_SYS_HUGEPAGES_DIR);
+
+	if (NULL != hugepagesDir) {
+		struct dirent *entry = NULL;
+
+		while (NULL != (entry = readdir(hugepagesDir))) {
+			uintptr_t sizeInKB = 0;
+			char path[PATH_MAX];
+			uintptr_t pageSize = 0;
+			uintptr_t pageIndex = 0;
+
+			if (1 != sscanf(entry->d_name, "hugepages-%" SCNuPTR "kB", &sizeInKB)) {
+				continue;
+			}
+			pageSize = sizeInKB * 1024;
+
+			portLibrary->str_printf(portLibrary, path, sizeof(path), VMEM_SYS_HUGEPAGES_DIR "/%s/nr_hugepages", entry->d_name);
+			if (0 == read_sysfs_value(portLibrary, path)) {
+				portLibrary->str_printf(portLibrary, path, sizeof(path), VMEM_SYS_HUGEPAGES_DIR "/%s/nr_overcommit_hugepages", entry->d_name);
+				if (0 == read_sysfs_value(portLibrary, path)) {
+					continue;
+				}
+			}
+
+			/* skip sizes already in the table, and leave room for the 0 terminator */
+			for (pageIndex = 1; 0 != PPG_vmem_pageSize[pageIndex]; pageIndex++) {
+				if (PPG_vmem_pageSize[pageIndex] == pageSize) {
+					break;
+				}
+			}
+			if ((0 == PPG_vmem_pageSize[pageIndex]) && (pageIndex < (OMRPORT_VMEM_PAGESIZE_COUNT - 1))) {
+				/* insertion sort, readdir returns the sizes in no particular order */
+				while ((pageIndex > firstIndex) && (PPG_vmem_pageSize[pageIndex - 1] > pageSize)) {
+					PPG_vmem_pageSize[pageIndex] = PPG_vmem_pageSize[pageIndex - 1];
+					PPG_vmem_pageFlags[pageIndex] = PPG_vmem_pageFlags[pageIndex - 1];
+					pageIndex -= 1;
+				}
+				PPG_vmem_pageSize[pageIndex] = pageSize;
+				PPG_vmem_pageFlags[pageIndex] = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
+			}
+		}
+		closedir(hugepagesDir);
+	}
+}
+
+/**
+ * @internal
+ * Determine the size of a transparent huge page.
+ *
+ * @return the size in bytes, or 0 if transparent huge pages are disabled or not supported
+ */
+static uintptr_t
+get_transparent_hugepage_size(struct OMRPortLibrary *portLibrary)
+{
+	char buffer[128];
+	uintptr_t pageSize = 0;
+
+	if (read_sysfs_file(portLibrary, VMEM_SYS_THP_ENABLED_FNAME, buffer, sizeof(buffer))
+		&& (NULL == strstr(buffer, "[never]"))
+	) {
+		pageSize = read_sysfs_value(portLibrary, VMEM_SYS_THP_SIZE_FNAME);
+	}
+	return pageSize;
+}
+
 void *
 default_pageSize_reserve_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category)
 {
@@ -916,7 +1128,21 @@ default_pageSize_reserve_memory(struct OMRPortLibrary *portLibrary, void *addres
 	if (-1 != fd)
 #endif
 	{
-		if (0 != (OMRPORT_VMEM_MEMORY_MODE_COMMIT & mode)) {
+		if (PPG_vmem_pageSize[0] != pageSize) {
+#if defined(MAP_HUGETLB)
+			/* Without MAP_NORESERVE the kernel reserves the pages from the pool now, so a short pool fails
+			 * the mmap rather than raising SIGBUS on first touch. The pages are committed when they are
+			 * reserved, as with shmget.
+			 */
+			uintptr_t pageSizeShift = 0;
+
+			while (((uintptr_t)1 << pageSizeShift) < pageSize) {
+				pageSizeShift += 1;
+			}
+			flags |= MAP_HUGETLB | (int)(pageSizeShift << MAP_HUGE_SHIFT);
+			protectionFlags = get_protectionBits(mode);
+#endif /* defined(MAP_HUGETLB) */
+		} else if (0 != (OMRPORT_VMEM_MEMORY_MODE_COMMIT & mode)) {
 			protectionFlags = get_protectionBits(mode);
 		} else {
 			flags |= MAP_NORESERVE;
@@ -1171,9 +1397,10 @@ _end:
  * Allocates memory in specified range using a best effort approach
  * (unless OMRPORT_VMEM_STRICT_ADDRESS flag is used) and returns a pointer
  * to the newly allocated memory. Returns NULL on failure.
+ * The memory is mapped with mmap, using hugetlb pages if pageSize is not the default page size.
  */
 static void *
-getMemoryInRangeForDefaultPages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode)
+getMemoryInRangeUsingMmap(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t pageSize, uintptr_t mode)
 {
 	intptr_t direction = 1;
 	void *currentAddress = startAddress;
@@ -1215,7 +1442,7 @@ getMemoryInRangeForDefaultPages(struct OMRPortLibrary *portLibrary, struct J9Por
 			smartAddress = findAvailableMemoryBlockNoMalloc(portLibrary, startAddress, currentAddress, byteAmount, TRUE);
 		}
 
-		allocatedAddress = default_pageSize_reserve_memory(portLibrary, smartAddress, byteAmount, identifier, mode, PPG_vmem_pageSize[0], category);
+		allocatedAddress = default_pageSize_reserve_memory(portLibrary, smartAddress, byteAmount, identifier, mode, pageSize, category);
 
 		if (NULL != allocatedAddress) {
 			/* If the memoryPointer located outside of the range, free it and set the pointer to NULL */
@@ -1235,7 +1462,7 @@ getMemoryInRangeForDefaultPages(struct OMRPortLibrary *portLibrary, struct J9Por
 	if (NULL == memoryPointer) {
 		/* try all addresses within range */
 		while ((startAddress <= currentAddress) && (endAddress >= currentAddress)) {
-			memoryPointer = default_pageSize_reserve_memory(portLibrary, currentAddress, byteAmount, identifier, mode, PPG_vmem_pageSize[0], category);
+			memoryPointer = default_pageSize_reserve_memory(portLibrary, currentAddress, byteAmount, identifier, mode, pageSize, category);
 
 			if (NULL != memoryPointer) {
 				/* stop if returned pointer is within range */
@@ -1263,7 +1490,7 @@ getMemoryInRangeForDefaultPages(struct OMRPortLibrary *portLibrary, struct J9Por
 	/* if strict flag is not set and we did not get any memory, attempt to get memory at any address */
 	if (0 == (OMRPORT_VMEM_STRICT_ADDRESS & vmemOptions) && (NULL == memoryPointer)) {
 allocAnywhere:
-		memoryPointer = default_pageSize_reserve_memory(portLibrary, NULL, byteAmount, identifier, mode, PPG_vmem_pageSize[0], category);
+		memoryPointer = default_pageSize_reserve_memory(portLibrary, NULL, byteAmount, identifier, mode, pageSize, category);
 	}
 
 	if (NULL == memoryPointer) {
@@ -503,6 +503,8 @@ extern J9_CFUNC intptr_t
 omrsysinfo_get_tmp(struct OMRPortLibrary *portLibrary, char *buf, uintptr_t bufLen, BOOLEAN ignoreEnvVariable);
 extern J9_CFUNC int32_t 
 omrsysinfo_get_open_file_count(struct OMRPortLibrary *portLibrary, uint64_t *count);
+extern J9_CFUNC int32_t
+omrsysinfo_get_cgroup_limits(struct OMRPortLibrary *portLibrary, struct J9SysinfoCgroupLimits *limits);
 
 /* J9SourceJ9Signal*/
 extern J9_CFUNC int32_t
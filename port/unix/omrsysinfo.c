@@ -1111,6 +1111,12 @@ omrsysinfo_get_number_CPUs_by_type(struct OMRPortLibrary *portLibrary, uintptr_t
 		} else {
 			toReturn = bound;
 		}
+#if defined(LINUX)
+		/* a cgroup CPU quota caps the number of CPUs the process can keep busy */
+		if ((0 != PPG_si_cgroupCpuLimit) && (PPG_si_cgroupCpuLimit < toReturn)) {
+			toReturn = (uintptr_t)PPG_si_cgroupCpuLimit;
+		}
+#endif /* defined(LINUX) */
 #endif /* defined(J9OS_I5) */
 		break;
 	}
@@ -1497,6 +1503,12 @@ omrsysinfo_shutdown(struct OMRPortLibrary *portLibrary)
 			portLibrary->mem_free_memory(portLibrary, PPG_si_executableName);
 			PPG_si_executableName = NULL;
 		}
+#if defined(LINUX)
+		if (NULL != PPG_si_cgroupRoot) {
+			portLibrary->mem_free_memory(portLibrary, PPG_si_cgroupRoot);
+			PPG_si_cgroupRoot = NULL;
+		}
+#endif /* defined(LINUX) */
 	}
 }
 
@@ -1509,6 +1521,13 @@ omrsysinfo_startup(struct OMRPortLibrary *portLibrary)
 	 * when the omrsysinfo_get_executable_name() actually gets invoked.
 	 */
 	(void) find_executable_name(portLibrary, &PPG_si_executableName);
+#if defined(LINUX)
+	{
+		/* Cache the cgroup CPU limit for OMRPORT_CPU_TARGET */
+		J9SysinfoCgroupLimits limits;
+		(void) omrsysinfo_get_cgroup_limits(portLibrary, &limits);
+	}
+#endif /* defined(LINUX) */
 	return 0;
 }
 
@@ -2969,3 +2988,498 @@ leave_routine:
 	return ret;
 }
 
+
+#if defined(LINUX)
+
+/* Version 1 reports an unset memory limit as LONG_MAX rounded down to the page size. */
+#define CGROUP_V1_MEMORY_UNLIMITED ((uint64_t)0x7FFFFFFFFF000000)
+#define CGROUP_LINE_LENGTH (2 * PATH_MAX)
+#define CGROUP_VALUE_LENGTH 64
+
+/* Indices of the version 1 controllers holding the limits, followed by the version 2 unified hierarchy. */
+#define CGROUP_CPU 0
+#define CGROUP_CPUSET 1
+#define CGROUP_MEMORY 2
+#define CGROUP_UNIFIED 3
+#define CGROUP_HIERARCHY_COUNT 4
+
+static const char *cgroupControllerNames[CGROUP_UNIFIED] = { "cpu", "cpuset", "memory" };
+
+/* Where the files of one cgroup hierarchy are found for the process. */
+typedef struct CgroupHierarchy {
+	char path[PATH_MAX]; /* the process's group within the hierarchy, as listed in /proc/self/cgroup */
+	char directory[PATH_MAX]; /* the directory holding the files of the process's group */
+	uintptr_t mountLength; /* length of the mount point at the start of directory */
+	BOOLEAN hasPath;
+	BOOLEAN hasDirectory;
+} CgroupHierarchy;
+
+/**
+ * @internal
+ * Determine whether name is one of the entries in a comma separated list.
+ */
+static BOOLEAN
+cgroupListContains(const char *list, const char *name)
+{
+	uintptr_t nameLength = strlen(name);
+	const char *cursor = list;
+
+	while (NULL != cursor) {
+		if ((0 == strncmp(cursor, name, nameLength)) && ((',' == cursor[nameLength]) || ('\0' == cursor[nameLength]))) {
+			return TRUE;
+		}
+		cursor = strchr(cursor, ',');
+		if (NULL != cursor) {
+			cursor += 1;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * @internal
+ * Record the directory of the process's group in a hierarchy mounted at mountPoint. The mount exposes
+ * the subtree of the hierarchy starting at mountRoot, which inside a container is usually the
+ * container's own group.
+ */
+static void
+setCgroupDirectory(struct OMRPortLibrary *portLibrary, CgroupHierarchy *hierarchy, const char *root, const char *mountRoot, const char *mountPoint)
+{
+	if (hierarchy->hasPath && !hierarchy->hasDirectory) {
+		uintptr_t mountRootLength = strlen(mountRoot);
+		const char *relativePath = "";
+
+		if (0 == strcmp(mountRoot, "/")) {
+			relativePath = hierarchy->path;
+		} else if ((0 == strncmp(hierarchy->path, mountRoot, mountRootLength))
+			&& (('/' == hierarchy->path[mountRootLength]) || ('\0' == hierarchy->path[mountRootLength]))
+		) {
+			relativePath = hierarchy->path + mountRootLength;
+		}
+		/* Otherwise the group is outside the mounted subtree (e.g. in a cgroup namespace) and the mount point is the group. */
+		if (0 == strcmp(relativePath, "/")) {
+			relativePath = "";
+		}
+
+		portLibrary->str_printf(portLibrary, hierarchy->directory, sizeof(hierarchy->directory), "%s%s", root, mountPoint);
+		hierarchy->mountLength = strlen(hierarchy->directory);
+		portLibrary->str_printf(portLibrary, hierarchy->directory, sizeof(hierarchy->directory), "%s%s%s", root, mountPoint, relativePath);
+		hierarchy->hasDirectory = TRUE;
+	}
+}
+
+/**
+ * @internal
+ * Fill in the path of the process's group in each hierarchy from /proc/self/cgroup, whose lines
+ * take the form hierarchy-ID:controller-list:cgroup-path. The version 2 hierarchy is listed as 0::cgroup-path.
+ *
+ * @return TRUE if /proc/self/cgroup could be read, FALSE otherwise.
+ */
+static BOOLEAN
+readCgroupPaths(struct OMRPortLibrary *portLibrary, CgroupHierarchy *hierarchies, const char *root)
+{
+	char fileName[PATH_MAX];
+	char line[CGROUP_LINE_LENGTH];
+	FILE *file = NULL;
+
+	portLibrary->str_printf(portLibrary, fileName, sizeof(fileName), "%s/proc/self/cgroup", root);
+	file = fopen(fileName, "r");
+	if (NULL == file) {
+		return FALSE;
+	}
+
+	while (NULL != fgets(line, sizeof(line), file)) {
+		char *controllerList = strchr(line, ':');
+		char *path = NULL;
+		uintptr_t i = 0;
+
+		if (NULL == controllerList) {
+			continue;
+		}
+		controllerList += 1;
+		path = strchr(controllerList, ':');
+		if (NULL == path) {
+			continue;
+		}
+		*path = '\0';
+		path += 1;
+		path[strcspn(path, "\n")] = '\0';
+
+		for (i = 0; i < CGROUP_HIERARCHY_COUNT; i++) {
+			BOOLEAN matches = FALSE;
+			if (CGROUP_UNIFIED == i) {
+				matches = ('0' == line[0]) && (':' == line[1]) && ('\0' == *controllerList);
+			} else {
+				matches = cgroupListContains(controllerList, cgroupControllerNames[i]);
+			}
+			if (matches) {
+				portLibrary->str_printf(portLibrary, hierarchies[i].path, sizeof(hierarchies[i].path), "%s", path);
+				hierarchies[i].hasPath = TRUE;
+			}
+		}
+	}
+	fclose(file);
+	return TRUE;
+}
+
+/**
+ * @internal
+ * Find where each hierarchy is mounted from /proc/self/mountinfo, whose lines take the form
+ * mount-ID parent-ID major:minor root mount-point options [optional-fields] - fs-type source super-options.
+ * Without mountinfo the hierarchies are assumed to be mounted in the usual places below /sys/fs/cgroup.
+ */
+static void
+readCgroupMounts(struct OMRPortLibrary *portLibrary, CgroupHierarchy *hierarchies, const char *root)
+{
+	char fileName[PATH_MAX];
+	char line[CGROUP_LINE_LENGTH];
+	FILE *file = NULL;
+	uintptr_t i = 0;
+
+	portLibrary->str_printf(portLibrary, fileName, sizeof(fileName), "%s/proc/self/mountinfo", root);
+	file = fopen(fileName, "r");
+	if (NULL == file) {
+		for (i = 0; i < CGROUP_UNIFIED; i++) {
+			char mountPoint[PATH_MAX];
+			portLibrary->str_printf(portLibrary, mountPoint, sizeof(mountPoint), "/sys/fs/cgroup/%s", cgroupControllerNames[i]);
+			setCgroupDirectory(portLibrary, &hierarchies[i], root, "/", mountPoint);
+		}
+		setCgroupDirectory(portLibrary, &hierarchies[CGROUP_UNIFIED], root, "/", "/sys/fs/cgroup");
+		return;
+	}
+
+	while (NULL != fgets(line, sizeof(line), file)) {
+		char *separator = strstr(line, " - ");
+		char *fields[5] = { NULL };
+		char *fsType = NULL;
+		char *superOptions = NULL;
+		char *state = NULL;
+		char *token = NULL;
+		uintptr_t fieldCount = 0;
+
+		if (NULL == separator) {
+			continue;
+		}
+		*separator = '\0';
+		for (token = strtok_r(line, " ", &state); (NULL != token) && (fieldCount < 5); token = strtok_r(NULL, " ", &state)) {
+			fields[fieldCount] = token;
+			fieldCount += 1;
+		}
+		fsType = strtok_r(separator + 3, " ", &state);
+		(void) strtok_r(NULL, " ", &state);
+		superOptions = strtok_r(NULL, " \n", &state);
+		if ((5 != fieldCount) || (NULL == fsType) || (NULL == superOptions)) {
+			continue;
+		}
+
+		if (0 == strcmp(fsType, "cgroup2")) {
+			setCgroupDirectory(portLibrary, &hierarchies[CGROUP_UNIFIED], root, fields[3], fields[4]);
+		} else if (0 == strcmp(fsType, "cgroup")) {
+			for (i = 0; i < CGROUP_UNIFIED; i++) {
+				if (cgroupListContains(superOptions, cgroupControllerNames[i])) {
+					setCgroupDirectory(portLibrary, &hierarchies[i], root, fields[3], fields[4]);
+				}
+			}
+		}
+	}
+	fclose(file);
+}
+
+/**
+ * @internal
+ * Read the first line of a file of a cgroup, without its line terminator.
+ */
+static BOOLEAN
+readCgroupFile(struct OMRPortLibrary *portLibrary, const char *directory, const char *name, char *buffer, uintptr_t bufferLength)
+{
+	char fileName[PATH_MAX];
+	FILE *file = NULL;
+	BOOLEAN result = FALSE;
+
+	portLibrary->str_printf(portLibrary, fileName, sizeof(fileName), "%s/%s", directory, name);
+	file = fopen(fileName, "r");
+	if (NULL != file) {
+		if (NULL != fgets(buffer, (int)bufferLength, file)) {
+			buffer[strcspn(buffer, "\n")] = '\0';
+			result = TRUE;
+		}
+		fclose(file);
+	}
+	return result;
+}
+
+/**
+ * @internal
+ * Parse a cgroup limit, where "max" (version 2) and negative values (version 1) mean no limit.
+ */
+static uint64_t
+parseCgroupValue(const char *value)
+{
+	uint64_t result = OMRPORT_CGROUP_NOT_LIMITED;
+
+	if (('-' != value[0]) && (0 != strncmp(value, "max", 3))) {
+		char *end = NULL;
+		uint64_t parsed = strtoull(value, &end, 10);
+		if (end != value) {
+			result = parsed;
+		}
+	}
+	return result;
+}
+
+/**
+ * @internal
+ * Count the CPUs in a cpuset list such as "0-3,8,10-11".
+ */
+static uint64_t
+countCgroupCpus(const char *list)
+{
+	uint64_t count = 0;
+	const char *cursor = list;
+
+	while ('\0' != *cursor) {
+		char *end = NULL;
+		uint64_t first = strtoull(cursor, &end, 10);
+		uint64_t last = first;
+
+		if (end == cursor) {
+			break;
+		}
+		if ('-' == *end) {
+			cursor = end + 1;
+			last = strtoull(cursor, &end, 10);
+			if (end == cursor) {
+				break;
+			}
+		}
+		if (last >= first) {
+			count += (last - first) + 1;
+		}
+		cursor = end;
+		if (',' != *cursor) {
+			break;
+		}
+		cursor += 1;
+	}
+	return (0 == count) ? OMRPORT_CGROUP_NOT_LIMITED : count;
+}
+
+/**
+ * @internal
+ * Move directory to the parent group.
+ *
+ * @return FALSE if directory is already the root of the mounted hierarchy.
+ */
+static BOOLEAN
+cgroupParent(char *directory, uintptr_t mountLength)
+{
+	char *lastSeparator = NULL;
+
+	if (strlen(directory) <= mountLength) {
+		return FALSE;
+	}
+	lastSeparator = strrchr(directory + mountLength, '/');
+	if (NULL == lastSeparator) {
+		return FALSE;
+	}
+	*lastSeparator = '\0';
+	return TRUE;
+}
+
+/**
+ * @internal
+ * Read the CPU quota, keeping the tightest ratio of quota to period between the process's group
+ * and the root, and the CPU weight of the process's group.
+ */
+static void
+readCgroupCpu(struct OMRPortLibrary *portLibrary, CgroupHierarchy *hierarchy, uint32_t version, J9SysinfoCgroupLimits *limits)
+{
+	char directory[PATH_MAX];
+	char value[CGROUP_VALUE_LENGTH];
+
+	portLibrary->str_printf(portLibrary, directory, sizeof(directory), "%s", hierarchy->directory);
+	do {
+		uint64_t quota = OMRPORT_CGROUP_NOT_LIMITED;
+		uint64_t period = OMRPORT_CGROUP_NOT_LIMITED;
+
+		if (1 == version) {
+			if (readCgroupFile(portLibrary, directory, "cpu.cfs_quota_us", value, sizeof(value))) {
+				quota = parseCgroupValue(value);
+			}
+			if (readCgroupFile(portLibrary, directory, "cpu.cfs_period_us", value, sizeof(value))) {
+				period = parseCgroupValue(value);
+			}
+		} else if (readCgroupFile(portLibrary, directory, "cpu.max", value, sizeof(value))) {
+			/* cpu.max holds "quota period" where the quota may be "max" */
+			char *periodValue = strchr(value, ' ');
+			quota = parseCgroupValue(value);
+			if (NULL != periodValue) {
+				period = parseCgroupValue(periodValue + 1);
+			}
+		}
+
+		if ((OMRPORT_CGROUP_NOT_LIMITED != quota) && (OMRPORT_CGROUP_NOT_LIMITED != period) && (0 != period)) {
+			if ((OMRPORT_CGROUP_NOT_LIMITED == limits->cpuQuota) || ((quota * limits->cpuPeriod) < (limits->cpuQuota * period))) {
+				limits->cpuQuota = quota;
+				limits->cpuPeriod = period;
+			}
+		}
+	} while (cgroupParent(directory, hierarchy->mountLength));
+
+	if (readCgroupFile(portLibrary, hierarchy->directory, (1 == version) ? "cpu.shares" : "cpu.weight", value, sizeof(value))) {
+		limits->cpuShares = parseCgroupValue(value);
+	}
+}
+
+/**
+ * @internal
+ * Read the cpuset of the nearest group which has one, starting from the process's group.
+ */
+static void
+readCgroupCpuset(struct OMRPortLibrary *portLibrary, CgroupHierarchy *hierarchy, uint32_t version, J9SysinfoCgroupLimits *limits)
+{
+	char directory[PATH_MAX];
+	char value[CGROUP_LINE_LENGTH];
+
+	portLibrary->str_printf(portLibrary, directory, sizeof(directory), "%s", hierarchy->directory);
+	do {
+		if (readCgroupFile(portLibrary, directory, (1 == version) ? "cpuset.cpus" : "cpuset.cpus.effective", value, sizeof(value))) {
+			limits->cpusetCount = countCgroupCpus(value);
+			break;
+		}
+	} while (cgroupParent(directory, hierarchy->mountLength));
+}
+
+/**
+ * @internal
+ * Read the memory limit, keeping the lowest between the process's group and the root.
+ */
+static void
+readCgroupMemory(struct OMRPortLibrary *portLibrary, CgroupHierarchy *hierarchy, uint32_t version, J9SysinfoCgroupLimits *limits)
+{
+	char directory[PATH_MAX];
+	char value[CGROUP_VALUE_LENGTH];
+
+	portLibrary->str_printf(portLibrary, directory, sizeof(directory), "%s", hierarchy->directory);
+	do {
+		if (readCgroupFile(portLibrary, directory, (1 == version) ? "memory.limit_in_bytes" : "memory.max", value, sizeof(value))) {
+			uint64_t limit = parseCgroupValue(value);
+			if ((1 == version) && (limit >= CGROUP_V1_MEMORY_UNLIMITED)) {
+				limit = OMRPORT_CGROUP_NOT_LIMITED;
+			}
+			if (limit < limits->memoryLimit) {
+				limits->memoryLimit = limit;
+			}
+		}
+	} while (cgroupParent(directory, hierarchy->mountLength));
+}
+
+/**
+ * @internal
+ * Set the directory cgroup files are looked up below, for the OMRPORT_CTLDATA_SYSINFO_CGROUP_ROOT
+ * omrport_control key, and refresh the CPU limit cached for OMRPORT_CPU_TARGET.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] root The directory, or NULL to use the real /proc and /sys/fs/cgroup.
+ *
+ * @return 0 on success, 1 if the directory name could not be copied.
+ */
+int32_t
+setCgroupRoot(struct OMRPortLibrary *portLibrary, const char *root)
+{
+	J9SysinfoCgroupLimits limits;
+	char *copy = NULL;
+
+	if (NULL != root) {
+		copy = portLibrary->mem_allocate_memory(portLibrary, strlen(root) + 1, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == copy) {
+			return 1;
+		}
+		strcpy(copy, root);
+	}
+	if (NULL != PPG_si_cgroupRoot) {
+		portLibrary->mem_free_memory(portLibrary, PPG_si_cgroupRoot);
+	}
+	PPG_si_cgroupRoot = copy;
+
+	(void) omrsysinfo_get_cgroup_limits(portLibrary, &limits);
+	return 0;
+}
+
+#endif /* defined(LINUX) */
+
+int32_t
+omrsysinfo_get_cgroup_limits(struct OMRPortLibrary *portLibrary, struct J9SysinfoCgroupLimits *limits)
+{
+	int32_t ret = OMRPORT_ERROR_SYSINFO_NOT_SUPPORTED;
+
+	Trc_PRT_sysinfo_get_cgroup_limits_Entry();
+	if (NULL == limits) {
+		ret = OMRPORT_ERROR_SYSINFO_NULL_OBJECT_RECEIVED;
+		Trc_PRT_sysinfo_get_cgroup_limits_Exit(ret, 0, 0, 0);
+		return ret;
+	}
+	limits->version = 0;
+	limits->cpuQuota = OMRPORT_CGROUP_NOT_LIMITED;
+	limits->cpuPeriod = OMRPORT_CGROUP_NOT_LIMITED;
+	limits->cpuShares = OMRPORT_CGROUP_NOT_LIMITED;
+	limits->cpusetCount = OMRPORT_CGROUP_NOT_LIMITED;
+	limits->cpuLimit = OMRPORT_CGROUP_NOT_LIMITED;
+	limits->memoryLimit = OMRPORT_CGROUP_NOT_LIMITED;
+
+#if defined(LINUX)
+	{
+		const char *root = (NULL == PPG_si_cgroupRoot) ? "" : PPG_si_cgroupRoot;
+		CgroupHierarchy *hierarchies = portLibrary->mem_allocate_memory(portLibrary, CGROUP_HIERARCHY_COUNT * sizeof(CgroupHierarchy), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+
+		if (NULL == hierarchies) {
+			ret = OMRPORT_ERROR_SYSINFO_MEMORY_ALLOC_FAILED;
+			Trc_PRT_sysinfo_get_cgroup_limits_Exit(ret, 0, 0, 0);
+			return ret;
+		}
+		memset(hierarchies, 0, CGROUP_HIERARCHY_COUNT * sizeof(CgroupHierarchy));
+
+		if (readCgroupPaths(portLibrary, hierarchies, root)) {
+			readCgroupMounts(portLibrary, hierarchies, root);
+		}
+
+		/* Controllers still attached to version 1 hierarchies take precedence over the unified hierarchy. */
+		if (hierarchies[CGROUP_CPU].hasDirectory || hierarchies[CGROUP_CPUSET].hasDirectory || hierarchies[CGROUP_MEMORY].hasDirectory) {
+			limits->version = 1;
+			if (hierarchies[CGROUP_CPU].hasDirectory) {
+				readCgroupCpu(portLibrary, &hierarchies[CGROUP_CPU], 1, limits);
+			}
+			if (hierarchies[CGROUP_CPUSET].hasDirectory) {
+				readCgroupCpuset(portLibrary, &hierarchies[CGROUP_CPUSET], 1, limits);
+			}
+			if (hierarchies[CGROUP_MEMORY].hasDirectory) {
+				readCgroupMemory(portLibrary, &hierarchies[CGROUP_MEMORY], 1, limits);
+			}
+		} else if (hierarchies[CGROUP_UNIFIED].hasDirectory) {
+			limits->version = 2;
+			readCgroupCpu(portLibrary, &hierarchies[CGROUP_UNIFIED], 2, limits);
+			readCgroupCpuset(portLibrary, &hierarchies[CGROUP_UNIFIED], 2, limits);
+			readCgroupMemory(portLibrary, &hierarchies[CGROUP_UNIFIED], 2, limits);
+		} else {
+			Trc_PRT_sysinfo_get_cgroup_limits_cgroupNotFound();
+		}
+		portLibrary->mem_free_memory(portLibrary, hierarchies);
+
+		if (OMRPORT_CGROUP_NOT_LIMITED != limits->cpuQuota) {
+			/* a partial CPU still needs a thread to use it */
+			limits->cpuLimit = (limits->cpuQuota + limits->cpuPeriod - 1) / limits->cpuPeriod;
+			if (0 == limits->cpuLimit) {
+				limits->cpuLimit = 1;
+			}
+		}
+		if (limits->cpusetCount < limits->cpuLimit) {
+			limits->cpuLimit = limits->cpusetCount;
+		}
+		PPG_si_cgroupCpuLimit = limits->cpuLimit;
+		ret = 0;
+	}
+#endif /* defined(LINUX) */
+
+	Trc_PRT_sysinfo_get_cgroup_limits_Exit(ret, limits->version, limits->cpuLimit, limits->memoryLimit);
+	return ret;
+}
@@ -76,6 +76,11 @@ typedef struct OMRPortPlatformGlobals {
 #if defined(OMR_CONFIGURABLE_SUSPEND_SIGNAL)
 	int32_t introspect_threadSuspendSignal;
 #endif /* defined(OMR_CONFIGURABLE_SUSPEND_SIGNAL) */
+#if defined(LINUX)
+	char *si_cgroupRoot; /** <directory the cgroup files are looked up below, NULL for the real root */
+	uint64_t si_cgroupCpuLimit; /** <cgroup CPU limit applied to OMRPORT_CPU_TARGET */
+	uintptr_t vmem_transparentHugePageSize; /** <size of a transparent huge page, 0 if they are disabled */
+#endif /* defined(LINUX) */
 } OMRPortPlatformGlobals;
 
 
@@ -113,5 +118,11 @@ typedef struct OMRPortPlatformGlobals {
 #define PPG_introspect_threadSuspendSignal (portLibrary->portGlobals->platformGlobals.introspect_threadSuspendSignal)
 #endif
 
+#if defined(LINUX)
+#define PPG_si_cgroupRoot (portLibrary->portGlobals->platformGlobals.si_cgroupRoot)
+#define PPG_si_cgroupCpuLimit (portLibrary->portGlobals->platformGlobals.si_cgroupCpuLimit)
+#define PPG_vmem_transparentHugePageSize (portLibrary->portGlobals->platformGlobals.vmem_transparentHugePageSize)
+#endif /* defined(LINUX) */
+
 #endif /* omrportpg_h */
 
@@ -1576,3 +1576,9 @@ omrsysinfo_get_open_file_count(struct OMRPortLibrary *portLibrary, uint64_t *cou
 	return OMRPORT_ERROR_SYSINFO_GET_OPEN_FILES_NOT_SUPPORTED;
 }
 
+
+int32_t
+omrsysinfo_get_cgroup_limits(struct OMRPortLibrary *portLibrary, struct J9SysinfoCgroupLimits *limits)
+{
+	return OMRPORT_ERROR_SYSINFO_NOT_SUPPORTED;
+}
@@ -71,6 +71,10 @@ static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t mo
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 static intptr_t init_spinCounts(omrthread_library_t lib);
 static void unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor);
+#if defined(LINUX)
+static intptr_t monitor_block_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, int *blockedCount);
+static void monitor_release_futex(omrthread_monitor_t monitor);
+#endif /* defined(LINUX) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 static intptr_t init_threadParam(char *name, uintptr_t *pDefault);
@@ -309,6 +313,18 @@ omrthread_init(omrthread_library_t lib)
 	lib->flags |= J9THREAD_LIB_FLAG_DESTROY_MUTEX_ON_MONITOR_FREE;
 #endif
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX)
+	/* Monitors can't switch between blocking on their mutex and blocking on a futex while
+	 * threads are queued on them, so the choice is made once here for the library.
+	 */
+	{
+		const char *futexMonitors = getenv("OMR_THREAD_FUTEX_MONITORS");
+		if ((NULL != futexMonitors) && (0 != strcmp(futexMonitors, "0"))) {
+			lib->flags |= J9THREAD_LIB_FLAG_FUTEX_MONITORS;
+		}
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+
 	if (omrthread_attr_init(&lib->systemThreadAttr) != J9THREAD_SUCCESS) {
 		goto init_cleanup10;
 	}
@@ -1018,6 +1034,9 @@ omrthread_lib_set_flags(uintptr_t flags)
 	ASSERT(self);
 	ASSERT(self->library);
 
+	/* J9THREAD_LIB_FLAG_FUTEX_MONITORS can only be selected by omrthread_init() */
+	flags &= ~(uintptr_t)J9THREAD_LIB_FLAG_FUTEX_MONITORS;
+
 	GLOBAL_LOCK(self, CALLER_LIB_SET_FLAGS);
 	oldFlags = self->library->flags;
 	self->library->flags |= flags;
@@ -1044,6 +1063,9 @@ omrthread_lib_clear_flags(uintptr_t flags)
 	ASSERT(self);
 	ASSERT(self->library);
 
+	/* J9THREAD_LIB_FLAG_FUTEX_MONITORS can only be selected by omrthread_init() */
+	flags &= ~(uintptr_t)J9THREAD_LIB_FLAG_FUTEX_MONITORS;
+
 	GLOBAL_LOCK(self, CALLER_LIB_CLEAR_FLAGS);
 	oldFlags = self->library->flags;
 	self->library->flags &= ~flags;
@@ -2741,6 +2763,13 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	monitor = threadToInterrupt->monitor;
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX)
+	if (IS_FUTEX_MONITOR_LIB(self->library)) {
+		/* The thread may be asleep on the monitor's futex rather than on its condition */
+		omrthread_futex_wake(monitor, TRUE);
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
 		NOTIFY_WRAPPER(threadToInterrupt);
 	} else {
@@ -3560,6 +3589,9 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(LINUX)
+	monitor->futexSequence = 0;
+#endif /* defined(LINUX) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3801,6 +3833,20 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 
 	while (1) {
 
+#if defined(LINUX)
+		if (IS_FUTEX_MONITOR_LIB(self->library)) {
+			if (0 != omrthread_spinlock_acquire_bounded(self, monitor)) {
+				if (J9THREAD_INTERRUPTED_MONITOR_ENTER == monitor_block_futex(self, monitor, isAbortable, &blockedCount)) {
+					return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+				}
+			}
+			monitor->owner = self;
+			monitor->count = 1;
+			ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+			break;
+		}
+#endif /* defined(LINUX) */
+
 		if (omrthread_spinlock_acquire(self, monitor) == 0) {
 			monitor->owner = self;
 			monitor->count = 1;
@@ -3880,8 +3926,10 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 		self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
 		self->monitor = 0;
 
-		/* Check for abort that may have occurred after we got the monitor. */
-		if (self->flags & J9THREAD_FLAG_ABORTED) {
+		/* Check for abort that may have occurred after we got the monitor.
+		 * A plain enter which had to block on a futex monitor is not abortable and keeps the monitor.
+		 */
+		if ((self->flags & J9THREAD_FLAG_ABORTED) && ((SET_ABORTABLE == isAbortable) || !IS_FUTEX_MONITOR_LIB(self->library))) {
 			THREAD_UNLOCK(self);
 			monitor_exit(self, monitor);
 			return J9THREAD_INTERRUPTED_MONITOR_ENTER;
@@ -3899,6 +3947,76 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX)
+/**
+ * Block on a futex monitor until its spinlock has been acquired.
+ *
+ * The spinlock state is used as a futex mutex word: a blocking thread swaps in
+ * SPINLOCK_EXCEEDED, so that whoever releases the spinlock knows to wake a sleeper,
+ * and then sleeps on the monitor's futexSequence. The monitor's mutex is not used.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to enter
+ * @param[in] isAbortable whether omrthread_abort() may interrupt the enter
+ * @param[in,out] blockedCount incremented each time the thread sleeps
+ * @return 0 once the spinlock is owned, J9THREAD_INTERRUPTED_MONITOR_ENTER if the thread was aborted
+ */
+static intptr_t
+monitor_block_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, int *blockedCount)
+{
+	THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+	if (SET_ABORTABLE == isAbortable) {
+		self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+	} else {
+		self->flags |= J9THREAD_FLAG_BLOCKED;
+	}
+	self->monitor = monitor;
+	THREAD_UNLOCK(self);
+
+	while (1) {
+		/* Read the sequence before checking for abort and trying the spinlock so that a
+		 * wake from either omrthread_abort() or the owner's exit can't be missed.
+		 */
+		uint32_t sequence = monitor->futexSequence;
+		issueReadBarrier();
+
+		if (SET_ABORTABLE == isAbortable) {
+			THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER4);
+			if (self->flags & J9THREAD_FLAG_ABORTED) {
+				self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+				self->monitor = 0;
+				THREAD_UNLOCK(self);
+				/* This thread may have consumed the wake meant for the next owner; pass it on */
+				omrthread_futex_wake(monitor, FALSE);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			THREAD_UNLOCK(self);
+		}
+
+		if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+			return 0;
+		}
+
+		*blockedCount += 1;
+		omrthread_futex_wait(monitor, sequence);
+	}
+}
+
+/**
+ * Release a futex monitor's spinlock, waking one sleeping thread if any may be waiting.
+ *
+ * @param[in] monitor monitor whose spinlock is owned by the current thread
+ */
+static void
+monitor_release_futex(omrthread_monitor_t monitor)
+{
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_wake(monitor, FALSE);
+	}
+}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+
+
 #if (defined(OMR_THR_THREE_TIER_LOCKING))
 /**
  * Notify all threads blocked on the monitor's mutex, waiting
@@ -4109,6 +4227,12 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		UPDATE_JLM_MON_EXIT(self, monitor);
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
+#if defined(LINUX)
+		if (IS_FUTEX_MONITOR_LIB(self->library)) {
+			monitor_release_futex(monitor);
+			return 0;
+		}
+#endif /* defined(LINUX) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
  		MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
@@ -4367,16 +4491,23 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
 	MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT);
+#if defined(LINUX)
+	if (IS_FUTEX_MONITOR_LIB(self->library)) {
+		monitor_release_futex(monitor);
+	} else
+#endif /* defined(LINUX) */
+	{
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
-	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
-	if (0 == monitor->spinThreads) {
-		unblock_spinlock_threads(self, monitor);
-	}
+		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+		if (0 == monitor->spinThreads) {
+			unblock_spinlock_threads(self, monitor);
+		}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
-	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
-		unblock_spinlock_threads(self, monitor);
-	}
+		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+			unblock_spinlock_threads(self, monitor);
+		}
 #endif  /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	}
 	self->lockedmonitorcount--;
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 
@@ -4625,16 +4756,23 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	monitor->count = 0;
 
 	MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT);
+#if defined(LINUX)
+	if (IS_FUTEX_MONITOR_LIB(self->library)) {
+		monitor_release_futex(monitor);
+	} else
+#endif /* defined(LINUX) */
+	{
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
-	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
-	if (0 == monitor->spinThreads) {
-		unblock_spinlock_threads(self, monitor);
-	}
+		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+		if (0 == monitor->spinThreads) {
+			unblock_spinlock_threads(self, monitor);
+		}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
-	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
-		unblock_spinlock_threads(self, monitor);
-	}
+		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+			unblock_spinlock_threads(self, monitor);
+		}
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	}
 	self->lockedmonitorcount--;
 
 	threadEnqueue(&monitor->waiting, self);
@@ -4961,6 +5099,10 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 	}
 
 	MONITOR_LOCK(monitor, CALLER_NOTIFY_ONE_OR_ALL);
+	/* Notified threads normally sleep on until the monitor is released. Futex monitors
+	 * don't wake the blocking queue on release, so they are woken now to contend for the
+	 * monitor on its futex instead.
+	 */
 	queue = monitor->waiting;
 	if (queue) {
 		intptr_t state;
@@ -4976,6 +5118,11 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 				queue->flags &= ~J9THREAD_FLAG_WAITING;
 				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 				Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+#if defined(LINUX)
+				if (IS_FUTEX_MONITOR_LIB(self->library)) {
+					NOTIFY_WRAPPER(queue);
+				}
+#endif /* defined(LINUX) */
 				THREAD_UNLOCK(queue);
 
 				queue = queue->next;
@@ -5001,6 +5148,11 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 			queue->flags &= ~J9THREAD_FLAG_WAITING;
 			queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+#if defined(LINUX)
+			if (IS_FUTEX_MONITOR_LIB(self->library)) {
+				NOTIFY_WRAPPER(queue);
+			}
+#endif /* defined(LINUX) */
 			THREAD_UNLOCK(queue);
 
 			threadDequeue(&monitor->waiting, queue);
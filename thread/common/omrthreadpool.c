@@ -0,0 +1,757 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2017
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Work-stealing task pool for the Thread library.
+ *
+ * Each worker owns a deque of tasks. A worker pushes and pops at the bottom of its own
+ * deque without locking, and idle workers steal from the top of other workers' deques.
+ * Tasks submitted by threads which are not workers of the pool go on a shared queue
+ * protected by the pool's monitor.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "omrutilbase.h"
+#include "threaddef.h"
+#include "thread_internal.h"
+
+#define POOL_DEQUE_INITIAL_SIZE  256
+
+typedef struct J9ThreadPoolTask {
+	omrthread_pool_task_t function;
+	void *userData;
+	J9ThreadPoolJoin *join;
+	struct J9ThreadPoolTask *next;
+} J9ThreadPoolTask;
+
+typedef struct J9ThreadPoolTaskArray {
+	uintptr_t size;
+	struct J9ThreadPoolTaskArray *retired;
+	J9ThreadPoolTask *volatile tasks[1];
+} J9ThreadPoolTaskArray;
+
+typedef struct J9ThreadPoolWorker {
+	struct J9ThreadPool *pool;
+	uintptr_t index;
+	omrthread_t thread;
+	BOOLEAN active;
+	/* top is written by thieves, bottom and the counters only by the owner */
+	volatile intptr_t top;
+	uint8_t padding1[128];
+	volatile intptr_t bottom;
+	J9ThreadPoolTaskArray *volatile array;
+	uint64_t tasksExecuted;
+	uint64_t steals;
+	uint64_t idleTime;
+	uint8_t padding2[128];
+} J9ThreadPoolWorker;
+
+typedef struct J9ThreadPool {
+	omrthread_monitor_t monitor;
+	omrthread_tls_key_t workerKey;
+	char *name;
+	uintptr_t minWorkers;
+	uintptr_t maxWorkers;
+	int64_t idleTimeoutMillis;
+	volatile uintptr_t workerCount;
+	uintptr_t peakWorkerCount;
+	uintptr_t slotsInUse;
+	volatile uintptr_t idleThreads;
+	BOOLEAN shutdown;
+	J9ThreadPoolTask *volatile sharedHead;
+	J9ThreadPoolTask *sharedTail;
+	uintptr_t sharedCount;
+	uintptr_t *numaNodes;
+	uintptr_t numaNodeCount;
+	volatile uintptr_t externalTasksExecuted;
+	volatile uintptr_t externalSteals;
+	J9ThreadPoolWorker *workers;
+} J9ThreadPool;
+
+static J9ThreadPoolTaskArray *allocateTaskArray(omrthread_library_t lib, uintptr_t size);
+static BOOLEAN pushTask(J9ThreadPoolWorker *worker, J9ThreadPoolTask *task);
+static J9ThreadPoolTask *popTask(J9ThreadPoolWorker *worker);
+static J9ThreadPoolTask *stealTask(J9ThreadPoolWorker *victim);
+static J9ThreadPoolTask *takeSharedTask(J9ThreadPool *pool);
+static J9ThreadPoolTask *findTask(J9ThreadPool *pool, J9ThreadPoolWorker *worker);
+static BOOLEAN hasWork(J9ThreadPool *pool);
+static void runTask(J9ThreadPool *pool, J9ThreadPoolWorker *worker, J9ThreadPoolTask *task);
+static void wakeIdleThreads(J9ThreadPool *pool, BOOLEAN all);
+static intptr_t startWorker(J9ThreadPool *pool);
+static int32_t J9THREAD_PROC workerMain(void *entryArg);
+
+/**
+ * Create a task pool.
+ *
+ * The pool starts minWorkers workers. If maxWorkers is larger, the pool is elastic: a
+ * submission which finds no idle thread starts another worker, up to maxWorkers, and
+ * workers above minWorkers exit after being idle for idleTimeoutMillis.
+ *
+ * @param[out] handle pointer to be set to the new pool
+ * @param[in] name name given to the worker threads, may be NULL
+ * @param[in] minWorkers number of workers kept alive, at least 1
+ * @param[in] maxWorkers maximum number of workers, at least minWorkers
+ * @param[in] idleTimeoutMillis how long a worker above minWorkers waits for work before exiting, 0 to keep it
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL otherwise
+ *
+ * @see omrthread_pool_destroy
+ */
+intptr_t
+omrthread_pool_create(omrthread_pool_t *handle, const char *name, uintptr_t minWorkers, uintptr_t maxWorkers, int64_t idleTimeoutMillis)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	J9ThreadPool *pool = NULL;
+	uintptr_t i = 0;
+
+	if ((0 == minWorkers) || (maxWorkers < minWorkers) || (idleTimeoutMillis < 0)) {
+		return J9THREAD_POOL_FAIL;
+	}
+
+	pool = (J9ThreadPool *)omrthread_allocate_memory(lib, sizeof(J9ThreadPool), OMRMEM_CATEGORY_THREADS);
+	if (NULL == pool) {
+		return J9THREAD_POOL_FAIL;
+	}
+	memset(pool, 0, sizeof(J9ThreadPool));
+	pool->minWorkers = minWorkers;
+	pool->maxWorkers = maxWorkers;
+	pool->idleTimeoutMillis = idleTimeoutMillis;
+
+	if (NULL != name) {
+		pool->name = (char *)omrthread_allocate_memory(lib, strlen(name) + 1, OMRMEM_CATEGORY_THREADS);
+		if (NULL == pool->name) {
+			goto fail;
+		}
+		strcpy(pool->name, name);
+	}
+
+	pool->workers = (J9ThreadPoolWorker *)omrthread_allocate_memory(lib, maxWorkers * sizeof(J9ThreadPoolWorker), OMRMEM_CATEGORY_THREADS);
+	if (NULL == pool->workers) {
+		goto fail;
+	}
+	memset(pool->workers, 0, maxWorkers * sizeof(J9ThreadPoolWorker));
+	for (i = 0; i < maxWorkers; i++) {
+		J9ThreadPoolWorker *worker = &pool->workers[i];
+		worker->pool = pool;
+		worker->index = i;
+		worker->array = allocateTaskArray(lib, POOL_DEQUE_INITIAL_SIZE);
+		if (NULL == worker->array) {
+			goto fail;
+		}
+	}
+
+	if (0 != omrthread_tls_alloc(&pool->workerKey)) {
+		pool->workerKey = 0;
+		goto fail;
+	}
+	if (0 != omrthread_monitor_init_with_name(&pool->monitor, 0, "&pool->monitor")) {
+		pool->monitor = NULL;
+		goto fail;
+	}
+
+	omrthread_monitor_enter(pool->monitor);
+	for (i = 0; i < minWorkers; i++) {
+		if (J9THREAD_POOL_OK != startWorker(pool)) {
+			omrthread_monitor_exit(pool->monitor);
+			omrthread_pool_destroy(pool);
+			return J9THREAD_POOL_FAIL;
+		}
+	}
+	omrthread_monitor_exit(pool->monitor);
+
+	*handle = pool;
+	return J9THREAD_POOL_OK;
+
+fail:
+	omrthread_pool_destroy(pool);
+	return J9THREAD_POOL_FAIL;
+}
+
+/**
+ * Destroy a task pool.
+ *
+ * Tasks which have already been submitted are run before the workers exit. No tasks
+ * may be submitted once destroy has been called.
+ *
+ * @param[in] pool the pool to destroy
+ * @return J9THREAD_POOL_OK
+ */
+intptr_t
+omrthread_pool_destroy(omrthread_pool_t pool)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	uintptr_t i = 0;
+
+	if (NULL != pool->monitor) {
+		omrthread_monitor_enter(pool->monitor);
+		pool->shutdown = TRUE;
+		omrthread_monitor_notify_all(pool->monitor);
+		while (0 != pool->workerCount) {
+			omrthread_monitor_wait(pool->monitor);
+		}
+		omrthread_monitor_exit(pool->monitor);
+		omrthread_monitor_destroy(pool->monitor);
+	}
+	if (0 != pool->workerKey) {
+		omrthread_tls_free(pool->workerKey);
+	}
+
+	if (NULL != pool->workers) {
+		for (i = 0; i < pool->maxWorkers; i++) {
+			J9ThreadPoolTaskArray *array = pool->workers[i].array;
+			while (NULL != array) {
+				J9ThreadPoolTaskArray *retired = array->retired;
+				omrthread_free_memory(lib, array);
+				array = retired;
+			}
+		}
+		omrthread_free_memory(lib, pool->workers);
+	}
+	if (NULL != pool->numaNodes) {
+		omrthread_free_memory(lib, pool->numaNodes);
+	}
+	if (NULL != pool->name) {
+		omrthread_free_memory(lib, pool->name);
+	}
+	omrthread_free_memory(lib, pool);
+
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Initialize a join counter before tasks are submitted against it.
+ *
+ * @param[in] join the join counter
+ */
+void
+omrthread_pool_join_init(J9ThreadPoolJoin *join)
+{
+	join->pending = 0;
+}
+
+/**
+ * Submit a task to a pool.
+ *
+ * A worker of the pool pushes the task on its own deque; any other attached thread
+ * puts it on the pool's shared queue.
+ *
+ * @param[in] pool the pool which will run the task
+ * @param[in] function the function to run
+ * @param[in] userData the argument passed to function
+ * @param[in] join a join counter which counts the task until it has run, may be NULL
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL if the task could not be allocated
+ */
+intptr_t
+omrthread_pool_submit(omrthread_pool_t pool, omrthread_pool_task_t function, void *userData, J9ThreadPoolJoin *join)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	J9ThreadPoolWorker *worker = (J9ThreadPoolWorker *)omrthread_tls_get(MACRO_SELF(), pool->workerKey);
+	J9ThreadPoolTask *task = (J9ThreadPoolTask *)omrthread_allocate_memory(lib, sizeof(J9ThreadPoolTask), OMRMEM_CATEGORY_THREADS);
+
+	if (NULL == task) {
+		return J9THREAD_POOL_FAIL;
+	}
+	task->function = function;
+	task->userData = userData;
+	task->join = join;
+	task->next = NULL;
+	if (NULL != join) {
+		addAtomic(&join->pending, 1);
+	}
+
+	if ((NULL == worker) || !pushTask(worker, task)) {
+		omrthread_monitor_enter(pool->monitor);
+		if (NULL == pool->sharedHead) {
+			pool->sharedHead = task;
+		} else {
+			pool->sharedTail->next = task;
+		}
+		pool->sharedTail = task;
+		pool->sharedCount += 1;
+		/* idle threads which have been notified but have not yet woken are still counted as idle */
+		if ((pool->sharedCount > pool->idleThreads) && (pool->workerCount < pool->maxWorkers)) {
+			startWorker(pool);
+		}
+		omrthread_monitor_notify(pool->monitor);
+		omrthread_monitor_exit(pool->monitor);
+	} else {
+		/* pairs with the barrier a thread issues after counting itself idle and before looking for work */
+		issueReadWriteBarrier();
+		if (0 != pool->idleThreads) {
+			wakeIdleThreads(pool, FALSE);
+		} else if (pool->workerCount < pool->maxWorkers) {
+			omrthread_monitor_enter(pool->monitor);
+			if ((0 == pool->idleThreads) && (pool->workerCount < pool->maxWorkers)) {
+				startWorker(pool);
+			}
+			omrthread_monitor_exit(pool->monitor);
+		}
+	}
+
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Wait until every task counted by a join counter has run.
+ *
+ * The calling thread runs tasks from the pool while it waits, so a task may submit
+ * and join subtasks without tying up a worker. A join counter with a single task
+ * serves as a future, the task leaving its result in memory reached through userData.
+ *
+ * @param[in] pool the pool the tasks were submitted to
+ * @param[in] join the join counter
+ * @return J9THREAD_POOL_OK
+ */
+intptr_t
+omrthread_pool_join(omrthread_pool_t pool, J9ThreadPoolJoin *join)
+{
+	J9ThreadPoolWorker *worker = (J9ThreadPoolWorker *)omrthread_tls_get(MACRO_SELF(), pool->workerKey);
+
+	while (0 != join->pending) {
+		J9ThreadPoolTask *task = findTask(pool, worker);
+		if (NULL != task) {
+			runTask(pool, worker, task);
+			continue;
+		}
+
+		omrthread_monitor_enter(pool->monitor);
+		pool->idleThreads += 1;
+		issueReadWriteBarrier();
+		if ((0 != join->pending) && !hasWork(pool)) {
+			omrthread_monitor_wait(pool->monitor);
+		}
+		pool->idleThreads -= 1;
+		omrthread_monitor_exit(pool->monitor);
+	}
+	/* the last task's writes happen before join->pending reaches zero */
+	issueReadBarrier();
+
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Restrict the pool's workers to a set of NUMA nodes. Running workers are moved
+ * immediately and workers started later inherit the affinity.
+ *
+ * @param[in] pool the pool
+ * @param[in] numaNodes array of node numbers, see omrthread_numa_set_node_affinity
+ * @param[in] nodeCount number of entries in numaNodes, 0 to clear the affinity
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL otherwise
+ */
+intptr_t
+omrthread_pool_set_numa_affinity(omrthread_pool_t pool, const uintptr_t *numaNodes, uintptr_t nodeCount)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	intptr_t rc = J9THREAD_POOL_OK;
+	uintptr_t *nodes = NULL;
+	uintptr_t i = 0;
+
+	if (0 != nodeCount) {
+		nodes = (uintptr_t *)omrthread_allocate_memory(lib, nodeCount * sizeof(uintptr_t), OMRMEM_CATEGORY_THREADS);
+		if (NULL == nodes) {
+			return J9THREAD_POOL_FAIL;
+		}
+		memcpy(nodes, numaNodes, nodeCount * sizeof(uintptr_t));
+	}
+
+	omrthread_monitor_enter(pool->monitor);
+	if (NULL != pool->numaNodes) {
+		omrthread_free_memory(lib, pool->numaNodes);
+	}
+	pool->numaNodes = nodes;
+	pool->numaNodeCount = nodeCount;
+	for (i = 0; i < pool->slotsInUse; i++) {
+		J9ThreadPoolWorker *worker = &pool->workers[i];
+		if (worker->active) {
+			if (0 != omrthread_numa_set_node_affinity(worker->thread, nodes, nodeCount, 0)) {
+				rc = J9THREAD_POOL_FAIL;
+			}
+		}
+	}
+	omrthread_monitor_exit(pool->monitor);
+
+	return rc;
+}
+
+/**
+ * Report statistics for a pool. The counters are read without stopping the workers,
+ * so they are only exact once the pool is quiescent.
+ *
+ * @param[in] pool the pool
+ * @param[out] stats the statistics
+ */
+void
+omrthread_pool_get_stats(omrthread_pool_t pool, J9ThreadPoolStats *stats)
+{
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(pool->monitor);
+	stats->tasksExecuted = pool->externalTasksExecuted;
+	stats->steals = pool->externalSteals;
+	stats->idleTime = 0;
+	for (i = 0; i < pool->slotsInUse; i++) {
+		J9ThreadPoolWorker *worker = &pool->workers[i];
+		stats->tasksExecuted += worker->tasksExecuted;
+		stats->steals += worker->steals;
+		stats->idleTime += worker->idleTime;
+	}
+	stats->workerCount = pool->workerCount;
+	stats->peakWorkerCount = pool->peakWorkerCount;
+	omrthread_monitor_exit(pool->monitor);
+}
+
+static J9ThreadPoolTaskArray *
+allocateTaskArray(omrthread_library_t lib, uintptr_t size)
+{
+	J9ThreadPoolTaskArray *array = (J9ThreadPoolTaskArray *)omrthread_allocate_memory(lib,
+		sizeof(J9ThreadPoolTaskArray) + ((size - 1) * sizeof(J9ThreadPoolTask *)), OMRMEM_CATEGORY_THREADS);
+	if (NULL != array) {
+		array->size = size;
+		array->retired = NULL;
+	}
+	return array;
+}
+
+/**
+ * Push a task on the bottom of a worker's own deque, growing the deque if it is full.
+ * Only the worker's own thread may call this.
+ *
+ * @return TRUE if the task was pushed, FALSE if the deque could not grow
+ */
+static BOOLEAN
+pushTask(J9ThreadPoolWorker *worker, J9ThreadPoolTask *task)
+{
+	intptr_t bottom = worker->bottom;
+	intptr_t top = worker->top;
+	J9ThreadPoolTaskArray *array = worker->array;
+
+	if ((bottom - top) >= (intptr_t)(array->size - 1)) {
+		/* Thieves may still be reading the old array, so it is kept until the pool is destroyed */
+		J9ThreadPoolTaskArray *grown = allocateTaskArray(GLOBAL_DATA(default_library), array->size * 2);
+		intptr_t i = 0;
+		if (NULL == grown) {
+			return FALSE;
+		}
+		for (i = top; i < bottom; i++) {
+			grown->tasks[i & (grown->size - 1)] = array->tasks[i & (array->size - 1)];
+		}
+		grown->retired = array;
+		issueWriteBarrier();
+		worker->array = grown;
+		array = grown;
+	}
+
+	array->tasks[bottom & (array->size - 1)] = task;
+	issueWriteBarrier();
+	worker->bottom = bottom + 1;
+	return TRUE;
+}
+
+/**
+ * Pop a task from the bottom of a worker's own deque. Only the worker's own thread may call this.
+ *
+ * @return the task, or NULL if the deque is empty or a thief took the last task
+ */
+static J9ThreadPoolTask *
+popTask(J9ThreadPoolWorker *worker)
+{
+	intptr_t bottom = worker->bottom - 1;
+	J9ThreadPoolTaskArray *array = worker->array;
+	J9ThreadPoolTask *task = NULL;
+	intptr_t top = 0;
+
+	worker->bottom = bottom;
+	issueReadWriteBarrier();
+	top = worker->top;
+
+	if (top <= bottom) {
+		task = array->tasks[bottom & (array->size - 1)];
+		if (top == bottom) {
+			/* last task: race any thieves for it */
+			if ((uintptr_t)top != compareAndSwapUDATA((uintptr_t *)&worker->top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+				task = NULL;
+			}
+			worker->bottom = bottom + 1;
+		}
+	} else {
+		worker->bottom = bottom + 1;
+	}
+
+	return task;
+}
+
+/**
+ * Steal a task from the top of another worker's deque.
+ *
+ * @return the task, or NULL if the deque is empty or another thread won the race for the task
+ */
+static J9ThreadPoolTask *
+stealTask(J9ThreadPoolWorker *victim)
+{
+	intptr_t top = victim->top;
+	intptr_t bottom = 0;
+
+	issueReadWriteBarrier();
+	bottom = victim->bottom;
+	if (top < bottom) {
+		J9ThreadPoolTaskArray *array = victim->array;
+		J9ThreadPoolTask *task = array->tasks[top & (array->size - 1)];
+		if ((uintptr_t)top == compareAndSwapUDATA((uintptr_t *)&victim->top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+			return task;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Take the oldest task from the pool's shared queue.
+ */
+static J9ThreadPoolTask *
+takeSharedTask(J9ThreadPool *pool)
+{
+	J9ThreadPoolTask *task = NULL;
+
+	if (NULL != pool->sharedHead) {
+		omrthread_monitor_enter(pool->monitor);
+		task = pool->sharedHead;
+		if (NULL != task) {
+			pool->sharedHead = task->next;
+			pool->sharedCount -= 1;
+		}
+		omrthread_monitor_exit(pool->monitor);
+	}
+	return task;
+}
+
+/**
+ * Find a task to run: first from the worker's own deque, then from the shared queue,
+ * and then by stealing from the other workers, starting with the next one along.
+ *
+ * @param[in] pool the pool
+ * @param[in] worker the current thread's worker, or NULL if it is not a worker of the pool
+ * @return a task, or NULL if none was found
+ */
+static J9ThreadPoolTask *
+findTask(J9ThreadPool *pool, J9ThreadPoolWorker *worker)
+{
+	J9ThreadPoolTask *task = NULL;
+	uintptr_t slots = pool->slotsInUse;
+	uintptr_t start = 0;
+	uintptr_t i = 0;
+
+	if (NULL != worker) {
+		task = popTask(worker);
+		if (NULL != task) {
+			return task;
+		}
+		start = worker->index + 1;
+	}
+
+	task = takeSharedTask(pool);
+	if (NULL != task) {
+		return task;
+	}
+
+	for (i = 0; i < slots; i++) {
+		J9ThreadPoolWorker *victim = &pool->workers[(start + i) % slots];
+		if (victim != worker) {
+			task = stealTask(victim);
+			if (NULL != task) {
+				if (NULL != worker) {
+					worker->steals += 1;
+				} else {
+					addAtomic(&pool->externalSteals, 1);
+				}
+				return task;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Check for queued tasks without taking any.
+ */
+static BOOLEAN
+hasWork(J9ThreadPool *pool)
+{
+	uintptr_t i = 0;
+
+	if (NULL != pool->sharedHead) {
+		return TRUE;
+	}
+	for (i = 0; i < pool->slotsInUse; i++) {
+		J9ThreadPoolWorker *worker = &pool->workers[i];
+		if (worker->top < worker->bottom) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Run a task, free it and count it against its join counter, waking joiners
+ * when the counter reaches zero.
+ */
+static void
+runTask(J9ThreadPool *pool, J9ThreadPoolWorker *worker, J9ThreadPoolTask *task)
+{
+	J9ThreadPoolJoin *join = task->join;
+
+	task->function(task->userData);
+	omrthread_free_memory(GLOBAL_DATA(default_library), task);
+
+	if (NULL != worker) {
+		worker->tasksExecuted += 1;
+	} else {
+		addAtomic(&pool->externalTasksExecuted, 1);
+	}
+
+	if (NULL != join) {
+		if (0 == subtractAtomic(&join->pending, 1)) {
+			issueReadWriteBarrier();
+			if (0 != pool->idleThreads) {
+				wakeIdleThreads(pool, TRUE);
+			}
+		}
+	}
+}
+
+static void
+wakeIdleThreads(J9ThreadPool *pool, BOOLEAN all)
+{
+	omrthread_monitor_enter(pool->monitor);
+	if (all) {
+		omrthread_monitor_notify_all(pool->monitor);
+	} else {
+		omrthread_monitor_notify(pool->monitor);
+	}
+	omrthread_monitor_exit(pool->monitor);
+}
+
+/**
+ * Start a worker in a free slot. The caller must own the pool's monitor.
+ *
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL otherwise
+ */
+static intptr_t
+startWorker(J9ThreadPool *pool)
+{
+	J9ThreadPoolWorker *worker = NULL;
+	omrthread_attr_t attr = NULL;
+	intptr_t rc = J9THREAD_POOL_FAIL;
+	uintptr_t i = 0;
+
+	for (i = 0; i < pool->maxWorkers; i++) {
+		if (!pool->workers[i].active) {
+			worker = &pool->workers[i];
+			break;
+		}
+	}
+	if (NULL == worker) {
+		return J9THREAD_POOL_FAIL;
+	}
+
+	if (J9THREAD_SUCCESS == omrthread_attr_init(&attr)) {
+		if (NULL != pool->name) {
+			omrthread_attr_set_name(&attr, pool->name);
+		}
+		worker->active = TRUE;
+		if (J9THREAD_SUCCESS == omrthread_create_ex(&worker->thread, &attr, 0, workerMain, worker)) {
+			rc = J9THREAD_POOL_OK;
+			pool->workerCount += 1;
+			if (pool->workerCount > pool->peakWorkerCount) {
+				pool->peakWorkerCount = pool->workerCount;
+			}
+			if (worker->index >= pool->slotsInUse) {
+				pool->slotsInUse = worker->index + 1;
+			}
+		} else {
+			worker->active = FALSE;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+
+	return rc;
+}
+
+/**
+ * Worker thread entry point: run tasks until the pool is destroyed, or, for a worker
+ * above the pool's minimum, until no work has arrived for the idle timeout.
+ */
+static int32_t J9THREAD_PROC
+workerMain(void *entryArg)
+{
+	J9ThreadPoolWorker *worker = (J9ThreadPoolWorker *)entryArg;
+	J9ThreadPool *pool = worker->pool;
+	omrthread_t self = MACRO_SELF();
+
+	omrthread_tls_set(self, pool->workerKey, worker);
+
+	omrthread_monitor_enter(pool->monitor);
+	if (0 != pool->numaNodeCount) {
+		omrthread_numa_set_node_affinity(self, pool->numaNodes, pool->numaNodeCount, 0);
+	}
+	omrthread_monitor_exit(pool->monitor);
+
+	for (;;) {
+		J9ThreadPoolTask *task = findTask(pool, worker);
+		if (NULL != task) {
+			runTask(pool, worker, task);
+			continue;
+		}
+
+		omrthread_monitor_enter(pool->monitor);
+		pool->idleThreads += 1;
+		issueReadWriteBarrier();
+		if (!hasWork(pool)) {
+			uint64_t idleStart = 0;
+			if (pool->shutdown) {
+				pool->idleThreads -= 1;
+				break;
+			}
+			idleStart = omrthread_get_hires_clock();
+			if ((pool->workerCount > pool->minWorkers) && (0 != pool->idleTimeoutMillis)) {
+				intptr_t rc = omrthread_monitor_wait_timed(pool->monitor, pool->idleTimeoutMillis, 0);
+				worker->idleTime += omrthread_get_hires_clock() - idleStart;
+				if ((J9THREAD_TIMED_OUT == rc) && (pool->workerCount > pool->minWorkers) && !hasWork(pool)) {
+					pool->idleThreads -= 1;
+					break;
+				}
+			} else {
+				omrthread_monitor_wait(pool->monitor);
+				worker->idleTime += omrthread_get_hires_clock() - idleStart;
+			}
+		}
+		pool->idleThreads -= 1;
+		omrthread_monitor_exit(pool->monitor);
+	}
+
+	/* still own the pool's monitor; the deque is empty since only this thread pushes to it */
+	omrthread_tls_set(self, pool->workerKey, NULL);
+	worker->active = FALSE;
+	pool->workerCount -= 1;
+	omrthread_monitor_notify_all(pool->monitor);
+	omrthread_exit(pool->monitor);
+
+	/* NOTREACHED */
+	return 0;
+}
@@ -18,16 +18,34 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/*
+ * Read-biased mutexes count readers in an array of slots, each on its own cache line,
+ * so that uncontended readers only write to the slot picked by their thread.
+ */
+#define RWMUTEX_READER_SLOT_COUNT  16
+#define RWMUTEX_READER_SLOT_SIZE  128
+
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t readers;
+	uint8_t padding[RWMUTEX_READER_SLOT_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	volatile uintptr_t writerPending;
+	RWMutexReaderSlot *readerSlots;
+	void *readerSlotsMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -37,10 +55,23 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_IS_READ_BIASED(m)  (J9_ARE_ANY_BITS_SET((m)->flags, J9THREAD_RWMUTEX_FLAG_READ_BIASED))
+
+static RWMutexReaderSlot *readerSlotForThread(omrthread_rwmutex_t mutex, omrthread_t self);
+static uintptr_t countReaders(omrthread_rwmutex_t mutex);
+static intptr_t enter_read_biased(omrthread_rwmutex_t mutex, omrthread_t self);
+static void exit_read_biased(omrthread_rwmutex_t mutex, omrthread_t self);
+static intptr_t enter_write_biased(omrthread_rwmutex_t mutex, omrthread_t self, BOOLEAN tryEnter);
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * If flags contains J9THREAD_RWMUTEX_FLAG_READ_BIASED, readers are counted in
+ * per-thread slots rather than under the mutex's monitor, which makes read
+ * acquisition cheap and write acquisition expensive. A read-biased mutex must not
+ * be re-entered for read by a thread which already holds it for read, since a
+ * writer waiting for the first read to be released holds off the second one.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -65,6 +96,27 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
+		mutex->flags = flags;
+		mutex->writerPending = 0;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+		if (RWMUTEX_IS_READ_BIASED(mutex)) {
+			uintptr_t slotsSize = RWMUTEX_READER_SLOT_COUNT * sizeof(RWMutexReaderSlot);
+			void *memory = omrthread_allocate_memory(lib, slotsSize + RWMUTEX_READER_SLOT_SIZE, OMRMEM_CATEGORY_THREADS);
+			if (NULL == memory) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			mutex->readerSlotsMemory = memory;
+			mutex->readerSlots = (RWMutexReaderSlot *)(((uintptr_t)memory + RWMUTEX_READER_SLOT_SIZE - 1) & ~(uintptr_t)(RWMUTEX_READER_SLOT_SIZE - 1));
+			memset(mutex->readerSlots, 0, slotsSize);
+		}
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
@@ -99,6 +151,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -130,6 +185,8 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
  * However, a thread with read access MUST NOT
  * ask for write access on the same mutex.
  *
+ * Read-biased mutexes may not be re-entered for read.
+ *
  * @param[in] mutex a mutex to be entered for read access
  * @return J9THREAD_RWMUTEX_OK on success
  *
@@ -138,11 +195,16 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_READ_BIASED(mutex)) {
+		return enter_read_biased(mutex, self);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status < 0) {
@@ -166,8 +228,14 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READ_BIASED(mutex)) {
+		exit_read_biased(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -220,6 +288,10 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_READ_BIASED(mutex)) {
+		return enter_write_biased(mutex, self, FALSE);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status != 0) {
@@ -258,6 +330,10 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_READ_BIASED(mutex)) {
+		return enter_write_biased(mutex, self, TRUE);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 	if (mutex->status != 0) {
 		/* must get out */
@@ -295,6 +371,7 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		mutex->writerPending = 0;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -317,6 +394,142 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 	return (RWMUTEX_STATUS_WRITING(mutex) || (0 != mutex->writer));
 }
 
+/**
+ * Pick the reader slot used by a thread. Thread structures are allocated
+ * from a pool, so consecutive threads land in consecutive slots.
+ *
+ * @param[in] mutex a read-biased mutex
+ * @param[in] self the current thread
+ * @return the reader slot for self
+ */
+static RWMutexReaderSlot *
+readerSlotForThread(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	return &mutex->readerSlots[((uintptr_t)self / sizeof(J9Thread)) % RWMUTEX_READER_SLOT_COUNT];
+}
+
+/**
+ * Sum the reader slots of a read-biased mutex.
+ *
+ * @param[in] mutex a read-biased mutex
+ * @return the number of threads counted as readers
+ */
+static uintptr_t
+countReaders(omrthread_rwmutex_t mutex)
+{
+	uintptr_t readers = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < RWMUTEX_READER_SLOT_COUNT; i++) {
+		readers += mutex->readerSlots[i].readers;
+	}
+	return readers;
+}
+
+/**
+ * Enter a read-biased mutex for read.
+ *
+ * The reader announces itself in its slot and then checks for a writer; the writer
+ * announces itself and then checks the slots. The full barriers on both sides
+ * guarantee that at least one of them sees the other. A reader which sees a
+ * writer backs out and waits on the monitor until the writer has finished.
+ *
+ * @param[in] mutex a read-biased mutex
+ * @param[in] self the current thread
+ * @return J9THREAD_RWMUTEX_OK
+ */
+static intptr_t
+enter_read_biased(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	RWMutexReaderSlot *slot = readerSlotForThread(mutex, self);
+
+	for (;;) {
+		addAtomic(&slot->readers, 1);
+		issueReadWriteBarrier();
+		if (0 == mutex->writerPending) {
+			break;
+		}
+
+		subtractAtomic(&slot->readers, 1);
+		issueReadWriteBarrier();
+		omrthread_monitor_enter(mutex->syncMon);
+		/* the writer may be waiting for this slot to drain */
+		omrthread_monitor_notify_all(mutex->syncMon);
+		while (0 != mutex->writerPending) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+
+	return J9THREAD_RWMUTEX_OK;
+}
+
+/**
+ * Exit a read-biased mutex for read, waking a writer which is waiting for the
+ * readers to drain.
+ *
+ * @param[in] mutex a read-biased mutex
+ * @param[in] self the current thread
+ */
+static void
+exit_read_biased(omrthread_rwmutex_t mutex, omrthread_t self)
+{
+	RWMutexReaderSlot *slot = readerSlotForThread(mutex, self);
+
+	subtractAtomic(&slot->readers, 1);
+	issueReadWriteBarrier();
+	if (0 != mutex->writerPending) {
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Enter a read-biased mutex for write. Writers exclude each other with
+ * writerPending, which also turns away new readers, and then wait for
+ * the reader slots to drain.
+ *
+ * @param[in] mutex a read-biased mutex
+ * @param[in] self the current thread
+ * @param[in] tryEnter if TRUE, fail rather than wait for another writer or for readers
+ * @return J9THREAD_RWMUTEX_OK, or J9THREAD_RWMUTEX_WOULDBLOCK if tryEnter was set and the mutex is busy
+ */
+static intptr_t
+enter_write_biased(omrthread_rwmutex_t mutex, omrthread_t self, BOOLEAN tryEnter)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+
+	while (0 != mutex->writerPending) {
+		if (tryEnter) {
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->writerPending = 1;
+	issueReadWriteBarrier();
+
+	while (0 != countReaders(mutex)) {
+		if (tryEnter) {
+			mutex->writerPending = 0;
+			/* wake readers which backed out when they saw this writer */
+			omrthread_monitor_notify_all(mutex->syncMon);
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->status--;
+	mutex->writer = self;
+
+	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
+
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return J9THREAD_RWMUTEX_OK;
+}
+
 #if defined(OMR_THR_FORK_SUPPORT)
 /**
  * @param [in] rwmutex to reset
@@ -326,7 +539,7 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_IS_READ_BIASED(rwmutex) && (0 != countReaders(rwmutex)))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -337,6 +550,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerPending = 0;
 	}
 }
 
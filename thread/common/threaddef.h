@@ -94,6 +94,16 @@ intptr_t omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monito
 intptr_t omrthread_spinlock_acquire_no_spin(omrthread_t self, omrthread_monitor_t monitor);
 uintptr_t omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState);
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX)
+intptr_t omrthread_spinlock_acquire_bounded(omrthread_t self, omrthread_monitor_t monitor);
+void omrthread_futex_wait(omrthread_monitor_t monitor, uint32_t sequence);
+void omrthread_futex_wake(omrthread_monitor_t monitor, BOOLEAN wakeAll);
+
+#define IS_FUTEX_MONITOR_LIB(lib) J9_ARE_ALL_BITS_SET((lib)->flags, J9THREAD_LIB_FLAG_FUTEX_MONITORS)
+#else /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+#define IS_FUTEX_MONITOR_LIB(lib) FALSE
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(LINUX) */
+
 /*
  * constants for profiling
  */
@@ -16,6 +16,13 @@
  *    Multiple authors (IBM Corp.) - initial implementation and documentation
  *******************************************************************************/
 
+#if defined(LINUX)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
 #include "AtomicSupport.hpp"
 
 extern "C" {
@@ -189,6 +196,106 @@ omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState)
 	return oldState;
 }
 
+#if defined(LINUX)
+
+/**
+ * Spin a bounded number of times trying to swap a monitor's spinlockState from
+ * SPINLOCK_UNOWNED to SPINLOCK_OWNED. This is the spin phase of a futex monitor.
+ *
+ * Unlike omrthread_spinlock_acquire() there is no omrthread_yield() tier: once the
+ * spinCount2 attempts are used up the caller sleeps on the monitor's futex. Spinning
+ * also stops early when the adaptive spin heuristic has disabled it for this monitor,
+ * or when the state is SPINLOCK_EXCEEDED, meaning other threads are already asleep
+ * waiting for the monitor.
+ *
+ * @param[in] self the current omrthread_t
+ * @param[in] monitor the monitor whose spinlock will be acquired
+ *
+ * @return 0 on success, -1 on failure
+ */
+intptr_t
+omrthread_spinlock_acquire_bounded(omrthread_t self, omrthread_monitor_t monitor)
+{
+	volatile uintptr_t *target = (volatile uintptr_t *)&monitor->spinlockState;
+	intptr_t result = -1;
+
+#if defined(OMR_THR_JLM)
+	J9ThreadMonitorTracing *tracing = NULL;
+	if (J9_ARE_ALL_BITS_SET(self->library->flags, J9THREAD_LIB_FLAG_JLM_ENABLED)) {
+		tracing = monitor->tracing;
+	}
+#endif /* OMR_THR_JLM */
+
+	uintptr_t spinCount2Init = monitor->spinCount2;
+	uintptr_t spinCount1Init = monitor->spinCount1;
+	uintptr_t spinCount2 = spinCount2Init;
+
+	for (; spinCount2 > 0; spinCount2--) {
+		uintptr_t state = *target;
+		if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == state) {
+			if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == VM_AtomicSupport::lockCompareExchange(target, J9THREAD_MONITOR_SPINLOCK_UNOWNED, J9THREAD_MONITOR_SPINLOCK_OWNED)) {
+				result = 0;
+				VM_AtomicSupport::readBarrier();
+				break;
+			}
+		} else if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == state) {
+			/* Threads are queued on the futex; join them rather than keep spinning */
+			break;
+		}
+		/* Stop spinning if adaptive spin heuristic disables spinning */
+		if (J9_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_DISABLE_SPINNING)) {
+			break;
+		}
+		VM_AtomicSupport::yieldCPU();
+		for (uintptr_t spinCount1 = spinCount1Init; spinCount1 > 0; spinCount1--) {
+			VM_AtomicSupport::nop();
+		}
+	}
+
+#if defined(OMR_THR_JLM)
+	if (NULL != tracing) {
+		VM_AtomicSupport::add(&tracing->spin2_count, spinCount2Init - spinCount2);
+	}
+#endif /* OMR_THR_JLM */
+
+	return result;
+}
+
+/**
+ * Sleep on a monitor's futexSequence until it is woken by omrthread_futex_wake().
+ *
+ * The caller reads futexSequence before it last tried to acquire the spinlock; if a
+ * wake has happened since then the sequence no longer matches and this returns at once,
+ * so a wake racing with a thread going to sleep is never lost. Spurious returns are
+ * possible, so the caller must retry the acquire in a loop.
+ *
+ * @param[in] monitor the monitor to wait for
+ * @param[in] sequence the value of futexSequence read before the failed acquire
+ */
+void
+omrthread_futex_wait(omrthread_monitor_t monitor, uint32_t sequence)
+{
+	syscall(SYS_futex, &monitor->futexSequence, FUTEX_WAIT_PRIVATE, sequence, NULL, NULL, 0);
+}
+
+/**
+ * Wake threads sleeping in omrthread_futex_wait() on a monitor.
+ *
+ * Releasing a contended monitor wakes a single waiter, which hands the wakeup down the
+ * kernel's FIFO futex queue one thread at a time instead of waking every blocked thread.
+ *
+ * @param[in] monitor the monitor whose waiters will be woken
+ * @param[in] wakeAll wake every waiter (TRUE) or only the first (FALSE)
+ */
+void
+omrthread_futex_wake(omrthread_monitor_t monitor, BOOLEAN wakeAll)
+{
+	VM_AtomicSupport::addU32(&monitor->futexSequence, 1);
+	syscall(SYS_futex, &monitor->futexSequence, FUTEX_WAKE_PRIVATE, wakeAll ? INT_MAX : 1, NULL, NULL, 0);
+}
+
+#endif /* defined(LINUX) */
+
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 }
@@ -34,6 +34,7 @@ OBJECTS :=\
   omrthreadinspect \
   omrthreadmem \
   omrthreadnuma \
+  omrthreadpool \
   omrthreadpriority \
   omrthreadtls \
   priority \
@@ -201,6 +202,13 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_rwmutex_try_enter_write >>$@
 @echo omrthread_rwmutex_exit_write >>$@
 @echo omrthread_rwmutex_is_writelocked >>$@
+@echo omrthread_pool_create >>$@
+@echo omrthread_pool_destroy >>$@
+@echo omrthread_pool_submit >>$@
+@echo omrthread_pool_join_init >>$@
+@echo omrthread_pool_join >>$@
+@echo omrthread_pool_set_numa_affinity >>$@
+@echo omrthread_pool_get_stats >>$@
 @echo omrthread_park >>$@
 @echo omrthread_unpark >>$@
 @echo omrthread_numa_get_max_node >>$@